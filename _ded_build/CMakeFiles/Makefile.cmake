@@ -0,0 +1,283 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bin/CMakeLists.txt"
+  "/root/repo/bin/ai/CMakeLists.txt"
+  "/root/repo/bin/data/CMakeLists.txt"
+  "/root/repo/bin/game/CMakeLists.txt"
+  "/root/repo/cmake/AddCustomXXXTimestamp.cmake"
+  "/root/repo/cmake/Catch.cmake"
+  "/root/repo/cmake/CheckAtomic.cmake"
+  "/root/repo/cmake/CompileFlags.cmake"
+  "/root/repo/cmake/CreateRegression.cmake"
+  "/root/repo/cmake/Endian.cmake"
+  "/root/repo/cmake/FindGrfcodec.cmake"
+  "/root/repo/cmake/FindLZO.cmake"
+  "/root/repo/cmake/FindSSE.cmake"
+  "/root/repo/cmake/FindXaudio2.cmake"
+  "/root/repo/cmake/FindZSTD.cmake"
+  "/root/repo/cmake/InstallAndPackage.cmake"
+  "/root/repo/cmake/LinkPackage.cmake"
+  "/root/repo/cmake/MSVCFilters.cmake"
+  "/root/repo/cmake/Options.cmake"
+  "/root/repo/cmake/PackageDeb.cmake"
+  "/root/repo/cmake/SourceList.cmake"
+  "/root/repo/cmake/Static.cmake"
+  "/root/repo/media/CMakeLists.txt"
+  "/root/repo/media/baseset/CMakeLists.txt"
+  "/root/repo/media/baseset/openttd/CMakeLists.txt"
+  "/root/repo/media/baseset/orig_extra/CMakeLists.txt"
+  "/root/repo/regression/CMakeLists.txt"
+  "/root/repo/regression/regression/CMakeLists.txt"
+  "/root/repo/regression/stationlist/CMakeLists.txt"
+  "/root/repo/src/3rdparty/CMakeLists.txt"
+  "/root/repo/src/3rdparty/catch2/CMakeLists.txt"
+  "/root/repo/src/3rdparty/fmt/CMakeLists.txt"
+  "/root/repo/src/3rdparty/icu/CMakeLists.txt"
+  "/root/repo/src/3rdparty/md5/CMakeLists.txt"
+  "/root/repo/src/3rdparty/monocypher/CMakeLists.txt"
+  "/root/repo/src/3rdparty/nlohmann/CMakeLists.txt"
+  "/root/repo/src/3rdparty/opengl/CMakeLists.txt"
+  "/root/repo/src/3rdparty/openttd_social_integration_api/CMakeLists.txt"
+  "/root/repo/src/3rdparty/squirrel/CMakeLists.txt"
+  "/root/repo/src/3rdparty/squirrel/include/CMakeLists.txt"
+  "/root/repo/src/3rdparty/squirrel/sqstdlib/CMakeLists.txt"
+  "/root/repo/src/3rdparty/squirrel/squirrel/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/ai/CMakeLists.txt"
+  "/root/repo/src/blitter/CMakeLists.txt"
+  "/root/repo/src/citymania/CMakeLists.txt"
+  "/root/repo/src/citymania/extensions/CMakeLists.txt"
+  "/root/repo/src/citymania/generated/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/fontcache/CMakeLists.txt"
+  "/root/repo/src/game/CMakeLists.txt"
+  "/root/repo/src/lang/CMakeLists.txt"
+  "/root/repo/src/linkgraph/CMakeLists.txt"
+  "/root/repo/src/misc/CMakeLists.txt"
+  "/root/repo/src/music/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/network/core/CMakeLists.txt"
+  "/root/repo/src/os/CMakeLists.txt"
+  "/root/repo/src/os/macosx/CMakeLists.txt"
+  "/root/repo/src/os/unix/CMakeLists.txt"
+  "/root/repo/src/os/windows/CMakeLists.txt"
+  "/root/repo/src/pathfinder/CMakeLists.txt"
+  "/root/repo/src/pathfinder/npf/CMakeLists.txt"
+  "/root/repo/src/pathfinder/yapf/CMakeLists.txt"
+  "/root/repo/src/saveload/CMakeLists.txt"
+  "/root/repo/src/saveload/compat/CMakeLists.txt"
+  "/root/repo/src/script/CMakeLists.txt"
+  "/root/repo/src/script/api/CMakeLists.txt"
+  "/root/repo/src/settingsgen/CMakeLists.txt"
+  "/root/repo/src/sound/CMakeLists.txt"
+  "/root/repo/src/spriteloader/CMakeLists.txt"
+  "/root/repo/src/strgen/CMakeLists.txt"
+  "/root/repo/src/table/CMakeLists.txt"
+  "/root/repo/src/table/settings/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/timer/CMakeLists.txt"
+  "/root/repo/src/video/CMakeLists.txt"
+  "/root/repo/src/video/cocoa/CMakeLists.txt"
+  "/root/repo/src/widgets/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-CXX.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.cpp"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibLZMA.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPNG.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/_CMakeLTOTest-CXX/src/CMakeLists.txt"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/foo.cpp"
+  "CMakeFiles/_CMakeLTOTest-CXX/src/main.cpp"
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/ai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/game/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bin/data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/script/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/script/api/ai.files"
+  "src/script/api/game.files"
+  "src/script/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/settingsgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/strgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/catch2/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/fmt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/icu/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/md5/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/monocypher/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/squirrel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/squirrel/include/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/squirrel/sqstdlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/squirrel/squirrel/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/nlohmann/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/opengl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/3rdparty/openttd_social_integration_api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ai/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/blitter/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/citymania/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/citymania/extensions/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/citymania/generated/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/fontcache/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/game/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lang/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/linkgraph/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/misc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/music/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/os/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/os/macosx/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/os/unix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/os/windows/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/pathfinder/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/pathfinder/npf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/pathfinder/yapf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/saveload/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/saveload/compat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/sound/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/spriteloader/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/table/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/table/settings/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/timer/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/video/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/video/cocoa/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/widgets/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "media/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "media/baseset/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "media/baseset/openttd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "media/baseset/orig_extra/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "regression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "regression/regression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "regression/stationlist/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/tools.dir/DependInfo.cmake"
+  "CMakeFiles/find_version.dir/DependInfo.cmake"
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/openttd_lib.dir/DependInfo.cmake"
+  "CMakeFiles/openttd.dir/DependInfo.cmake"
+  "CMakeFiles/openttd_test.dir/DependInfo.cmake"
+  "bin/ai/CMakeFiles/ai_compat_files.dir/DependInfo.cmake"
+  "bin/game/CMakeFiles/gs_compat_files.dir/DependInfo.cmake"
+  "bin/data/CMakeFiles/data_files.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_window.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_ai.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_ai_includes.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_game.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_game_includes.dir/DependInfo.cmake"
+  "src/script/api/CMakeFiles/script_template.dir/DependInfo.cmake"
+  "src/settingsgen/CMakeFiles/settingsgen.dir/DependInfo.cmake"
+  "src/strgen/CMakeFiles/strgen.dir/DependInfo.cmake"
+  "src/lang/CMakeFiles/language_files.dir/DependInfo.cmake"
+  "src/lang/CMakeFiles/table_strings.dir/DependInfo.cmake"
+  "src/table/settings/CMakeFiles/table_settings.dir/DependInfo.cmake"
+  "media/CMakeFiles/media_files.dir/DependInfo.cmake"
+  "media/CMakeFiles/desktop_file.dir/DependInfo.cmake"
+  "media/baseset/CMakeFiles/baseset_files.dir/DependInfo.cmake"
+  "regression/CMakeFiles/regression_files.dir/DependInfo.cmake"
+  "regression/CMakeFiles/regression.dir/DependInfo.cmake"
+  "regression/regression/CMakeFiles/regression_regression_files.dir/DependInfo.cmake"
+  "regression/regression/CMakeFiles/regression_regression.dir/DependInfo.cmake"
+  "regression/stationlist/CMakeFiles/regression_stationlist_files.dir/DependInfo.cmake"
+  "regression/stationlist/CMakeFiles/regression_stationlist.dir/DependInfo.cmake"
+  )
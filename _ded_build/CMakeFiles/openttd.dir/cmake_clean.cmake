@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openttd.dir/src/os/unix/unix_main.cpp.o"
+  "CMakeFiles/openttd.dir/src/os/unix/unix_main.cpp.o.d"
+  "openttd"
+  "openttd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openttd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
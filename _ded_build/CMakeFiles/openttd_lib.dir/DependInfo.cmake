@@ -0,0 +1,940 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx.cxx" "CMakeFiles/openttd_lib.dir/cmake_pch.hxx.gch" "gcc" "CMakeFiles/openttd_lib.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/cmake_pch.hxx.gch" "gcc" "CMakeFiles/openttd_lib.dir/cmake_pch.hxx.gch.d"
+  "/root/repo/_ded_build/generated/rev.cpp" "CMakeFiles/openttd_lib.dir/generated/rev.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/generated/rev.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/generated/rev.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/generated/rev.cpp.o.d"
+  "/root/repo/src/3rdparty/md5/md5.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/md5/md5.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/md5/md5.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/md5/md5.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/md5/md5.cpp.o.d"
+  "/root/repo/src/3rdparty/monocypher/monocypher-ed25519.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher-ed25519.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher-ed25519.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher-ed25519.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher-ed25519.cpp.o.d"
+  "/root/repo/src/3rdparty/monocypher/monocypher.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/monocypher/monocypher.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdaux.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/sqstdlib/sqstdmath.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqapi.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqapi.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqbaselib.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqbaselib.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqclass.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqclass.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqcompiler.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqcompiler.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqdebug.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqdebug.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqfuncstate.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqlexer.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqlexer.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqmem.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqmem.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqobject.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqobject.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqstate.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqstate.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqtable.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqtable.cpp.o.d"
+  "/root/repo/src/3rdparty/squirrel/squirrel/sqvm.cpp" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/3rdparty/squirrel/squirrel/sqvm.cpp.o.d"
+  "/root/repo/src/ai/ai_config.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_config.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_config.cpp.o.d"
+  "/root/repo/src/ai/ai_core.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_core.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_core.cpp.o.d"
+  "/root/repo/src/ai/ai_gui.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_gui.cpp.o.d"
+  "/root/repo/src/ai/ai_info.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_info.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_info.cpp.o.d"
+  "/root/repo/src/ai/ai_instance.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_instance.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_instance.cpp.o.d"
+  "/root/repo/src/ai/ai_scanner.cpp" "CMakeFiles/openttd_lib.dir/src/ai/ai_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_scanner.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ai/ai_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ai/ai_scanner.cpp.o.d"
+  "/root/repo/src/aircraft_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/aircraft_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/aircraft_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/aircraft_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/aircraft_cmd.cpp.o.d"
+  "/root/repo/src/aircraft_gui.cpp" "CMakeFiles/openttd_lib.dir/src/aircraft_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/aircraft_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/aircraft_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/aircraft_gui.cpp.o.d"
+  "/root/repo/src/airport.cpp" "CMakeFiles/openttd_lib.dir/src/airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/airport.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/airport.cpp.o.d"
+  "/root/repo/src/airport_gui.cpp" "CMakeFiles/openttd_lib.dir/src/airport_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/airport_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/airport_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/airport_gui.cpp.o.d"
+  "/root/repo/src/animated_tile.cpp" "CMakeFiles/openttd_lib.dir/src/animated_tile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/animated_tile.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/animated_tile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/animated_tile.cpp.o.d"
+  "/root/repo/src/articulated_vehicles.cpp" "CMakeFiles/openttd_lib.dir/src/articulated_vehicles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/articulated_vehicles.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/articulated_vehicles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/articulated_vehicles.cpp.o.d"
+  "/root/repo/src/autoreplace.cpp" "CMakeFiles/openttd_lib.dir/src/autoreplace.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/autoreplace.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace.cpp.o.d"
+  "/root/repo/src/autoreplace_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/autoreplace_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/autoreplace_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace_cmd.cpp.o.d"
+  "/root/repo/src/autoreplace_gui.cpp" "CMakeFiles/openttd_lib.dir/src/autoreplace_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/autoreplace_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/autoreplace_gui.cpp.o.d"
+  "/root/repo/src/base_consist.cpp" "CMakeFiles/openttd_lib.dir/src/base_consist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/base_consist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/base_consist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/base_consist.cpp.o.d"
+  "/root/repo/src/blitter/null.cpp" "CMakeFiles/openttd_lib.dir/src/blitter/null.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/blitter/null.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/blitter/null.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/blitter/null.cpp.o.d"
+  "/root/repo/src/bmp.cpp" "CMakeFiles/openttd_lib.dir/src/bmp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bmp.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/bmp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bmp.cpp.o.d"
+  "/root/repo/src/bootstrap_gui.cpp" "CMakeFiles/openttd_lib.dir/src/bootstrap_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bootstrap_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/bootstrap_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bootstrap_gui.cpp.o.d"
+  "/root/repo/src/bridge_gui.cpp" "CMakeFiles/openttd_lib.dir/src/bridge_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bridge_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/bridge_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bridge_gui.cpp.o.d"
+  "/root/repo/src/bridge_map.cpp" "CMakeFiles/openttd_lib.dir/src/bridge_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bridge_map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/bridge_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/bridge_map.cpp.o.d"
+  "/root/repo/src/build_vehicle_gui.cpp" "CMakeFiles/openttd_lib.dir/src/build_vehicle_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/build_vehicle_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/build_vehicle_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/build_vehicle_gui.cpp.o.d"
+  "/root/repo/src/cargoaction.cpp" "CMakeFiles/openttd_lib.dir/src/cargoaction.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargoaction.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cargoaction.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargoaction.cpp.o.d"
+  "/root/repo/src/cargomonitor.cpp" "CMakeFiles/openttd_lib.dir/src/cargomonitor.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargomonitor.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cargomonitor.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargomonitor.cpp.o.d"
+  "/root/repo/src/cargopacket.cpp" "CMakeFiles/openttd_lib.dir/src/cargopacket.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargopacket.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cargopacket.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargopacket.cpp.o.d"
+  "/root/repo/src/cargotype.cpp" "CMakeFiles/openttd_lib.dir/src/cargotype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargotype.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cargotype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cargotype.cpp.o.d"
+  "/root/repo/src/cheat.cpp" "CMakeFiles/openttd_lib.dir/src/cheat.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cheat.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cheat.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cheat.cpp.o.d"
+  "/root/repo/src/cheat_gui.cpp" "CMakeFiles/openttd_lib.dir/src/cheat_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cheat_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cheat_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cheat_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_base64.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_base64.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_base64.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_base64.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_base64.cpp.o.d"
+  "/root/repo/src/citymania/cm_bitstream.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_bitstream.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_bitstream.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_bitstream.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_bitstream.cpp.o.d"
+  "/root/repo/src/citymania/cm_blueprint.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_blueprint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_blueprint.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_blueprint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_blueprint.cpp.o.d"
+  "/root/repo/src/citymania/cm_cargo_table_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_cargo_table_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_cargo_table_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_cargo_table_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_cargo_table_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_client_list_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_client_list_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_client_list_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_client_list_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_client_list_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_colour.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_colour.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_colour.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_colour.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_colour.cpp.o.d"
+  "/root/repo/src/citymania/cm_command_log.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_command_log.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_command_log.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_command_log.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_command_log.cpp.o.d"
+  "/root/repo/src/citymania/cm_commands.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands.cpp.o.d"
+  "/root/repo/src/citymania/cm_commands_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_commands_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_console_cmds.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_console_cmds.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_console_cmds.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_console_cmds.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_console_cmds.cpp.o.d"
+  "/root/repo/src/citymania/cm_export.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_export.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_export.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_export.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_export.cpp.o.d"
+  "/root/repo/src/citymania/cm_game.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_game.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_game.cpp.o.d"
+  "/root/repo/src/citymania/cm_highlight.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_highlight.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_highlight.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_highlight.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_highlight.cpp.o.d"
+  "/root/repo/src/citymania/cm_hotkeys.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_hotkeys.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_hotkeys.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_hotkeys.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_hotkeys.cpp.o.d"
+  "/root/repo/src/citymania/cm_locations.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_locations.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_locations.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_locations.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_locations.cpp.o.d"
+  "/root/repo/src/citymania/cm_main.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_main.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_main.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_main.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_main.cpp.o.d"
+  "/root/repo/src/citymania/cm_minimap.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_minimap.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_minimap.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_minimap.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_minimap.cpp.o.d"
+  "/root/repo/src/citymania/cm_misc_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_misc_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_misc_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_misc_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_misc_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_overlays.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_overlays.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_overlays.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_overlays.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_overlays.cpp.o.d"
+  "/root/repo/src/citymania/cm_rail_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_rail_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_rail_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_rail_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_rail_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_saveload.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_saveload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_saveload.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_saveload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_saveload.cpp.o.d"
+  "/root/repo/src/citymania/cm_station_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_station_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_station_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_station_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_station_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_tooltips.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_tooltips.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_tooltips.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_tooltips.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_tooltips.cpp.o.d"
+  "/root/repo/src/citymania/cm_watch_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_watch_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_watch_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_watch_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_watch_gui.cpp.o.d"
+  "/root/repo/src/citymania/cm_zoning_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_cmd.cpp.o.d"
+  "/root/repo/src/citymania/cm_zoning_gui.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/cm_zoning_gui.cpp.o.d"
+  "/root/repo/src/citymania/generated/cm_gen_commands.cpp" "CMakeFiles/openttd_lib.dir/src/citymania/generated/cm_gen_commands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/generated/cm_gen_commands.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/citymania/generated/cm_gen_commands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/citymania/generated/cm_gen_commands.cpp.o.d"
+  "/root/repo/src/clear_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/clear_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/clear_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/clear_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/clear_cmd.cpp.o.d"
+  "/root/repo/src/command.cpp" "CMakeFiles/openttd_lib.dir/src/command.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/command.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/command.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/command.cpp.o.d"
+  "/root/repo/src/company_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/company_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/company_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/company_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/company_cmd.cpp.o.d"
+  "/root/repo/src/company_gui.cpp" "CMakeFiles/openttd_lib.dir/src/company_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/company_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/company_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/company_gui.cpp.o.d"
+  "/root/repo/src/console.cpp" "CMakeFiles/openttd_lib.dir/src/console.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/console.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console.cpp.o.d"
+  "/root/repo/src/console_cmds.cpp" "CMakeFiles/openttd_lib.dir/src/console_cmds.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console_cmds.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/console_cmds.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console_cmds.cpp.o.d"
+  "/root/repo/src/console_gui.cpp" "CMakeFiles/openttd_lib.dir/src/console_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/console_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/console_gui.cpp.o.d"
+  "/root/repo/src/core/alloc_func.cpp" "CMakeFiles/openttd_lib.dir/src/core/alloc_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/alloc_func.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/core/alloc_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/alloc_func.cpp.o.d"
+  "/root/repo/src/core/geometry_func.cpp" "CMakeFiles/openttd_lib.dir/src/core/geometry_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/geometry_func.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/core/geometry_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/geometry_func.cpp.o.d"
+  "/root/repo/src/core/math_func.cpp" "CMakeFiles/openttd_lib.dir/src/core/math_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/math_func.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/core/math_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/math_func.cpp.o.d"
+  "/root/repo/src/core/pool_func.cpp" "CMakeFiles/openttd_lib.dir/src/core/pool_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/pool_func.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/core/pool_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/pool_func.cpp.o.d"
+  "/root/repo/src/core/random_func.cpp" "CMakeFiles/openttd_lib.dir/src/core/random_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/random_func.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/core/random_func.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/core/random_func.cpp.o.d"
+  "/root/repo/src/cpu.cpp" "CMakeFiles/openttd_lib.dir/src/cpu.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cpu.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/cpu.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/cpu.cpp.o.d"
+  "/root/repo/src/crashlog.cpp" "CMakeFiles/openttd_lib.dir/src/crashlog.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/crashlog.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/crashlog.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/crashlog.cpp.o.d"
+  "/root/repo/src/currency.cpp" "CMakeFiles/openttd_lib.dir/src/currency.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/currency.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/currency.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/currency.cpp.o.d"
+  "/root/repo/src/date_gui.cpp" "CMakeFiles/openttd_lib.dir/src/date_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/date_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/date_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/date_gui.cpp.o.d"
+  "/root/repo/src/debug.cpp" "CMakeFiles/openttd_lib.dir/src/debug.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/debug.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/debug.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/debug.cpp.o.d"
+  "/root/repo/src/dedicated.cpp" "CMakeFiles/openttd_lib.dir/src/dedicated.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/dedicated.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/dedicated.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/dedicated.cpp.o.d"
+  "/root/repo/src/depot.cpp" "CMakeFiles/openttd_lib.dir/src/depot.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/depot.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot.cpp.o.d"
+  "/root/repo/src/depot_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/depot_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/depot_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot_cmd.cpp.o.d"
+  "/root/repo/src/depot_gui.cpp" "CMakeFiles/openttd_lib.dir/src/depot_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/depot_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/depot_gui.cpp.o.d"
+  "/root/repo/src/disaster_vehicle.cpp" "CMakeFiles/openttd_lib.dir/src/disaster_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/disaster_vehicle.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/disaster_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/disaster_vehicle.cpp.o.d"
+  "/root/repo/src/dock_gui.cpp" "CMakeFiles/openttd_lib.dir/src/dock_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/dock_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/dock_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/dock_gui.cpp.o.d"
+  "/root/repo/src/driver.cpp" "CMakeFiles/openttd_lib.dir/src/driver.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/driver.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/driver.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/driver.cpp.o.d"
+  "/root/repo/src/economy.cpp" "CMakeFiles/openttd_lib.dir/src/economy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/economy.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/economy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/economy.cpp.o.d"
+  "/root/repo/src/effectvehicle.cpp" "CMakeFiles/openttd_lib.dir/src/effectvehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/effectvehicle.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/effectvehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/effectvehicle.cpp.o.d"
+  "/root/repo/src/elrail.cpp" "CMakeFiles/openttd_lib.dir/src/elrail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/elrail.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/elrail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/elrail.cpp.o.d"
+  "/root/repo/src/engine.cpp" "CMakeFiles/openttd_lib.dir/src/engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/engine.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/engine.cpp.o.d"
+  "/root/repo/src/engine_gui.cpp" "CMakeFiles/openttd_lib.dir/src/engine_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/engine_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/engine_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/engine_gui.cpp.o.d"
+  "/root/repo/src/error.cpp" "CMakeFiles/openttd_lib.dir/src/error.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/error.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/error.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/error.cpp.o.d"
+  "/root/repo/src/error_gui.cpp" "CMakeFiles/openttd_lib.dir/src/error_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/error_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/error_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/error_gui.cpp.o.d"
+  "/root/repo/src/fileio.cpp" "CMakeFiles/openttd_lib.dir/src/fileio.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fileio.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fileio.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fileio.cpp.o.d"
+  "/root/repo/src/fios.cpp" "CMakeFiles/openttd_lib.dir/src/fios.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fios.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fios.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fios.cpp.o.d"
+  "/root/repo/src/fios_gui.cpp" "CMakeFiles/openttd_lib.dir/src/fios_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fios_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fios_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fios_gui.cpp.o.d"
+  "/root/repo/src/fontcache.cpp" "CMakeFiles/openttd_lib.dir/src/fontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache.cpp.o.d"
+  "/root/repo/src/fontcache/spritefontcache.cpp" "CMakeFiles/openttd_lib.dir/src/fontcache/spritefontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache/spritefontcache.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fontcache/spritefontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache/spritefontcache.cpp.o.d"
+  "/root/repo/src/fontcache/truetypefontcache.cpp" "CMakeFiles/openttd_lib.dir/src/fontcache/truetypefontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache/truetypefontcache.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/fontcache/truetypefontcache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/fontcache/truetypefontcache.cpp.o.d"
+  "/root/repo/src/framerate_gui.cpp" "CMakeFiles/openttd_lib.dir/src/framerate_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/framerate_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/framerate_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/framerate_gui.cpp.o.d"
+  "/root/repo/src/game/game_config.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_config.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_config.cpp.o.d"
+  "/root/repo/src/game/game_core.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_core.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_core.cpp.o.d"
+  "/root/repo/src/game/game_gui.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_gui.cpp.o.d"
+  "/root/repo/src/game/game_info.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_info.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_info.cpp.o.d"
+  "/root/repo/src/game/game_instance.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_instance.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_instance.cpp.o.d"
+  "/root/repo/src/game/game_scanner.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_scanner.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_scanner.cpp.o.d"
+  "/root/repo/src/game/game_text.cpp" "CMakeFiles/openttd_lib.dir/src/game/game_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_text.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/game/game_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/game/game_text.cpp.o.d"
+  "/root/repo/src/gamelog.cpp" "CMakeFiles/openttd_lib.dir/src/gamelog.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gamelog.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/gamelog.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gamelog.cpp.o.d"
+  "/root/repo/src/genworld.cpp" "CMakeFiles/openttd_lib.dir/src/genworld.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/genworld.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/genworld.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/genworld.cpp.o.d"
+  "/root/repo/src/genworld_gui.cpp" "CMakeFiles/openttd_lib.dir/src/genworld_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/genworld_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/genworld_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/genworld_gui.cpp.o.d"
+  "/root/repo/src/gfx.cpp" "CMakeFiles/openttd_lib.dir/src/gfx.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/gfx.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx.cpp.o.d"
+  "/root/repo/src/gfx_layout.cpp" "CMakeFiles/openttd_lib.dir/src/gfx_layout.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx_layout.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/gfx_layout.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx_layout.cpp.o.d"
+  "/root/repo/src/gfx_layout_fallback.cpp" "CMakeFiles/openttd_lib.dir/src/gfx_layout_fallback.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx_layout_fallback.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/gfx_layout_fallback.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfx_layout_fallback.cpp.o.d"
+  "/root/repo/src/gfxinit.cpp" "CMakeFiles/openttd_lib.dir/src/gfxinit.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfxinit.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/gfxinit.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/gfxinit.cpp.o.d"
+  "/root/repo/src/goal.cpp" "CMakeFiles/openttd_lib.dir/src/goal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/goal.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/goal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/goal.cpp.o.d"
+  "/root/repo/src/goal_gui.cpp" "CMakeFiles/openttd_lib.dir/src/goal_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/goal_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/goal_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/goal_gui.cpp.o.d"
+  "/root/repo/src/graph_gui.cpp" "CMakeFiles/openttd_lib.dir/src/graph_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/graph_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/graph_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/graph_gui.cpp.o.d"
+  "/root/repo/src/ground_vehicle.cpp" "CMakeFiles/openttd_lib.dir/src/ground_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ground_vehicle.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ground_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ground_vehicle.cpp.o.d"
+  "/root/repo/src/group_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/group_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/group_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/group_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/group_cmd.cpp.o.d"
+  "/root/repo/src/group_gui.cpp" "CMakeFiles/openttd_lib.dir/src/group_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/group_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/group_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/group_gui.cpp.o.d"
+  "/root/repo/src/heightmap.cpp" "CMakeFiles/openttd_lib.dir/src/heightmap.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/heightmap.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/heightmap.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/heightmap.cpp.o.d"
+  "/root/repo/src/help_gui.cpp" "CMakeFiles/openttd_lib.dir/src/help_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/help_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/help_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/help_gui.cpp.o.d"
+  "/root/repo/src/highscore.cpp" "CMakeFiles/openttd_lib.dir/src/highscore.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/highscore.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/highscore.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/highscore.cpp.o.d"
+  "/root/repo/src/highscore_gui.cpp" "CMakeFiles/openttd_lib.dir/src/highscore_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/highscore_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/highscore_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/highscore_gui.cpp.o.d"
+  "/root/repo/src/hotkeys.cpp" "CMakeFiles/openttd_lib.dir/src/hotkeys.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/hotkeys.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/hotkeys.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/hotkeys.cpp.o.d"
+  "/root/repo/src/industry_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/industry_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/industry_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/industry_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/industry_cmd.cpp.o.d"
+  "/root/repo/src/industry_gui.cpp" "CMakeFiles/openttd_lib.dir/src/industry_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/industry_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/industry_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/industry_gui.cpp.o.d"
+  "/root/repo/src/ini.cpp" "CMakeFiles/openttd_lib.dir/src/ini.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ini.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ini.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ini.cpp.o.d"
+  "/root/repo/src/ini_load.cpp" "CMakeFiles/openttd_lib.dir/src/ini_load.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ini_load.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ini_load.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ini_load.cpp.o.d"
+  "/root/repo/src/intro_gui.cpp" "CMakeFiles/openttd_lib.dir/src/intro_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/intro_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/intro_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/intro_gui.cpp.o.d"
+  "/root/repo/src/landscape.cpp" "CMakeFiles/openttd_lib.dir/src/landscape.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/landscape.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/landscape.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/landscape.cpp.o.d"
+  "/root/repo/src/league_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/league_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/league_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/league_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/league_cmd.cpp.o.d"
+  "/root/repo/src/league_gui.cpp" "CMakeFiles/openttd_lib.dir/src/league_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/league_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/league_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/league_gui.cpp.o.d"
+  "/root/repo/src/linkgraph/demands.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/demands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/demands.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/demands.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/demands.cpp.o.d"
+  "/root/repo/src/linkgraph/flowmapper.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/flowmapper.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/flowmapper.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/flowmapper.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/flowmapper.cpp.o.d"
+  "/root/repo/src/linkgraph/linkgraph.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph.cpp.o.d"
+  "/root/repo/src/linkgraph/linkgraph_gui.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraph_gui.cpp.o.d"
+  "/root/repo/src/linkgraph/linkgraphjob.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphjob.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphjob.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphjob.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphjob.cpp.o.d"
+  "/root/repo/src/linkgraph/linkgraphschedule.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphschedule.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphschedule.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphschedule.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/linkgraphschedule.cpp.o.d"
+  "/root/repo/src/linkgraph/mcf.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/mcf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/mcf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/mcf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/mcf.cpp.o.d"
+  "/root/repo/src/linkgraph/refresh.cpp" "CMakeFiles/openttd_lib.dir/src/linkgraph/refresh.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/refresh.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/linkgraph/refresh.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/linkgraph/refresh.cpp.o.d"
+  "/root/repo/src/main_gui.cpp" "CMakeFiles/openttd_lib.dir/src/main_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/main_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/main_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/main_gui.cpp.o.d"
+  "/root/repo/src/map.cpp" "CMakeFiles/openttd_lib.dir/src/map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/map.cpp.o.d"
+  "/root/repo/src/misc.cpp" "CMakeFiles/openttd_lib.dir/src/misc.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc.cpp.o.d"
+  "/root/repo/src/misc/countedobj.cpp" "CMakeFiles/openttd_lib.dir/src/misc/countedobj.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/countedobj.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc/countedobj.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/countedobj.cpp.o.d"
+  "/root/repo/src/misc/dbg_helpers.cpp" "CMakeFiles/openttd_lib.dir/src/misc/dbg_helpers.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/dbg_helpers.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc/dbg_helpers.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/dbg_helpers.cpp.o.d"
+  "/root/repo/src/misc/getoptdata.cpp" "CMakeFiles/openttd_lib.dir/src/misc/getoptdata.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/getoptdata.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc/getoptdata.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc/getoptdata.cpp.o.d"
+  "/root/repo/src/misc_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/misc_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc_cmd.cpp.o.d"
+  "/root/repo/src/misc_gui.cpp" "CMakeFiles/openttd_lib.dir/src/misc_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/misc_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/misc_gui.cpp.o.d"
+  "/root/repo/src/mixer.cpp" "CMakeFiles/openttd_lib.dir/src/mixer.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/mixer.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/mixer.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/mixer.cpp.o.d"
+  "/root/repo/src/music.cpp" "CMakeFiles/openttd_lib.dir/src/music.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/music.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music.cpp.o.d"
+  "/root/repo/src/music/midifile.cpp" "CMakeFiles/openttd_lib.dir/src/music/midifile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music/midifile.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/music/midifile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music/midifile.cpp.o.d"
+  "/root/repo/src/music/null_m.cpp" "CMakeFiles/openttd_lib.dir/src/music/null_m.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music/null_m.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/music/null_m.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music/null_m.cpp.o.d"
+  "/root/repo/src/music_gui.cpp" "CMakeFiles/openttd_lib.dir/src/music_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/music_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/music_gui.cpp.o.d"
+  "/root/repo/src/network/core/address.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/address.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/address.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/address.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/address.cpp.o.d"
+  "/root/repo/src/network/core/config.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/config.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/config.cpp.o.d"
+  "/root/repo/src/network/core/core.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/core.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/core.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/core.cpp.o.d"
+  "/root/repo/src/network/core/host.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/host.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/host.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/host.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/host.cpp.o.d"
+  "/root/repo/src/network/core/http_curl.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/http_curl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/http_curl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/http_curl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/http_curl.cpp.o.d"
+  "/root/repo/src/network/core/network_game_info.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/network_game_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/network_game_info.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/network_game_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/network_game_info.cpp.o.d"
+  "/root/repo/src/network/core/os_abstraction.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/os_abstraction.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/os_abstraction.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/os_abstraction.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/os_abstraction.cpp.o.d"
+  "/root/repo/src/network/core/packet.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/packet.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/packet.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/packet.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/packet.cpp.o.d"
+  "/root/repo/src/network/core/tcp.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp.cpp.o.d"
+  "/root/repo/src/network/core/tcp_admin.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_admin.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_admin.cpp.o.d"
+  "/root/repo/src/network/core/tcp_connect.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_connect.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_connect.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_connect.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_connect.cpp.o.d"
+  "/root/repo/src/network/core/tcp_content.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_content.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_content.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_content.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_content.cpp.o.d"
+  "/root/repo/src/network/core/tcp_coordinator.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_coordinator.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_coordinator.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_coordinator.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_coordinator.cpp.o.d"
+  "/root/repo/src/network/core/tcp_game.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_game.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_game.cpp.o.d"
+  "/root/repo/src/network/core/tcp_stun.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_stun.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_stun.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_stun.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_stun.cpp.o.d"
+  "/root/repo/src/network/core/tcp_turn.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_turn.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_turn.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_turn.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/tcp_turn.cpp.o.d"
+  "/root/repo/src/network/core/udp.cpp" "CMakeFiles/openttd_lib.dir/src/network/core/udp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/udp.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/core/udp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/core/udp.cpp.o.d"
+  "/root/repo/src/network/network.cpp" "CMakeFiles/openttd_lib.dir/src/network/network.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network.cpp.o.d"
+  "/root/repo/src/network/network_admin.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_admin.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_admin.cpp.o.d"
+  "/root/repo/src/network/network_chat_gui.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_chat_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_chat_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_chat_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_chat_gui.cpp.o.d"
+  "/root/repo/src/network/network_client.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_client.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_client.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_client.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_client.cpp.o.d"
+  "/root/repo/src/network/network_command.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_command.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_command.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_command.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_command.cpp.o.d"
+  "/root/repo/src/network/network_content.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_content.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_content.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_content.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_content.cpp.o.d"
+  "/root/repo/src/network/network_content_gui.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_content_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_content_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_content_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_content_gui.cpp.o.d"
+  "/root/repo/src/network/network_coordinator.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_coordinator.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_coordinator.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_coordinator.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_coordinator.cpp.o.d"
+  "/root/repo/src/network/network_gamelist.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_gamelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_gamelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_gamelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_gamelist.cpp.o.d"
+  "/root/repo/src/network/network_gui.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_gui.cpp.o.d"
+  "/root/repo/src/network/network_query.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_query.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_query.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_query.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_query.cpp.o.d"
+  "/root/repo/src/network/network_server.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_server.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_server.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_server.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_server.cpp.o.d"
+  "/root/repo/src/network/network_stun.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_stun.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_stun.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_stun.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_stun.cpp.o.d"
+  "/root/repo/src/network/network_survey.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_survey.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_survey.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_survey.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_survey.cpp.o.d"
+  "/root/repo/src/network/network_turn.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_turn.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_turn.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_turn.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_turn.cpp.o.d"
+  "/root/repo/src/network/network_udp.cpp" "CMakeFiles/openttd_lib.dir/src/network/network_udp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_udp.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/network/network_udp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/network/network_udp.cpp.o.d"
+  "/root/repo/src/newgrf.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf.cpp.o.d"
+  "/root/repo/src/newgrf_airport.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_airport.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_airport.cpp.o.d"
+  "/root/repo/src/newgrf_airporttiles.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_airporttiles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_airporttiles.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_airporttiles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_airporttiles.cpp.o.d"
+  "/root/repo/src/newgrf_canal.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_canal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_canal.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_canal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_canal.cpp.o.d"
+  "/root/repo/src/newgrf_cargo.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_cargo.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_cargo.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_cargo.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_cargo.cpp.o.d"
+  "/root/repo/src/newgrf_commons.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_commons.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_commons.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_commons.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_commons.cpp.o.d"
+  "/root/repo/src/newgrf_config.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_config.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_config.cpp.o.d"
+  "/root/repo/src/newgrf_debug_gui.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_debug_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_debug_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_debug_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_debug_gui.cpp.o.d"
+  "/root/repo/src/newgrf_engine.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_engine.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_engine.cpp.o.d"
+  "/root/repo/src/newgrf_generic.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_generic.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_generic.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_generic.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_generic.cpp.o.d"
+  "/root/repo/src/newgrf_gui.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_gui.cpp.o.d"
+  "/root/repo/src/newgrf_house.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_house.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_house.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_house.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_house.cpp.o.d"
+  "/root/repo/src/newgrf_industries.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_industries.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_industries.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_industries.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_industries.cpp.o.d"
+  "/root/repo/src/newgrf_industrytiles.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_industrytiles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_industrytiles.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_industrytiles.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_industrytiles.cpp.o.d"
+  "/root/repo/src/newgrf_object.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_object.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_object.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_object.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_object.cpp.o.d"
+  "/root/repo/src/newgrf_profiling.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_profiling.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_profiling.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_profiling.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_profiling.cpp.o.d"
+  "/root/repo/src/newgrf_railtype.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_railtype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_railtype.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_railtype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_railtype.cpp.o.d"
+  "/root/repo/src/newgrf_roadstop.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_roadstop.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_roadstop.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_roadstop.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_roadstop.cpp.o.d"
+  "/root/repo/src/newgrf_roadtype.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_roadtype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_roadtype.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_roadtype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_roadtype.cpp.o.d"
+  "/root/repo/src/newgrf_sound.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_sound.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_sound.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_sound.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_sound.cpp.o.d"
+  "/root/repo/src/newgrf_spritegroup.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_spritegroup.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_spritegroup.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_spritegroup.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_spritegroup.cpp.o.d"
+  "/root/repo/src/newgrf_station.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_station.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_station.cpp.o.d"
+  "/root/repo/src/newgrf_storage.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_storage.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_storage.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_storage.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_storage.cpp.o.d"
+  "/root/repo/src/newgrf_text.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_text.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_text.cpp.o.d"
+  "/root/repo/src/newgrf_town.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_town.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_town.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_town.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_town.cpp.o.d"
+  "/root/repo/src/newgrf_townname.cpp" "CMakeFiles/openttd_lib.dir/src/newgrf_townname.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_townname.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/newgrf_townname.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/newgrf_townname.cpp.o.d"
+  "/root/repo/src/news_gui.cpp" "CMakeFiles/openttd_lib.dir/src/news_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/news_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/news_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/news_gui.cpp.o.d"
+  "/root/repo/src/object_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/object_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/object_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/object_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/object_cmd.cpp.o.d"
+  "/root/repo/src/object_gui.cpp" "CMakeFiles/openttd_lib.dir/src/object_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/object_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/object_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/object_gui.cpp.o.d"
+  "/root/repo/src/openttd.cpp" "CMakeFiles/openttd_lib.dir/src/openttd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/openttd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/openttd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/openttd.cpp.o.d"
+  "/root/repo/src/order_backup.cpp" "CMakeFiles/openttd_lib.dir/src/order_backup.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_backup.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/order_backup.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_backup.cpp.o.d"
+  "/root/repo/src/order_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/order_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/order_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_cmd.cpp.o.d"
+  "/root/repo/src/order_gui.cpp" "CMakeFiles/openttd_lib.dir/src/order_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/order_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/order_gui.cpp.o.d"
+  "/root/repo/src/os/unix/crashlog_unix.cpp" "CMakeFiles/openttd_lib.dir/src/os/unix/crashlog_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/crashlog_unix.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/os/unix/crashlog_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/crashlog_unix.cpp.o.d"
+  "/root/repo/src/os/unix/library_loader_unix.cpp" "CMakeFiles/openttd_lib.dir/src/os/unix/library_loader_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/library_loader_unix.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/os/unix/library_loader_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/library_loader_unix.cpp.o.d"
+  "/root/repo/src/os/unix/survey_unix.cpp" "CMakeFiles/openttd_lib.dir/src/os/unix/survey_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/survey_unix.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/os/unix/survey_unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/survey_unix.cpp.o.d"
+  "/root/repo/src/os/unix/unix.cpp" "CMakeFiles/openttd_lib.dir/src/os/unix/unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/unix.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/os/unix/unix.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/os/unix/unix.cpp.o.d"
+  "/root/repo/src/osk_gui.cpp" "CMakeFiles/openttd_lib.dir/src/osk_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/osk_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/osk_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/osk_gui.cpp.o.d"
+  "/root/repo/src/palette.cpp" "CMakeFiles/openttd_lib.dir/src/palette.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/palette.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/palette.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/palette.cpp.o.d"
+  "/root/repo/src/pathfinder/npf/aystar.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/aystar.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/aystar.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/aystar.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/aystar.cpp.o.d"
+  "/root/repo/src/pathfinder/npf/npf.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/npf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/npf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/npf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/npf.cpp.o.d"
+  "/root/repo/src/pathfinder/npf/queue.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/queue.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/queue.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/queue.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/npf/queue.cpp.o.d"
+  "/root/repo/src/pathfinder/water_regions.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/water_regions.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/water_regions.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/water_regions.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/water_regions.cpp.o.d"
+  "/root/repo/src/pathfinder/yapf/yapf_rail.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail.cpp.o.d"
+  "/root/repo/src/pathfinder/yapf/yapf_rail_graph.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail_graph.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail_graph.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail_graph.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_rail_graph.cpp.o.d"
+  "/root/repo/src/pathfinder/yapf/yapf_road.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_road.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_road.cpp.o.d"
+  "/root/repo/src/pathfinder/yapf/yapf_ship.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship.cpp.o.d"
+  "/root/repo/src/pathfinder/yapf/yapf_ship_regions.cpp" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship_regions.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship_regions.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship_regions.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pathfinder/yapf/yapf_ship_regions.cpp.o.d"
+  "/root/repo/src/pbs.cpp" "CMakeFiles/openttd_lib.dir/src/pbs.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pbs.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/pbs.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/pbs.cpp.o.d"
+  "/root/repo/src/progress.cpp" "CMakeFiles/openttd_lib.dir/src/progress.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/progress.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/progress.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/progress.cpp.o.d"
+  "/root/repo/src/rail.cpp" "CMakeFiles/openttd_lib.dir/src/rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail.cpp.o.d"
+  "/root/repo/src/rail_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/rail_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/rail_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail_cmd.cpp.o.d"
+  "/root/repo/src/rail_gui.cpp" "CMakeFiles/openttd_lib.dir/src/rail_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/rail_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/rail_gui.cpp.o.d"
+  "/root/repo/src/random_access_file.cpp" "CMakeFiles/openttd_lib.dir/src/random_access_file.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/random_access_file.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/random_access_file.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/random_access_file.cpp.o.d"
+  "/root/repo/src/road.cpp" "CMakeFiles/openttd_lib.dir/src/road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road.cpp.o.d"
+  "/root/repo/src/road_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/road_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/road_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_cmd.cpp.o.d"
+  "/root/repo/src/road_gui.cpp" "CMakeFiles/openttd_lib.dir/src/road_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/road_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_gui.cpp.o.d"
+  "/root/repo/src/road_map.cpp" "CMakeFiles/openttd_lib.dir/src/road_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/road_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/road_map.cpp.o.d"
+  "/root/repo/src/roadstop.cpp" "CMakeFiles/openttd_lib.dir/src/roadstop.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadstop.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/roadstop.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadstop.cpp.o.d"
+  "/root/repo/src/roadveh_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/roadveh_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadveh_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/roadveh_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadveh_cmd.cpp.o.d"
+  "/root/repo/src/roadveh_gui.cpp" "CMakeFiles/openttd_lib.dir/src/roadveh_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadveh_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/roadveh_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/roadveh_gui.cpp.o.d"
+  "/root/repo/src/saveload/afterload.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/afterload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/afterload.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/afterload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/afterload.cpp.o.d"
+  "/root/repo/src/saveload/ai_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/ai_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/ai_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/ai_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/ai_sl.cpp.o.d"
+  "/root/repo/src/saveload/airport_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/airport_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/airport_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/airport_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/airport_sl.cpp.o.d"
+  "/root/repo/src/saveload/animated_tile_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/animated_tile_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/animated_tile_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/animated_tile_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/animated_tile_sl.cpp.o.d"
+  "/root/repo/src/saveload/autoreplace_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/autoreplace_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/autoreplace_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/autoreplace_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/autoreplace_sl.cpp.o.d"
+  "/root/repo/src/saveload/cargomonitor_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/cargomonitor_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cargomonitor_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/cargomonitor_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cargomonitor_sl.cpp.o.d"
+  "/root/repo/src/saveload/cargopacket_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/cargopacket_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cargopacket_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/cargopacket_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cargopacket_sl.cpp.o.d"
+  "/root/repo/src/saveload/cheat_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/cheat_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cheat_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/cheat_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/cheat_sl.cpp.o.d"
+  "/root/repo/src/saveload/company_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/company_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/company_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/company_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/company_sl.cpp.o.d"
+  "/root/repo/src/saveload/depot_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/depot_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/depot_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/depot_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/depot_sl.cpp.o.d"
+  "/root/repo/src/saveload/economy_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/economy_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/economy_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/economy_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/economy_sl.cpp.o.d"
+  "/root/repo/src/saveload/engine_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/engine_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/engine_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/engine_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/engine_sl.cpp.o.d"
+  "/root/repo/src/saveload/game_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/game_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/game_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/game_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/game_sl.cpp.o.d"
+  "/root/repo/src/saveload/gamelog_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/gamelog_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/gamelog_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/gamelog_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/gamelog_sl.cpp.o.d"
+  "/root/repo/src/saveload/goal_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/goal_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/goal_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/goal_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/goal_sl.cpp.o.d"
+  "/root/repo/src/saveload/group_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/group_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/group_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/group_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/group_sl.cpp.o.d"
+  "/root/repo/src/saveload/industry_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/industry_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/industry_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/industry_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/industry_sl.cpp.o.d"
+  "/root/repo/src/saveload/labelmaps_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/labelmaps_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/labelmaps_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/labelmaps_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/labelmaps_sl.cpp.o.d"
+  "/root/repo/src/saveload/league_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/league_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/league_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/league_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/league_sl.cpp.o.d"
+  "/root/repo/src/saveload/linkgraph_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/linkgraph_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/linkgraph_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/linkgraph_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/linkgraph_sl.cpp.o.d"
+  "/root/repo/src/saveload/map_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/map_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/map_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/map_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/map_sl.cpp.o.d"
+  "/root/repo/src/saveload/misc_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/misc_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/misc_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/misc_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/misc_sl.cpp.o.d"
+  "/root/repo/src/saveload/newgrf_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/newgrf_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/newgrf_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/newgrf_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/newgrf_sl.cpp.o.d"
+  "/root/repo/src/saveload/object_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/object_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/object_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/object_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/object_sl.cpp.o.d"
+  "/root/repo/src/saveload/oldloader.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader.cpp.o.d"
+  "/root/repo/src/saveload/oldloader_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/oldloader_sl.cpp.o.d"
+  "/root/repo/src/saveload/order_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/order_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/order_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/order_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/order_sl.cpp.o.d"
+  "/root/repo/src/saveload/randomizer_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/randomizer_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/randomizer_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/randomizer_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/randomizer_sl.cpp.o.d"
+  "/root/repo/src/saveload/saveload.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/saveload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/saveload.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/saveload.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/saveload.cpp.o.d"
+  "/root/repo/src/saveload/settings_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/settings_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/settings_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/settings_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/settings_sl.cpp.o.d"
+  "/root/repo/src/saveload/signs_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/signs_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/signs_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/signs_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/signs_sl.cpp.o.d"
+  "/root/repo/src/saveload/station_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/station_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/station_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/station_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/station_sl.cpp.o.d"
+  "/root/repo/src/saveload/storage_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/storage_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/storage_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/storage_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/storage_sl.cpp.o.d"
+  "/root/repo/src/saveload/story_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/story_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/story_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/story_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/story_sl.cpp.o.d"
+  "/root/repo/src/saveload/strings_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/strings_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/strings_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/strings_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/strings_sl.cpp.o.d"
+  "/root/repo/src/saveload/subsidy_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/subsidy_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/subsidy_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/subsidy_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/subsidy_sl.cpp.o.d"
+  "/root/repo/src/saveload/town_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/town_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/town_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/town_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/town_sl.cpp.o.d"
+  "/root/repo/src/saveload/vehicle_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/vehicle_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/vehicle_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/vehicle_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/vehicle_sl.cpp.o.d"
+  "/root/repo/src/saveload/water_regions_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/water_regions_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/water_regions_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/water_regions_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/water_regions_sl.cpp.o.d"
+  "/root/repo/src/saveload/waypoint_sl.cpp" "CMakeFiles/openttd_lib.dir/src/saveload/waypoint_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/waypoint_sl.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/saveload/waypoint_sl.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/saveload/waypoint_sl.cpp.o.d"
+  "/root/repo/src/screenshot.cpp" "CMakeFiles/openttd_lib.dir/src/screenshot.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/screenshot.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/screenshot.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/screenshot.cpp.o.d"
+  "/root/repo/src/screenshot_gui.cpp" "CMakeFiles/openttd_lib.dir/src/screenshot_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/screenshot_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/screenshot_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/screenshot_gui.cpp.o.d"
+  "/root/repo/src/script/api/script_accounting.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_accounting.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_accounting.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_accounting.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_accounting.cpp.o.d"
+  "/root/repo/src/script/api/script_admin.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_admin.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_admin.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_admin.cpp.o.d"
+  "/root/repo/src/script/api/script_airport.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_airport.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_airport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_airport.cpp.o.d"
+  "/root/repo/src/script/api/script_asyncmode.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_asyncmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_asyncmode.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_asyncmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_asyncmode.cpp.o.d"
+  "/root/repo/src/script/api/script_base.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_base.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_base.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_base.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_base.cpp.o.d"
+  "/root/repo/src/script/api/script_basestation.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_basestation.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_basestation.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_basestation.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_basestation.cpp.o.d"
+  "/root/repo/src/script/api/script_bridge.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridge.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridge.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridge.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridge.cpp.o.d"
+  "/root/repo/src/script/api/script_bridgelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridgelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridgelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridgelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_bridgelist.cpp.o.d"
+  "/root/repo/src/script/api/script_cargo.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargo.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargo.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargo.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargo.cpp.o.d"
+  "/root/repo/src/script/api/script_cargolist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargolist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargolist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargolist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargolist.cpp.o.d"
+  "/root/repo/src/script/api/script_cargomonitor.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargomonitor.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargomonitor.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargomonitor.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_cargomonitor.cpp.o.d"
+  "/root/repo/src/script/api/script_client.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_client.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_client.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_client.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_client.cpp.o.d"
+  "/root/repo/src/script/api/script_clientlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_clientlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_clientlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_clientlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_clientlist.cpp.o.d"
+  "/root/repo/src/script/api/script_company.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_company.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_company.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_company.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_company.cpp.o.d"
+  "/root/repo/src/script/api/script_companymode.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_companymode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_companymode.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_companymode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_companymode.cpp.o.d"
+  "/root/repo/src/script/api/script_controller.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_controller.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_controller.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_controller.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_controller.cpp.o.d"
+  "/root/repo/src/script/api/script_date.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_date.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_date.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_date.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_date.cpp.o.d"
+  "/root/repo/src/script/api/script_depotlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_depotlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_depotlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_depotlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_depotlist.cpp.o.d"
+  "/root/repo/src/script/api/script_engine.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_engine.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_engine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_engine.cpp.o.d"
+  "/root/repo/src/script/api/script_enginelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_enginelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_enginelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_enginelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_enginelist.cpp.o.d"
+  "/root/repo/src/script/api/script_error.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_error.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_error.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_error.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_error.cpp.o.d"
+  "/root/repo/src/script/api/script_event.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_event.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_event.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_event.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_event.cpp.o.d"
+  "/root/repo/src/script/api/script_event_types.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_event_types.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_event_types.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_event_types.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_event_types.cpp.o.d"
+  "/root/repo/src/script/api/script_execmode.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_execmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_execmode.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_execmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_execmode.cpp.o.d"
+  "/root/repo/src/script/api/script_game.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_game.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_game.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_game.cpp.o.d"
+  "/root/repo/src/script/api/script_gamesettings.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_gamesettings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_gamesettings.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_gamesettings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_gamesettings.cpp.o.d"
+  "/root/repo/src/script/api/script_goal.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_goal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_goal.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_goal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_goal.cpp.o.d"
+  "/root/repo/src/script/api/script_group.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_group.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_group.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_group.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_group.cpp.o.d"
+  "/root/repo/src/script/api/script_grouplist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_grouplist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_grouplist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_grouplist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_grouplist.cpp.o.d"
+  "/root/repo/src/script/api/script_industry.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_industry.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industry.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_industry.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industry.cpp.o.d"
+  "/root/repo/src/script/api/script_industrylist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrylist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrylist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrylist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrylist.cpp.o.d"
+  "/root/repo/src/script/api/script_industrytype.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytype.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytype.cpp.o.d"
+  "/root/repo/src/script/api/script_industrytypelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytypelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_industrytypelist.cpp.o.d"
+  "/root/repo/src/script/api/script_infrastructure.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_infrastructure.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_infrastructure.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_infrastructure.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_infrastructure.cpp.o.d"
+  "/root/repo/src/script/api/script_league.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_league.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_league.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_league.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_league.cpp.o.d"
+  "/root/repo/src/script/api/script_list.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_list.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_list.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_list.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_list.cpp.o.d"
+  "/root/repo/src/script/api/script_log.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_log.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_log.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_log.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_log.cpp.o.d"
+  "/root/repo/src/script/api/script_map.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_map.cpp.o.d"
+  "/root/repo/src/script/api/script_marine.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_marine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_marine.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_marine.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_marine.cpp.o.d"
+  "/root/repo/src/script/api/script_newgrf.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_newgrf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_newgrf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_newgrf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_newgrf.cpp.o.d"
+  "/root/repo/src/script/api/script_news.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_news.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_news.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_news.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_news.cpp.o.d"
+  "/root/repo/src/script/api/script_object.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_object.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_object.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_object.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_object.cpp.o.d"
+  "/root/repo/src/script/api/script_objecttype.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttype.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttype.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttype.cpp.o.d"
+  "/root/repo/src/script/api/script_objecttypelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttypelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_objecttypelist.cpp.o.d"
+  "/root/repo/src/script/api/script_order.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_order.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_order.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_order.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_order.cpp.o.d"
+  "/root/repo/src/script/api/script_priorityqueue.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_priorityqueue.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_priorityqueue.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_priorityqueue.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_priorityqueue.cpp.o.d"
+  "/root/repo/src/script/api/script_rail.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_rail.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_rail.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_rail.cpp.o.d"
+  "/root/repo/src/script/api/script_railtypelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_railtypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_railtypelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_railtypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_railtypelist.cpp.o.d"
+  "/root/repo/src/script/api/script_road.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_road.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_road.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_road.cpp.o.d"
+  "/root/repo/src/script/api/script_roadtypelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_roadtypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_roadtypelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_roadtypelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_roadtypelist.cpp.o.d"
+  "/root/repo/src/script/api/script_sign.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_sign.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_sign.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_sign.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_sign.cpp.o.d"
+  "/root/repo/src/script/api/script_signlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_signlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_signlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_signlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_signlist.cpp.o.d"
+  "/root/repo/src/script/api/script_station.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_station.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_station.cpp.o.d"
+  "/root/repo/src/script/api/script_stationlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_stationlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_stationlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_stationlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_stationlist.cpp.o.d"
+  "/root/repo/src/script/api/script_story_page.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_story_page.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_story_page.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_story_page.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_story_page.cpp.o.d"
+  "/root/repo/src/script/api/script_storypageelementlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypageelementlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypageelementlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypageelementlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypageelementlist.cpp.o.d"
+  "/root/repo/src/script/api/script_storypagelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypagelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypagelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypagelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_storypagelist.cpp.o.d"
+  "/root/repo/src/script/api/script_subsidy.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidy.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidy.cpp.o.d"
+  "/root/repo/src/script/api/script_subsidylist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidylist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidylist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidylist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_subsidylist.cpp.o.d"
+  "/root/repo/src/script/api/script_testmode.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_testmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_testmode.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_testmode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_testmode.cpp.o.d"
+  "/root/repo/src/script/api/script_text.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_text.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_text.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_text.cpp.o.d"
+  "/root/repo/src/script/api/script_tile.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_tile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tile.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_tile.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tile.cpp.o.d"
+  "/root/repo/src/script/api/script_tilelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_tilelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tilelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_tilelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tilelist.cpp.o.d"
+  "/root/repo/src/script/api/script_timemode.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_timemode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_timemode.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_timemode.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_timemode.cpp.o.d"
+  "/root/repo/src/script/api/script_town.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_town.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_town.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_town.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_town.cpp.o.d"
+  "/root/repo/src/script/api/script_townlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_townlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_townlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_townlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_townlist.cpp.o.d"
+  "/root/repo/src/script/api/script_tunnel.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_tunnel.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tunnel.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_tunnel.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_tunnel.cpp.o.d"
+  "/root/repo/src/script/api/script_vehicle.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehicle.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehicle.cpp.o.d"
+  "/root/repo/src/script/api/script_vehiclelist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehiclelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehiclelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehiclelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_vehiclelist.cpp.o.d"
+  "/root/repo/src/script/api/script_viewport.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_viewport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_viewport.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_viewport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_viewport.cpp.o.d"
+  "/root/repo/src/script/api/script_waypoint.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypoint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypoint.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypoint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypoint.cpp.o.d"
+  "/root/repo/src/script/api/script_waypointlist.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypointlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypointlist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypointlist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_waypointlist.cpp.o.d"
+  "/root/repo/src/script/api/script_window.cpp" "CMakeFiles/openttd_lib.dir/src/script/api/script_window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_window.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/api/script_window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/api/script_window.cpp.o.d"
+  "/root/repo/src/script/script_config.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_config.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_config.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_config.cpp.o.d"
+  "/root/repo/src/script/script_gui.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_gui.cpp.o.d"
+  "/root/repo/src/script/script_info.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_info.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_info.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_info.cpp.o.d"
+  "/root/repo/src/script/script_info_dummy.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_info_dummy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_info_dummy.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_info_dummy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_info_dummy.cpp.o.d"
+  "/root/repo/src/script/script_instance.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_instance.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_instance.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_instance.cpp.o.d"
+  "/root/repo/src/script/script_scanner.cpp" "CMakeFiles/openttd_lib.dir/src/script/script_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_scanner.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/script_scanner.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/script_scanner.cpp.o.d"
+  "/root/repo/src/script/squirrel.cpp" "CMakeFiles/openttd_lib.dir/src/script/squirrel.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/squirrel.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/squirrel.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/squirrel.cpp.o.d"
+  "/root/repo/src/script/squirrel_std.cpp" "CMakeFiles/openttd_lib.dir/src/script/squirrel_std.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/squirrel_std.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/script/squirrel_std.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/script/squirrel_std.cpp.o.d"
+  "/root/repo/src/settings.cpp" "CMakeFiles/openttd_lib.dir/src/settings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/settings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings.cpp.o.d"
+  "/root/repo/src/settings_gui.cpp" "CMakeFiles/openttd_lib.dir/src/settings_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/settings_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings_gui.cpp.o.d"
+  "/root/repo/src/settings_table.cpp" "CMakeFiles/openttd_lib.dir/src/settings_table.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings_table.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/settings_table.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/settings_table.cpp.o.d"
+  "/root/repo/src/ship_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/ship_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ship_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ship_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ship_cmd.cpp.o.d"
+  "/root/repo/src/ship_gui.cpp" "CMakeFiles/openttd_lib.dir/src/ship_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ship_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/ship_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/ship_gui.cpp.o.d"
+  "/root/repo/src/signal.cpp" "CMakeFiles/openttd_lib.dir/src/signal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signal.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/signal.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signal.cpp.o.d"
+  "/root/repo/src/signature.cpp" "CMakeFiles/openttd_lib.dir/src/signature.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signature.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/signature.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signature.cpp.o.d"
+  "/root/repo/src/signs.cpp" "CMakeFiles/openttd_lib.dir/src/signs.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/signs.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs.cpp.o.d"
+  "/root/repo/src/signs_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/signs_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/signs_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs_cmd.cpp.o.d"
+  "/root/repo/src/signs_gui.cpp" "CMakeFiles/openttd_lib.dir/src/signs_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/signs_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/signs_gui.cpp.o.d"
+  "/root/repo/src/smallmap_gui.cpp" "CMakeFiles/openttd_lib.dir/src/smallmap_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/smallmap_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/smallmap_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/smallmap_gui.cpp.o.d"
+  "/root/repo/src/social_integration.cpp" "CMakeFiles/openttd_lib.dir/src/social_integration.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/social_integration.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/social_integration.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/social_integration.cpp.o.d"
+  "/root/repo/src/sound.cpp" "CMakeFiles/openttd_lib.dir/src/sound.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sound.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/sound.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sound.cpp.o.d"
+  "/root/repo/src/sound/null_s.cpp" "CMakeFiles/openttd_lib.dir/src/sound/null_s.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sound/null_s.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/sound/null_s.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sound/null_s.cpp.o.d"
+  "/root/repo/src/sprite.cpp" "CMakeFiles/openttd_lib.dir/src/sprite.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sprite.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/sprite.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/sprite.cpp.o.d"
+  "/root/repo/src/spritecache.cpp" "CMakeFiles/openttd_lib.dir/src/spritecache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spritecache.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/spritecache.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spritecache.cpp.o.d"
+  "/root/repo/src/spriteloader/grf.cpp" "CMakeFiles/openttd_lib.dir/src/spriteloader/grf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spriteloader/grf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/spriteloader/grf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spriteloader/grf.cpp.o.d"
+  "/root/repo/src/spriteloader/sprite_file.cpp" "CMakeFiles/openttd_lib.dir/src/spriteloader/sprite_file.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spriteloader/sprite_file.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/spriteloader/sprite_file.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/spriteloader/sprite_file.cpp.o.d"
+  "/root/repo/src/station.cpp" "CMakeFiles/openttd_lib.dir/src/station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/station.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station.cpp.o.d"
+  "/root/repo/src/station_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/station_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/station_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station_cmd.cpp.o.d"
+  "/root/repo/src/station_gui.cpp" "CMakeFiles/openttd_lib.dir/src/station_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/station_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/station_gui.cpp.o.d"
+  "/root/repo/src/statusbar_gui.cpp" "CMakeFiles/openttd_lib.dir/src/statusbar_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/statusbar_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/statusbar_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/statusbar_gui.cpp.o.d"
+  "/root/repo/src/story.cpp" "CMakeFiles/openttd_lib.dir/src/story.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/story.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/story.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/story.cpp.o.d"
+  "/root/repo/src/story_gui.cpp" "CMakeFiles/openttd_lib.dir/src/story_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/story_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/story_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/story_gui.cpp.o.d"
+  "/root/repo/src/strgen/strgen_base.cpp" "CMakeFiles/openttd_lib.dir/src/strgen/strgen_base.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/strgen/strgen_base.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/strgen/strgen_base.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/strgen/strgen_base.cpp.o.d"
+  "/root/repo/src/string.cpp" "CMakeFiles/openttd_lib.dir/src/string.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/string.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/string.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/string.cpp.o.d"
+  "/root/repo/src/stringfilter.cpp" "CMakeFiles/openttd_lib.dir/src/stringfilter.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/stringfilter.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/stringfilter.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/stringfilter.cpp.o.d"
+  "/root/repo/src/strings.cpp" "CMakeFiles/openttd_lib.dir/src/strings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/strings.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/strings.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/strings.cpp.o.d"
+  "/root/repo/src/subsidy.cpp" "CMakeFiles/openttd_lib.dir/src/subsidy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/subsidy.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/subsidy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/subsidy.cpp.o.d"
+  "/root/repo/src/subsidy_gui.cpp" "CMakeFiles/openttd_lib.dir/src/subsidy_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/subsidy_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/subsidy_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/subsidy_gui.cpp.o.d"
+  "/root/repo/src/survey.cpp" "CMakeFiles/openttd_lib.dir/src/survey.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/survey.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/survey.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/survey.cpp.o.d"
+  "/root/repo/src/terraform_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/terraform_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/terraform_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/terraform_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/terraform_cmd.cpp.o.d"
+  "/root/repo/src/terraform_gui.cpp" "CMakeFiles/openttd_lib.dir/src/terraform_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/terraform_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/terraform_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/terraform_gui.cpp.o.d"
+  "/root/repo/src/textbuf.cpp" "CMakeFiles/openttd_lib.dir/src/textbuf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/textbuf.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/textbuf.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/textbuf.cpp.o.d"
+  "/root/repo/src/texteff.cpp" "CMakeFiles/openttd_lib.dir/src/texteff.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/texteff.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/texteff.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/texteff.cpp.o.d"
+  "/root/repo/src/textfile_gui.cpp" "CMakeFiles/openttd_lib.dir/src/textfile_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/textfile_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/textfile_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/textfile_gui.cpp.o.d"
+  "/root/repo/src/tgp.cpp" "CMakeFiles/openttd_lib.dir/src/tgp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tgp.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tgp.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tgp.cpp.o.d"
+  "/root/repo/src/thread.cpp" "CMakeFiles/openttd_lib.dir/src/thread.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/thread.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/thread.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/thread.cpp.o.d"
+  "/root/repo/src/tile_map.cpp" "CMakeFiles/openttd_lib.dir/src/tile_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tile_map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tile_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tile_map.cpp.o.d"
+  "/root/repo/src/tilearea.cpp" "CMakeFiles/openttd_lib.dir/src/tilearea.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tilearea.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tilearea.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tilearea.cpp.o.d"
+  "/root/repo/src/timer/timer_game_calendar.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_calendar.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_calendar.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_calendar.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_calendar.cpp.o.d"
+  "/root/repo/src/timer/timer_game_common.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_common.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_common.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_common.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_common.cpp.o.d"
+  "/root/repo/src/timer/timer_game_economy.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_economy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_economy.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_economy.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_economy.cpp.o.d"
+  "/root/repo/src/timer/timer_game_realtime.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_realtime.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_realtime.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_realtime.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_realtime.cpp.o.d"
+  "/root/repo/src/timer/timer_game_tick.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_tick.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_tick.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_tick.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_game_tick.cpp.o.d"
+  "/root/repo/src/timer/timer_window.cpp" "CMakeFiles/openttd_lib.dir/src/timer/timer_window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_window.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timer/timer_window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timer/timer_window.cpp.o.d"
+  "/root/repo/src/timetable_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/timetable_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timetable_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timetable_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timetable_cmd.cpp.o.d"
+  "/root/repo/src/timetable_gui.cpp" "CMakeFiles/openttd_lib.dir/src/timetable_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timetable_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/timetable_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/timetable_gui.cpp.o.d"
+  "/root/repo/src/toolbar_gui.cpp" "CMakeFiles/openttd_lib.dir/src/toolbar_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/toolbar_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/toolbar_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/toolbar_gui.cpp.o.d"
+  "/root/repo/src/town_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/town_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/town_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/town_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/town_cmd.cpp.o.d"
+  "/root/repo/src/town_gui.cpp" "CMakeFiles/openttd_lib.dir/src/town_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/town_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/town_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/town_gui.cpp.o.d"
+  "/root/repo/src/townname.cpp" "CMakeFiles/openttd_lib.dir/src/townname.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/townname.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/townname.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/townname.cpp.o.d"
+  "/root/repo/src/train_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/train_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/train_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/train_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/train_cmd.cpp.o.d"
+  "/root/repo/src/train_gui.cpp" "CMakeFiles/openttd_lib.dir/src/train_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/train_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/train_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/train_gui.cpp.o.d"
+  "/root/repo/src/transparency_gui.cpp" "CMakeFiles/openttd_lib.dir/src/transparency_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/transparency_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/transparency_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/transparency_gui.cpp.o.d"
+  "/root/repo/src/tree_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/tree_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tree_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tree_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tree_cmd.cpp.o.d"
+  "/root/repo/src/tree_gui.cpp" "CMakeFiles/openttd_lib.dir/src/tree_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tree_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tree_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tree_gui.cpp.o.d"
+  "/root/repo/src/tunnel_map.cpp" "CMakeFiles/openttd_lib.dir/src/tunnel_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tunnel_map.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tunnel_map.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tunnel_map.cpp.o.d"
+  "/root/repo/src/tunnelbridge_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/tunnelbridge_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tunnelbridge_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/tunnelbridge_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/tunnelbridge_cmd.cpp.o.d"
+  "/root/repo/src/vehicle.cpp" "CMakeFiles/openttd_lib.dir/src/vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/vehicle.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle.cpp.o.d"
+  "/root/repo/src/vehicle_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/vehicle_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/vehicle_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle_cmd.cpp.o.d"
+  "/root/repo/src/vehicle_gui.cpp" "CMakeFiles/openttd_lib.dir/src/vehicle_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/vehicle_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehicle_gui.cpp.o.d"
+  "/root/repo/src/vehiclelist.cpp" "CMakeFiles/openttd_lib.dir/src/vehiclelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehiclelist.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/vehiclelist.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/vehiclelist.cpp.o.d"
+  "/root/repo/src/video/dedicated_v.cpp" "CMakeFiles/openttd_lib.dir/src/video/dedicated_v.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/dedicated_v.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/video/dedicated_v.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/dedicated_v.cpp.o.d"
+  "/root/repo/src/video/null_v.cpp" "CMakeFiles/openttd_lib.dir/src/video/null_v.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/null_v.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/video/null_v.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/null_v.cpp.o.d"
+  "/root/repo/src/video/video_driver.cpp" "CMakeFiles/openttd_lib.dir/src/video/video_driver.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/video_driver.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/video/video_driver.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/video/video_driver.cpp.o.d"
+  "/root/repo/src/viewport.cpp" "CMakeFiles/openttd_lib.dir/src/viewport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/viewport.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport.cpp.o.d"
+  "/root/repo/src/viewport_gui.cpp" "CMakeFiles/openttd_lib.dir/src/viewport_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/viewport_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport_gui.cpp.o.d"
+  "/root/repo/src/viewport_sprite_sorter_sse4.cpp" "CMakeFiles/openttd_lib.dir/src/viewport_sprite_sorter_sse4.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport_sprite_sorter_sse4.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/viewport_sprite_sorter_sse4.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/viewport_sprite_sorter_sse4.cpp.o.d"
+  "/root/repo/src/void_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/void_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/void_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/void_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/void_cmd.cpp.o.d"
+  "/root/repo/src/water_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/water_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/water_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/water_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/water_cmd.cpp.o.d"
+  "/root/repo/src/waypoint.cpp" "CMakeFiles/openttd_lib.dir/src/waypoint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/waypoint.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint.cpp.o.d"
+  "/root/repo/src/waypoint_cmd.cpp" "CMakeFiles/openttd_lib.dir/src/waypoint_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint_cmd.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/waypoint_cmd.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint_cmd.cpp.o.d"
+  "/root/repo/src/waypoint_gui.cpp" "CMakeFiles/openttd_lib.dir/src/waypoint_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint_gui.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/waypoint_gui.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/waypoint_gui.cpp.o.d"
+  "/root/repo/src/widget.cpp" "CMakeFiles/openttd_lib.dir/src/widget.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widget.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/widget.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widget.cpp.o.d"
+  "/root/repo/src/widgets/dropdown.cpp" "CMakeFiles/openttd_lib.dir/src/widgets/dropdown.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widgets/dropdown.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/widgets/dropdown.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widgets/dropdown.cpp.o.d"
+  "/root/repo/src/widgets/slider.cpp" "CMakeFiles/openttd_lib.dir/src/widgets/slider.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widgets/slider.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/widgets/slider.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/widgets/slider.cpp.o.d"
+  "/root/repo/src/window.cpp" "CMakeFiles/openttd_lib.dir/src/window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/window.cpp.o.d"
+  "/root/repo/_ded_build/CMakeFiles/openttd_lib.dir/cmake_pch.hxx" "CMakeFiles/openttd_lib.dir/src/window.cpp.o" "gcc" "CMakeFiles/openttd_lib.dir/src/window.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,7 @@
+/* generated by CMake */
+
+#pragma GCC system_header
+#ifdef __cplusplus
+#include "/root/repo/src/stdafx.h"
+#include "/root/repo/src/core/format.hpp"
+#endif // __cplusplus
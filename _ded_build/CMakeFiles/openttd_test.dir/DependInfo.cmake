@@ -0,0 +1,29 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tests/bitmath_func.cpp" "CMakeFiles/openttd_test.dir/src/tests/bitmath_func.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/bitmath_func.cpp.o.d"
+  "/root/repo/src/tests/landscape_partial_pixel_z.cpp" "CMakeFiles/openttd_test.dir/src/tests/landscape_partial_pixel_z.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/landscape_partial_pixel_z.cpp.o.d"
+  "/root/repo/src/tests/math_func.cpp" "CMakeFiles/openttd_test.dir/src/tests/math_func.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/math_func.cpp.o.d"
+  "/root/repo/src/tests/mock_spritecache.cpp" "CMakeFiles/openttd_test.dir/src/tests/mock_spritecache.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/mock_spritecache.cpp.o.d"
+  "/root/repo/src/tests/parallel_for.cpp" "CMakeFiles/openttd_test.dir/src/tests/parallel_for.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/parallel_for.cpp.o.d"
+  "/root/repo/src/tests/string_func.cpp" "CMakeFiles/openttd_test.dir/src/tests/string_func.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/string_func.cpp.o.d"
+  "/root/repo/src/tests/strings_func.cpp" "CMakeFiles/openttd_test.dir/src/tests/strings_func.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/strings_func.cpp.o.d"
+  "/root/repo/src/tests/test_main.cpp" "CMakeFiles/openttd_test.dir/src/tests/test_main.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/test_main.cpp.o.d"
+  "/root/repo/src/tests/test_script_admin.cpp" "CMakeFiles/openttd_test.dir/src/tests/test_script_admin.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/test_script_admin.cpp.o.d"
+  "/root/repo/src/tests/test_window_desc.cpp" "CMakeFiles/openttd_test.dir/src/tests/test_window_desc.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/test_window_desc.cpp.o.d"
+  "/root/repo/src/tests/yapf_nodelist.cpp" "CMakeFiles/openttd_test.dir/src/tests/yapf_nodelist.cpp.o" "gcc" "CMakeFiles/openttd_test.dir/src/tests/yapf_nodelist.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
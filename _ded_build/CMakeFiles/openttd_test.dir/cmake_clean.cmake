@@ -0,0 +1,32 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openttd_test.dir/src/tests/bitmath_func.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/bitmath_func.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/landscape_partial_pixel_z.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/landscape_partial_pixel_z.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/math_func.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/math_func.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/mock_spritecache.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/mock_spritecache.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/parallel_for.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/parallel_for.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/string_func.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/string_func.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/strings_func.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/strings_func.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/test_main.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/test_main.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/test_script_admin.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/test_script_admin.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/test_window_desc.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/test_window_desc.cpp.o.d"
+  "CMakeFiles/openttd_test.dir/src/tests/yapf_nodelist.cpp.o"
+  "CMakeFiles/openttd_test.dir/src/tests/yapf_nodelist.cpp.o.d"
+  "openttd_test"
+  "openttd_test.pdb"
+  "openttd_test_tests-b12d07c.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openttd_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
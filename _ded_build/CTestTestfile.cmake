@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_ded_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+include("/root/repo/_ded_build/openttd_test_include-b12d07c.cmake")
+subdirs("bin")
+subdirs("src")
+subdirs("media")
+subdirs("regression")
@@ -0,0 +1,2 @@
+print("  Required this file");
+
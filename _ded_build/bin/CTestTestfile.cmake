@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/bin
+# Build directory: /root/repo/_ded_build/bin
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ai")
+subdirs("game")
+subdirs("data")
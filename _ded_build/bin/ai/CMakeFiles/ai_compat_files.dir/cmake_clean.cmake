@@ -0,0 +1,24 @@
+file(REMOVE_RECURSE
+  "../../ai/compat_0.7.nut"
+  "../../ai/compat_1.0.nut"
+  "../../ai/compat_1.1.nut"
+  "../../ai/compat_1.10.nut"
+  "../../ai/compat_1.11.nut"
+  "../../ai/compat_1.2.nut"
+  "../../ai/compat_1.3.nut"
+  "../../ai/compat_1.4.nut"
+  "../../ai/compat_1.5.nut"
+  "../../ai/compat_1.6.nut"
+  "../../ai/compat_1.7.nut"
+  "../../ai/compat_1.8.nut"
+  "../../ai/compat_1.9.nut"
+  "../../ai/compat_12.nut"
+  "../../ai/compat_13.nut"
+  "../../ai/compat_14.nut"
+  "CMakeFiles/ai_compat_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ai_compat_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
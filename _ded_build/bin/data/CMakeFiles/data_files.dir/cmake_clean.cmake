@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "../../data/cmclient-5.grf"
+  "CMakeFiles/data_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/data_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../game/compat_1.10.nut"
+  "../../game/compat_1.11.nut"
+  "../../game/compat_1.2.nut"
+  "../../game/compat_1.3.nut"
+  "../../game/compat_1.4.nut"
+  "../../game/compat_1.5.nut"
+  "../../game/compat_1.6.nut"
+  "../../game/compat_1.7.nut"
+  "../../game/compat_1.8.nut"
+  "../../game/compat_1.9.nut"
+  "../../game/compat_12.nut"
+  "../../game/compat_13.nut"
+  "../../game/compat_14.nut"
+  "CMakeFiles/gs_compat_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gs_compat_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
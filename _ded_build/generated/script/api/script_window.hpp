@@ -0,0 +1,995 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file script_window.hpp Everything to handle window interaction. */
+
+#ifndef SCRIPT_WINDOW_HPP
+#define SCRIPT_WINDOW_HPP
+
+#include "script_object.hpp"
+
+#include "../../window_type.h"
+#include "../../widgets/ai_widget.h"
+#include "../../widgets/airport_widget.h"
+#include "../../widgets/autoreplace_widget.h"
+#include "../../widgets/bootstrap_widget.h"
+#include "../../widgets/bridge_widget.h"
+#include "../../widgets/build_vehicle_widget.h"
+#include "../../widgets/cargo_table_widget.h"
+#include "../../widgets/cheat_widget.h"
+#include "../../widgets/company_widget.h"
+#include "../../widgets/console_widget.h"
+#include "../../widgets/date_widget.h"
+#include "../../widgets/depot_widget.h"
+#include "../../widgets/dock_widget.h"
+#include "../../widgets/dropdown_widget.h"
+#include "../../widgets/engine_widget.h"
+#include "../../widgets/error_widget.h"
+#include "../../widgets/fios_widget.h"
+#include "../../widgets/framerate_widget.h"
+#include "../../widgets/game_widget.h"
+#include "../../widgets/genworld_widget.h"
+#include "../../widgets/goal_widget.h"
+#include "../../widgets/graph_widget.h"
+#include "../../widgets/group_widget.h"
+#include "../../widgets/help_widget.h"
+#include "../../widgets/highscore_widget.h"
+#include "../../widgets/industry_widget.h"
+#include "../../widgets/intro_widget.h"
+#include "../../widgets/league_widget.h"
+#include "../../widgets/link_graph_legend_widget.h"
+#include "../../widgets/main_widget.h"
+#include "../../widgets/misc_widget.h"
+#include "../../widgets/music_widget.h"
+#include "../../widgets/network_chat_widget.h"
+#include "../../widgets/network_content_widget.h"
+#include "../../widgets/network_widget.h"
+#include "../../widgets/newgrf_debug_widget.h"
+#include "../../widgets/newgrf_widget.h"
+#include "../../widgets/news_widget.h"
+#include "../../widgets/object_widget.h"
+#include "../../widgets/order_widget.h"
+#include "../../widgets/osk_widget.h"
+#include "../../widgets/rail_widget.h"
+#include "../../widgets/road_widget.h"
+#include "../../widgets/screenshot_widget.h"
+#include "../../widgets/script_widget.h"
+#include "../../widgets/settings_widget.h"
+#include "../../widgets/sign_widget.h"
+#include "../../widgets/smallmap_widget.h"
+#include "../../widgets/station_widget.h"
+#include "../../widgets/statusbar_widget.h"
+#include "../../widgets/story_widget.h"
+#include "../../widgets/subsidy_widget.h"
+#include "../../widgets/terraform_widget.h"
+#include "../../widgets/timetable_widget.h"
+#include "../../widgets/toolbar_widget.h"
+#include "../../widgets/town_widget.h"
+#include "../../widgets/transparency_widget.h"
+#include "../../widgets/tree_widget.h"
+#include "../../widgets/vehicle_widget.h"
+#include "../../widgets/viewport_widget.h"
+#include "../../widgets/waypoint_widget.h"
+
+/**
+ * Class that handles window interaction. A Window in OpenTTD has two important
+ *  values. The WindowClass, and a Window number. The first indicates roughly
+ *  which window it is. WC_TOWN_VIEW for example, is the view of a town.
+ * The Window number is a bit more complex, as it depends mostly on the
+ *  WindowClass. For example for WC_TOWN_VIEW it is the TownID. In general a
+ *  good rule of thumb is: either the number is always 0, or the ID of the
+ *  object in question.
+ * In the comment at the widget enum, it is mentioned how the number is used.
+ *
+ * Note, that the detailed window layout is very version specific.
+ * Enum values might be added, changed or removed in future versions without notice
+ * in the changelog, and there won't be any means of compatibility.
+ *
+ * @api game
+ */
+class ScriptWindow : public ScriptObject {
+public:
+	// @enum WindowNumberEnum ../../window_type.h
+	/* automatically generated from ../../window_type.h */
+	/** %Window numbers. */
+	enum WindowNumberEnum {
+		WN_GAME_OPTIONS_AI                           = ::WN_GAME_OPTIONS_AI,                           ///< AI settings.
+		WN_GAME_OPTIONS_GS                           = ::WN_GAME_OPTIONS_GS,                           ///< GS settings.
+		WN_GAME_OPTIONS_ABOUT                        = ::WN_GAME_OPTIONS_ABOUT,                        ///< About window.
+		WN_GAME_OPTIONS_NEWGRF_STATE                 = ::WN_GAME_OPTIONS_NEWGRF_STATE,                 ///< NewGRF settings.
+		WN_GAME_OPTIONS_GAME_OPTIONS                 = ::WN_GAME_OPTIONS_GAME_OPTIONS,                 ///< Game options.
+		WN_GAME_OPTIONS_GAME_SETTINGS                = ::WN_GAME_OPTIONS_GAME_SETTINGS,                ///< Game settings.
+
+		WN_QUERY_STRING                              = ::WN_QUERY_STRING,                              ///< Query string.
+		WN_QUERY_STRING_SIGN                         = ::WN_QUERY_STRING_SIGN,                         ///< Query string for signs.
+
+		WN_CONFIRM_POPUP_QUERY                       = ::WN_CONFIRM_POPUP_QUERY,                       ///< Query popup confirm.
+		WN_CONFIRM_POPUP_QUERY_BOOTSTRAP             = ::WN_CONFIRM_POPUP_QUERY_BOOTSTRAP,             ///< Query popup confirm for bootstrap.
+
+		WN_NETWORK_WINDOW_GAME                       = ::WN_NETWORK_WINDOW_GAME,                       ///< Network game window.
+		WN_NETWORK_WINDOW_CONTENT_LIST               = ::WN_NETWORK_WINDOW_CONTENT_LIST,               ///< Network content list.
+		WN_NETWORK_WINDOW_START                      = ::WN_NETWORK_WINDOW_START,                      ///< Network start server.
+
+		WN_NETWORK_STATUS_WINDOW_JOIN                = ::WN_NETWORK_STATUS_WINDOW_JOIN,                ///< Network join status.
+		WN_NETWORK_STATUS_WINDOW_CONTENT_DOWNLOAD    = ::WN_NETWORK_STATUS_WINDOW_CONTENT_DOWNLOAD,    ///< Network content download status.
+	};
+
+	// @endenum
+
+	// @enum WindowClass ../../window_type.h
+	/* automatically generated from ../../window_type.h */
+	/** %Window classes. */
+	enum WindowClass {
+		WC_NONE                                      = ::WC_NONE,                                      ///< No window, redirects to WC_MAIN_WINDOW.
+
+		/**
+		 * Main window; %Window numbers:
+		 *   - 0 = #MainWidgets
+		 */
+		WC_MAIN_WINDOW                               = ::WC_MAIN_WINDOW,
+
+		/**
+		 * Main toolbar (the long bar at the top); %Window numbers:
+		 *   - 0 = #ToolbarNormalWidgets
+		 *   - 0 = #ToolbarEditorWidgets
+		 */
+		WC_MAIN_TOOLBAR                              = ::WC_MAIN_TOOLBAR,
+
+		/**
+		 * Statusbar (at the bottom of your screen); %Window numbers:
+		 *   - 0 = #StatusbarWidgets
+		 */
+		WC_STATUS_BAR                                = ::WC_STATUS_BAR,
+
+		/**
+		 * Build toolbar; %Window numbers:
+		 *   - #TRANSPORT_RAIL = #RailToolbarWidgets
+		 *   - #TRANSPORT_AIR = #AirportToolbarWidgets
+		 *   - #TRANSPORT_WATER = #DockToolbarWidgets
+		 *   - #TRANSPORT_ROAD = #RoadToolbarWidgets
+		 */
+		WC_BUILD_TOOLBAR                             = ::WC_BUILD_TOOLBAR,
+
+		/**
+		 * Scenario build toolbar; %Window numbers:
+		 *   - #TRANSPORT_WATER = #DockToolbarWidgets
+		 *   - #TRANSPORT_ROAD = #RoadToolbarWidgets
+		 */
+		WC_SCEN_BUILD_TOOLBAR                        = ::WC_SCEN_BUILD_TOOLBAR,
+
+		/**
+		 * Build trees toolbar; %Window numbers:
+		 *   - 0 = #BuildTreesWidgets
+		 */
+		WC_BUILD_TREES                               = ::WC_BUILD_TREES,
+
+		/**
+		 * Transparency toolbar; %Window numbers:
+		 *   - 0 = #TransparencyToolbarWidgets
+		 */
+		WC_TRANSPARENCY_TOOLBAR                      = ::WC_TRANSPARENCY_TOOLBAR,
+
+		/**
+		 * Build signal toolbar; %Window numbers:
+		 *   - #TRANSPORT_RAIL = #BuildSignalWidgets
+		 */
+		WC_BUILD_SIGNAL                              = ::WC_BUILD_SIGNAL,
+
+		/**
+		 * Small map; %Window numbers:
+		 *   - 0 = #SmallMapWidgets
+		 */
+		WC_SMALLMAP                                  = ::WC_SMALLMAP,
+
+		/**
+		 * Error message; %Window numbers:
+		 *   - 0 = #ErrorMessageWidgets
+		 */
+		WC_ERRMSG                                    = ::WC_ERRMSG,
+
+		/**
+		 * Tooltip window; %Window numbers:
+		 *   - 0 = #ToolTipsWidgets
+		 */
+		WC_TOOLTIPS                                  = ::WC_TOOLTIPS,
+		WC_STATION_RATING_TOOLTIP                    = ::WC_STATION_RATING_TOOLTIP,
+
+		/**
+		 * Query string window; %Window numbers:
+		 *   - #WN_QUERY_STRING = #QueryStringWidgets
+		 *   - #WN_QUERY_STRING_SIGN = #QueryEditSignWidgets
+		 */
+		WC_QUERY_STRING                              = ::WC_QUERY_STRING,
+
+		/**
+		 * Popup with confirm question; %Window numbers:
+		 *   - #WN_CONFIRM_POPUP_QUERY = #QueryWidgets
+		 *   - #WN_CONFIRM_POPUP_QUERY_BOOTSTRAP = #BootstrapAskForDownloadWidgets
+		 */
+		WC_CONFIRM_POPUP_QUERY                       = ::WC_CONFIRM_POPUP_QUERY,
+
+		/**
+		 * Popup with a set of buttons, designed to ask the user a question
+		 *  from a GameScript. %Window numbers:
+		 *   - uniqueid = #GoalQuestionWidgets
+		 */
+		WC_GOAL_QUESTION                             = ::WC_GOAL_QUESTION,
+
+
+		/**
+		 * Saveload window; %Window numbers:
+		 *   - 0 = #SaveLoadWidgets
+		 */
+		WC_SAVELOAD                                  = ::WC_SAVELOAD,
+
+		/**
+		 * Land info window; %Window numbers:
+		 *   - 0 = #LandInfoWidgets
+		 */
+		WC_LAND_INFO                                 = ::WC_LAND_INFO,
+
+		/**
+		 * Drop down menu; %Window numbers:
+		 *   - 0 = #DropdownMenuWidgets
+		 */
+		WC_DROPDOWN_MENU                             = ::WC_DROPDOWN_MENU,
+
+		/**
+		 * On Screen Keyboard; %Window numbers:
+		 *   - 0 = #OnScreenKeyboardWidgets
+		 */
+		WC_OSK                                       = ::WC_OSK,
+
+		/**
+		 * Set date; %Window numbers:
+		 *   - #VehicleID = #SetDateWidgets
+		 */
+		WC_SET_DATE                                  = ::WC_SET_DATE,
+
+
+		/**
+		 * Script settings; %Window numbers:
+		 *   - 0 = #ScriptSettingsWidgets
+		 */
+		WC_SCRIPT_SETTINGS                           = ::WC_SCRIPT_SETTINGS,
+
+		/**
+		 * NewGRF parameters; %Window numbers:
+		 *   - 0 = #NewGRFParametersWidgets
+		 */
+		WC_GRF_PARAMETERS                            = ::WC_GRF_PARAMETERS,
+
+		/**
+		 * textfile; %Window numbers:
+		 *   - 0 = #TextfileWidgets
+		 */
+		WC_TEXTFILE                                  = ::WC_TEXTFILE,
+
+
+		/**
+		 * Town authority; %Window numbers:
+		 *   - #TownID = #TownAuthorityWidgets
+		 */
+		WC_TOWN_AUTHORITY                            = ::WC_TOWN_AUTHORITY,
+
+		/**
+		 * Vehicle details; %Window numbers:
+		 *   - #VehicleID = #VehicleDetailsWidgets
+		 */
+		WC_VEHICLE_DETAILS                           = ::WC_VEHICLE_DETAILS,
+
+		/**
+		 * Vehicle refit; %Window numbers:
+		 *   - #VehicleID = #VehicleRefitWidgets
+		 */
+		WC_VEHICLE_REFIT                             = ::WC_VEHICLE_REFIT,
+
+		/**
+		 * Vehicle orders; %Window numbers:
+		 *   - #VehicleID = #OrderWidgets
+		 */
+		WC_VEHICLE_ORDERS                            = ::WC_VEHICLE_ORDERS,
+
+		/**
+		 * Replace vehicle window; %Window numbers:
+		 *   - #VehicleType = #ReplaceVehicleWidgets
+		 */
+		WC_REPLACE_VEHICLE                           = ::WC_REPLACE_VEHICLE,
+
+		/**
+		 * Vehicle timetable; %Window numbers:
+		 *   - #VehicleID = #VehicleTimetableWidgets
+		 */
+		WC_VEHICLE_TIMETABLE                         = ::WC_VEHICLE_TIMETABLE,
+
+		/**
+		 * Company colour selection; %Window numbers:
+		 *   - #CompanyID = #SelectCompanyLiveryWidgets
+		 */
+		WC_COMPANY_COLOUR                            = ::WC_COMPANY_COLOUR,
+
+		/**
+		 * Alter company face window; %Window numbers:
+		 *   - #CompanyID = #SelectCompanyManagerFaceWidgets
+		 */
+		WC_COMPANY_MANAGER_FACE                      = ::WC_COMPANY_MANAGER_FACE,
+
+		/**
+		 * Select station (when joining stations); %Window numbers:
+		 *   - 0 = #JoinStationWidgets
+		 */
+		WC_SELECT_STATION                            = ::WC_SELECT_STATION,
+
+		/**
+		 * News window; %Window numbers:
+		 *   - 0 = #NewsWidgets
+		 */
+		WC_NEWS_WINDOW                               = ::WC_NEWS_WINDOW,
+
+		/**
+		 * Town directory; %Window numbers:
+		 *   - 0 = #TownDirectoryWidgets
+		 */
+		WC_TOWN_DIRECTORY                            = ::WC_TOWN_DIRECTORY,
+
+		/**
+		 * Subsidies list; %Window numbers:
+		 *   - 0 = #SubsidyListWidgets
+		 */
+		WC_SUBSIDIES_LIST                            = ::WC_SUBSIDIES_LIST,
+
+		/**
+		 * Industry directory; %Window numbers:
+		 *   - 0 = #IndustryDirectoryWidgets
+		 */
+		WC_INDUSTRY_DIRECTORY                        = ::WC_INDUSTRY_DIRECTORY,
+
+		/**
+		 * News history list; %Window numbers:
+		 *   - 0 = #MessageHistoryWidgets
+		 */
+		WC_MESSAGE_HISTORY                           = ::WC_MESSAGE_HISTORY,
+
+		/**
+		 * Sign list; %Window numbers:
+		 *   - 0 = #SignListWidgets
+		 */
+		WC_SIGN_LIST                                 = ::WC_SIGN_LIST,
+
+		/**
+		 * Scripts list; %Window numbers:
+		 *   - 0 = #ScriptListWidgets
+		 */
+		WC_SCRIPT_LIST                               = ::WC_SCRIPT_LIST,
+
+		/**
+		 * Goals list; %Window numbers:
+		 *   - 0 ; #GoalListWidgets
+		 */
+		WC_GOALS_LIST                                = ::WC_GOALS_LIST,
+
+		/**
+		 * Story book; %Window numbers:
+		 *   - CompanyID = #StoryBookWidgets
+		 */
+		WC_STORY_BOOK                                = ::WC_STORY_BOOK,
+
+		/**
+		 * Station list; %Window numbers:
+		 *   - #CompanyID = #StationListWidgets
+		 */
+		WC_STATION_LIST                              = ::WC_STATION_LIST,
+
+		/**
+		 * Trains list; %Window numbers:
+		 *   - Packed value = #GroupListWidgets / #VehicleListWidgets
+		 */
+		WC_TRAINS_LIST                               = ::WC_TRAINS_LIST,
+
+		/**
+		 * Road vehicle list; %Window numbers:
+		 *   - Packed value = #GroupListWidgets / #VehicleListWidgets
+		 */
+		WC_ROADVEH_LIST                              = ::WC_ROADVEH_LIST,
+
+		/**
+		 * Ships list; %Window numbers:
+		 *   - Packed value = #GroupListWidgets / #VehicleListWidgets
+		 */
+		WC_SHIPS_LIST                                = ::WC_SHIPS_LIST,
+
+		/**
+		 * Aircraft list; %Window numbers:
+		 *   - Packed value = #GroupListWidgets / #VehicleListWidgets
+		 */
+		WC_AIRCRAFT_LIST                             = ::WC_AIRCRAFT_LIST,
+
+
+		/**
+		 * Town view; %Window numbers:
+		 *   - #TownID = #TownViewWidgets
+		 */
+		WC_TOWN_VIEW                                 = ::WC_TOWN_VIEW,
+
+		/**
+		 * Vehicle view; %Window numbers:
+		 *   - #VehicleID = #VehicleViewWidgets
+		 */
+		WC_VEHICLE_VIEW                              = ::WC_VEHICLE_VIEW,
+
+		/**
+		 * Station view; %Window numbers:
+		 *   - #StationID = #StationViewWidgets
+		 */
+		WC_STATION_VIEW                              = ::WC_STATION_VIEW,
+
+		/**
+		 * Depot view; %Window numbers:
+		 *   - #TileIndex = #DepotWidgets
+		 */
+		WC_VEHICLE_DEPOT                             = ::WC_VEHICLE_DEPOT,
+
+		/**
+		 * Waypoint view; %Window numbers:
+		 *   - #WaypointID = #WaypointWidgets
+		 */
+		WC_WAYPOINT_VIEW                             = ::WC_WAYPOINT_VIEW,
+
+		/**
+		 * Industry view; %Window numbers:
+		 *   - #IndustryID = #IndustryViewWidgets
+		 */
+		WC_INDUSTRY_VIEW                             = ::WC_INDUSTRY_VIEW,
+
+		/**
+		 * Company view; %Window numbers:
+		 *   - #CompanyID = #CompanyWidgets
+		 */
+		WC_COMPANY                                   = ::WC_COMPANY,
+
+
+		/**
+		 * Build object; %Window numbers:
+		 *   - 0 = #BuildObjectWidgets
+		 */
+		WC_BUILD_OBJECT                              = ::WC_BUILD_OBJECT,
+
+		/* CityMania watch company */
+		WC_WATCH_COMPANY                             = ::WC_WATCH_COMPANY,
+
+		/* CityMania watch company admin version */
+		WC_WATCH_COMPANYA                            = ::WC_WATCH_COMPANYA,
+
+		/**
+		 * Build vehicle; %Window numbers:
+		 *   - #VehicleType = #BuildVehicleWidgets
+		 *   - #TileIndex = #BuildVehicleWidgets
+		 */
+		WC_BUILD_VEHICLE                             = ::WC_BUILD_VEHICLE,
+
+		/**
+		 * Build bridge; %Window numbers:
+		 *   - #TransportType = #BuildBridgeSelectionWidgets
+		 */
+		WC_BUILD_BRIDGE                              = ::WC_BUILD_BRIDGE,
+
+		/**
+		 * Build station; %Window numbers:
+		 *   - #TRANSPORT_AIR = #AirportPickerWidgets
+		 *   - #TRANSPORT_WATER = #DockToolbarWidgets
+		 *   - #TRANSPORT_RAIL = #BuildRailStationWidgets
+		 */
+		WC_BUILD_STATION                             = ::WC_BUILD_STATION,
+
+		/**
+		 * Build bus station; %Window numbers:
+		 *   - #TRANSPORT_ROAD = #BuildRoadStationWidgets
+		 */
+		WC_BUS_STATION                               = ::WC_BUS_STATION,
+
+		/**
+		 * Build truck station; %Window numbers:
+		 *   - #TRANSPORT_ROAD = #BuildRoadStationWidgets
+		 */
+		WC_TRUCK_STATION                             = ::WC_TRUCK_STATION,
+
+		/**
+		 * Build depot; %Window numbers:
+		 *   - #TRANSPORT_WATER = #BuildDockDepotWidgets
+		 *   - #TRANSPORT_RAIL = #BuildRailDepotWidgets
+		 *   - #TRANSPORT_ROAD = #BuildRoadDepotWidgets
+		 */
+		WC_BUILD_DEPOT                               = ::WC_BUILD_DEPOT,
+
+		/**
+		 * Build waypoint; %Window numbers:
+		 *   - #TRANSPORT_RAIL = #BuildRailWaypointWidgets
+		 */
+		WC_BUILD_WAYPOINT                            = ::WC_BUILD_WAYPOINT,
+
+		/**
+		 * Found a town; %Window numbers:
+		 *   - 0 = #TownFoundingWidgets
+		 */
+		WC_FOUND_TOWN                                = ::WC_FOUND_TOWN,
+
+		/**
+		 * Build industry; %Window numbers:
+		 *   - 0 = #DynamicPlaceIndustriesWidgets
+		 */
+		WC_BUILD_INDUSTRY                            = ::WC_BUILD_INDUSTRY,
+
+
+		/**
+		 * Select game window; %Window numbers:
+		 *   - 0 = #SelectGameIntroWidgets
+		 */
+		WC_SELECT_GAME                               = ::WC_SELECT_GAME,
+
+		/**
+		 * Landscape generation (in Scenario Editor); %Window numbers:
+		 *   - 0 = #TerraformToolbarWidgets
+		 *   - 0 = #EditorTerraformToolbarWidgets
+		 */
+		WC_SCEN_LAND_GEN                             = ::WC_SCEN_LAND_GEN,
+
+		/**
+		 * Generate landscape (newgame); %Window numbers:
+		 *   - GLWM_SCENARIO = #CreateScenarioWidgets
+		 *   - #GenerateLandscapeWindowMode = #GenerateLandscapeWidgets
+		 */
+		WC_GENERATE_LANDSCAPE                        = ::WC_GENERATE_LANDSCAPE,
+
+		/**
+		 * Progress report of landscape generation; %Window numbers:
+		 *   - 0 = #GenerationProgressWidgets
+		 *   - 1 = #ScanProgressWidgets
+		 */
+		WC_MODAL_PROGRESS                            = ::WC_MODAL_PROGRESS,
+
+
+		/**
+		 * Network window; %Window numbers:
+		 *   - #WN_NETWORK_WINDOW_GAME = #NetworkGameWidgets
+		 *   - #WN_NETWORK_WINDOW_CONTENT_LIST = #NetworkContentListWidgets
+		 *   - #WN_NETWORK_WINDOW_START = #NetworkStartServerWidgets
+		 */
+		WC_NETWORK_WINDOW                            = ::WC_NETWORK_WINDOW,
+
+		/**
+		 * Client list; %Window numbers:
+		 *   - 0 = #ClientListWidgets
+		 */
+		WC_CLIENT_LIST                               = ::WC_CLIENT_LIST,
+
+		/**
+		 * Network status window; %Window numbers:
+		 *   - #WN_NETWORK_STATUS_WINDOW_JOIN = #NetworkJoinStatusWidgets
+		 *   - #WN_NETWORK_STATUS_WINDOW_CONTENT_DOWNLOAD = #NetworkContentDownloadStatusWidgets
+		 */
+		WC_NETWORK_STATUS_WINDOW                     = ::WC_NETWORK_STATUS_WINDOW,
+
+		/**
+		 * Network ask relay window; %Window numbers:
+		 *   - 0 - #NetworkAskRelayWidgets
+		 */
+		WC_NETWORK_ASK_RELAY                         = ::WC_NETWORK_ASK_RELAY,
+
+		/**
+		 * Network ask survey window; %Window numbers:
+		 *  - 0 - #NetworkAskSurveyWidgets
+		 */
+		WC_NETWORK_ASK_SURVEY                        = ::WC_NETWORK_ASK_SURVEY,
+
+		/**
+		 * Chatbox; %Window numbers:
+		 *   - #DestType = #NetWorkChatWidgets
+		 */
+		WC_SEND_NETWORK_MSG                          = ::WC_SEND_NETWORK_MSG,
+
+		/**
+		 * Company password query; %Window numbers:
+		 *   - 0 = #NetworkCompanyPasswordWidgets
+		 */
+		WC_COMPANY_PASSWORD_WINDOW                   = ::WC_COMPANY_PASSWORD_WINDOW,
+
+
+		/**
+		 * Industry cargoes chain; %Window numbers:
+		 *   - 0 = #IndustryCargoesWidgets
+		 */
+		WC_INDUSTRY_CARGOES                          = ::WC_INDUSTRY_CARGOES,
+
+		/**
+		 * Legend for graphs; %Window numbers:
+		 *   - 0 = #GraphLegendWidgets
+		 */
+		WC_GRAPH_LEGEND                              = ::WC_GRAPH_LEGEND,
+
+		/**
+		 * Finances of a company; %Window numbers:
+		 *   - #CompanyID = #CompanyWidgets
+		 */
+		WC_FINANCES                                  = ::WC_FINANCES,
+		WC_CARGOS                                    = ::WC_CARGOS,
+
+		/**
+		 * Income graph; %Window numbers:
+		 *   - 0 = #CompanyValueWidgets
+		 */
+		WC_INCOME_GRAPH                              = ::WC_INCOME_GRAPH,
+
+		/**
+		 * Operating profit graph; %Window numbers:
+		 *   - 0 = #CompanyValueWidgets
+		 */
+		WC_OPERATING_PROFIT                          = ::WC_OPERATING_PROFIT,
+
+		/**
+		 * Delivered cargo graph; %Window numbers:
+		 *   - 0 = #CompanyValueWidgets
+		 */
+		WC_DELIVERED_CARGO                           = ::WC_DELIVERED_CARGO,
+
+		/**
+		 * Performance history graph; %Window numbers:
+		 *   - 0 = #PerformanceHistoryGraphWidgets
+		 */
+		WC_PERFORMANCE_HISTORY                       = ::WC_PERFORMANCE_HISTORY,
+
+		/**
+		 * Company value graph; %Window numbers:
+		 *   - 0 = #CompanyValueWidgets
+		 */
+		WC_COMPANY_VALUE                             = ::WC_COMPANY_VALUE,
+
+		/**
+		 * Company league window; %Window numbers:
+		 *   - 0 = #CompanyLeagueWidgets
+		 */
+		WC_COMPANY_LEAGUE                            = ::WC_COMPANY_LEAGUE,
+
+		/**
+		 * Payment rates graph; %Window numbers:
+		 *   - 0 = #CargoPaymentRatesWidgets
+		 */
+		WC_PAYMENT_RATES                             = ::WC_PAYMENT_RATES,
+
+		/**
+		 * Performance detail window; %Window numbers:
+		 *   - 0 = #PerformanceRatingDetailsWidgets
+		 */
+		WC_PERFORMANCE_DETAIL                        = ::WC_PERFORMANCE_DETAIL,
+
+		/**
+		 * Company infrastructure overview; %Window numbers:
+		 *   - #CompanyID = #CompanyInfrastructureWidgets
+		 */
+		WC_COMPANY_INFRASTRUCTURE                    = ::WC_COMPANY_INFRASTRUCTURE,
+
+
+		/**
+		 * Buyout company (merger); %Window numbers:
+		 *   - #CompanyID = #BuyCompanyWidgets
+		 */
+		WC_BUY_COMPANY                               = ::WC_BUY_COMPANY,
+
+		/**
+		 * Engine preview window; %Window numbers:
+		 *   - #EngineID = #EnginePreviewWidgets
+		 */
+		WC_ENGINE_PREVIEW                            = ::WC_ENGINE_PREVIEW,
+
+
+		/**
+		 * Music window; %Window numbers:
+		 *   - 0 = #MusicWidgets
+		 */
+		WC_MUSIC_WINDOW                              = ::WC_MUSIC_WINDOW,
+
+		/**
+		 * Music track selection; %Window numbers:
+		 *   - 0 = MusicTrackSelectionWidgets
+		 */
+		WC_MUSIC_TRACK_SELECTION                     = ::WC_MUSIC_TRACK_SELECTION,
+
+		/**
+		 * Game options window; %Window numbers:
+		 *   - #WN_GAME_OPTIONS_AI = #AIConfigWidgets
+		 *   - #WN_GAME_OPTIONS_GS = #GSConfigWidgets
+		 *   - #WN_GAME_OPTIONS_ABOUT = #AboutWidgets
+		 *   - #WN_GAME_OPTIONS_NEWGRF_STATE = #NewGRFStateWidgets
+		 *   - #WN_GAME_OPTIONS_GAME_OPTIONS = #GameOptionsWidgets
+		 *   - #WN_GAME_OPTIONS_GAME_SETTINGS = #GameSettingsWidgets
+		 */
+		WC_GAME_OPTIONS                              = ::WC_GAME_OPTIONS,
+
+		/**
+		 * Custom currency; %Window numbers:
+		 *   - 0 = #CustomCurrencyWidgets
+		 */
+		WC_CUSTOM_CURRENCY                           = ::WC_CUSTOM_CURRENCY,
+
+		/**
+		 * Cheat window; %Window numbers:
+		 *   - 0 = #CheatWidgets
+		 */
+		WC_CHEATS                                    = ::WC_CHEATS,
+
+		/**
+		 * Extra viewport; %Window numbers:
+		 *   - Ascending value = #ExtraViewportWidgets
+		 */
+		WC_EXTRA_VIEWPORT                            = ::WC_EXTRA_VIEWPORT,
+
+
+		/**
+		 * Console; %Window numbers:
+		 *   - 0 = #ConsoleWidgets
+		 */
+		WC_CONSOLE                                   = ::WC_CONSOLE,
+
+		/**
+		 * Bootstrap; %Window numbers:
+		 *   - 0 = #BootstrapBackgroundWidgets
+		 */
+		WC_BOOTSTRAP                                 = ::WC_BOOTSTRAP,
+
+		/**
+		 * Highscore; %Window numbers:
+		 *   - 0 = #HighscoreWidgets
+		 */
+		WC_HIGHSCORE                                 = ::WC_HIGHSCORE,
+
+		/**
+		 * Endscreen; %Window numbers:
+		 *   - 0 = #HighscoreWidgets
+		 */
+		WC_ENDSCREEN                                 = ::WC_ENDSCREEN,
+
+
+		/**
+		 * Script debug window; %Window numbers:
+		 *   - Ascending value = #ScriptDebugWidgets
+		 */
+		WC_SCRIPT_DEBUG                              = ::WC_SCRIPT_DEBUG,
+
+		/**
+		 * NewGRF inspect (debug); %Window numbers:
+		 *   - Packed value = #NewGRFInspectWidgets
+		 */
+		WC_NEWGRF_INSPECT                            = ::WC_NEWGRF_INSPECT,
+
+		/**
+		 * Sprite aligner (debug); %Window numbers:
+		 *   - 0 = #SpriteAlignerWidgets
+		 */
+		WC_SPRITE_ALIGNER                            = ::WC_SPRITE_ALIGNER,
+
+		/**
+		 * Linkgraph legend; %Window numbers:
+		 *   - 0 = #LinkGraphWidgets
+		 */
+		WC_LINKGRAPH_LEGEND                          = ::WC_LINKGRAPH_LEGEND,
+
+		/**
+		 * Save preset; %Window numbers:
+		 *   - 0 = #SavePresetWidgets
+		 */
+		WC_SAVE_PRESET                               = ::WC_SAVE_PRESET,
+
+		/**
+		 * Framerate display; %Window numbers:
+		 *   - 0 = #FramerateDisplayWidgets
+		 */
+		WC_FRAMERATE_DISPLAY                         = ::WC_FRAMERATE_DISPLAY,
+
+		/**
+		 * Frame time graph; %Window numbers:
+		 *   - 0 = #FrametimeGraphWindowWidgets
+		 */
+		WC_FRAMETIME_GRAPH                           = ::WC_FRAMETIME_GRAPH,
+
+		/**
+		 * Screenshot window; %Window numbers:
+		 *   - 0 = #ScreenshotWidgets
+		 */
+		WC_SCREENSHOT                                = ::WC_SCREENSHOT,
+
+		/*
+		 * Help and manuals window; %Window numbers:
+		 *   - 0 = #HelpWindowWidgets
+		 */
+		WC_HELPWIN                                   = ::WC_HELPWIN,
+
+		/*
+		 * CityMania extra windows
+		 */
+		CM_WC_LAND_TOOLTIPS                          = ::CM_WC_LAND_TOOLTIPS,
+		CM_WC_ZONING_TOOLBAR                         = ::CM_WC_ZONING_TOOLBAR,
+		CM_WC_COMMAND_TOOLBAR                        = ::CM_WC_COMMAND_TOOLBAR,
+		CM_WC_LOGIN_WINDOW                           = ::CM_WC_LOGIN_WINDOW,
+		CM_WC_CB_TOWN                                = ::CM_WC_CB_TOWN,
+
+		WC_INVALID                                   = ::WC_INVALID,                                   ///< Invalid window.
+	};
+
+	// @endenum
+
+	/**
+	 * The colours in the game which you can use for text and highlights.
+	 */
+	enum TextColour {
+		/* Note: these values represent part of the in-game TextColour enum */
+		TC_BLUE        = ::TC_BLUE,        ///< Blue colour.
+		TC_SILVER      = ::TC_SILVER,      ///< Silver colour.
+		TC_GOLD        = ::TC_GOLD,        ///< Gold colour.
+		TC_RED         = ::TC_RED,         ///< Red colour.
+		TC_PURPLE      = ::TC_PURPLE,      ///< Purple colour.
+		TC_LIGHT_BROWN = ::TC_LIGHT_BROWN, ///< Light brown colour.
+		TC_ORANGE      = ::TC_ORANGE,      ///< Orange colour.
+		TC_GREEN       = ::TC_GREEN,       ///< Green colour.
+		TC_YELLOW      = ::TC_YELLOW,      ///< Yellow colour.
+		TC_DARK_GREEN  = ::TC_DARK_GREEN,  ///< Dark green colour.
+		TC_CREAM       = ::TC_CREAM,       ///< Cream colour.
+		TC_BROWN       = ::TC_BROWN,       ///< Brown colour.
+		TC_WHITE       = ::TC_WHITE,       ///< White colour.
+		TC_LIGHT_BLUE  = ::TC_LIGHT_BLUE,  ///< Light blue colour.
+		TC_GREY        = ::TC_GREY,        ///< Grey colour.
+		TC_DARK_BLUE   = ::TC_DARK_BLUE,   ///< Dark blue colour.
+		TC_BLACK       = ::TC_BLACK,       ///< Black colour.
+		TC_INVALID     = ::TC_INVALID,     ///< Invalid colour.
+	};
+
+	/**
+	 * Special number values.
+	 */
+	enum NumberType {
+		NUMBER_ALL = -1, ///< Value to select all windows of a class.
+	};
+
+	/**
+	 * Special widget values.
+	 */
+	enum WidgetType {
+		WIDGET_ALL = -1, ///< Value to select all widgets of a window.
+	};
+
+	/**
+	 * Close a window.
+	 * @param window The class of the window to close.
+	 * @param number The number of the window to close, or NUMBER_ALL to close all of this class.
+	 *               The value will be clamped to 0 .. MAX(int32_t) when value is not NUMBER_ALL.
+	 * @pre !ScriptGame::IsMultiplayer().
+	 */
+	static void Close(WindowClass window, SQInteger number);
+
+	/**
+	 * Check if a window is open.
+	 * @param window The class of the window to check for.
+	 * @param number The number of the window to check for, or NUMBER_ALL to check for any in the class.
+	 *               The value will be clamped to 0 .. MAX(int32_t) when value is not NUMBER_ALL.
+	 * @pre !ScriptGame::IsMultiplayer().
+	 * @return True if the window is open.
+	 */
+	static bool IsOpen(WindowClass window, SQInteger number);
+
+	/**
+	 * Highlight a widget in a window.
+	 * @param window The class of the window to highlight a widget in.
+	 * @param number The number of the window to highlight a widget in.
+	 *               The value will be clamped to 0 .. MAX(int32_t) when value is not NUMBER_ALL.
+	 * @param widget The widget in the window to highlight, or WIDGET_ALL (in combination with TC_INVALID) to disable all widget highlighting on this window.
+	 *               The value will be clamped to 0 .. MAX(uint8_t) when value is not WIDGET_ALL.
+	 * @param colour The colour of the highlight, or TC_INVALID for disabling.
+	 * @pre !ScriptGame::IsMultiplayer().
+	 * @pre number != NUMBER_ALL.
+	 * @pre colour < TC_END || (widget == WIDGET_ALL && colour == TC_INVALID).
+	 * @pre IsOpen(window, number).
+	 */
+	static void Highlight(WindowClass window, SQInteger number, SQInteger widget, TextColour colour);
+
+	// @enum .*Widgets ../../widgets/*_widget.h
+	/* automatically generated from ../../widgets/ai_widget.h */
+	/* automatically generated from ../../widgets/airport_widget.h */
+	/* automatically generated from ../../widgets/autoreplace_widget.h */
+	/* automatically generated from ../../widgets/bootstrap_widget.h */
+	/* automatically generated from ../../widgets/bridge_widget.h */
+	/* automatically generated from ../../widgets/build_vehicle_widget.h */
+	/* automatically generated from ../../widgets/cargo_table_widget.h */
+	/** Widgets of the #CargosWindow class. */
+	enum CargosWidgets {
+		WID_CT_BACKGROUND                            = ::WID_CT_BACKGROUND,                            ///< Caption of the window.
+		WID_CT_CAPTION                               = ::WID_CT_CAPTION,
+		WID_CT_HEADER_CARGO                          = ::WID_CT_HEADER_CARGO,
+		WID_CT_HEADER_AMOUNT                         = ::WID_CT_HEADER_AMOUNT,
+		WID_CT_HEADER_INCOME                         = ::WID_CT_HEADER_INCOME,
+		WID_CT_LIST                                  = ::WID_CT_LIST,
+		WID_CT_AMOUNT                                = ::WID_CT_AMOUNT,
+		WID_CT_INCOME                                = ::WID_CT_INCOME,
+	};
+
+	/* automatically generated from ../../widgets/cheat_widget.h */
+	/* automatically generated from ../../widgets/company_widget.h */
+	/* automatically generated from ../../widgets/console_widget.h */
+	/* automatically generated from ../../widgets/date_widget.h */
+	/* automatically generated from ../../widgets/depot_widget.h */
+	/* automatically generated from ../../widgets/dock_widget.h */
+	/* automatically generated from ../../widgets/dropdown_widget.h */
+	/* automatically generated from ../../widgets/engine_widget.h */
+	/* automatically generated from ../../widgets/error_widget.h */
+	/* automatically generated from ../../widgets/fios_widget.h */
+	/* automatically generated from ../../widgets/framerate_widget.h */
+	/* automatically generated from ../../widgets/game_widget.h */
+	/* automatically generated from ../../widgets/genworld_widget.h */
+	/* automatically generated from ../../widgets/goal_widget.h */
+	/* automatically generated from ../../widgets/graph_widget.h */
+	/* automatically generated from ../../widgets/group_widget.h */
+	/* automatically generated from ../../widgets/help_widget.h */
+	/* automatically generated from ../../widgets/highscore_widget.h */
+	/* automatically generated from ../../widgets/industry_widget.h */
+	/* automatically generated from ../../widgets/intro_widget.h */
+	/* automatically generated from ../../widgets/league_widget.h */
+	/* automatically generated from ../../widgets/link_graph_legend_widget.h */
+	/* automatically generated from ../../widgets/main_widget.h */
+	/* automatically generated from ../../widgets/misc_widget.h */
+	/* automatically generated from ../../widgets/music_widget.h */
+	/* automatically generated from ../../widgets/network_chat_widget.h */
+	/* automatically generated from ../../widgets/network_content_widget.h */
+	/* automatically generated from ../../widgets/network_widget.h */
+	/* automatically generated from ../../widgets/newgrf_debug_widget.h */
+	/* automatically generated from ../../widgets/newgrf_widget.h */
+	/* automatically generated from ../../widgets/news_widget.h */
+	/* automatically generated from ../../widgets/object_widget.h */
+	/* automatically generated from ../../widgets/order_widget.h */
+	/* automatically generated from ../../widgets/osk_widget.h */
+	/* automatically generated from ../../widgets/rail_widget.h */
+	/* automatically generated from ../../widgets/road_widget.h */
+	/* automatically generated from ../../widgets/screenshot_widget.h */
+	/* automatically generated from ../../widgets/script_widget.h */
+	/* automatically generated from ../../widgets/settings_widget.h */
+	/* automatically generated from ../../widgets/sign_widget.h */
+	/* automatically generated from ../../widgets/smallmap_widget.h */
+	/* automatically generated from ../../widgets/station_widget.h */
+	/* automatically generated from ../../widgets/statusbar_widget.h */
+	/* automatically generated from ../../widgets/story_widget.h */
+	/* automatically generated from ../../widgets/subsidy_widget.h */
+	/* automatically generated from ../../widgets/terraform_widget.h */
+	/* automatically generated from ../../widgets/timetable_widget.h */
+	/* automatically generated from ../../widgets/toolbar_widget.h */
+	/* automatically generated from ../../widgets/town_widget.h */
+	enum CBTownWidgets {
+		WID_CB_CAPTION                               = ::WID_CB_CAPTION,                               ///< Caption of window.
+		WID_CB_CENTER_VIEW                           = ::WID_CB_CENTER_VIEW,
+		WID_CB_ADVERT                                = ::WID_CB_ADVERT,
+		WID_CB_ADVERT_REGULAR                        = ::WID_CB_ADVERT_REGULAR,
+		WID_CB_FUND                                  = ::WID_CB_FUND,
+		WID_CB_FUND_REGULAR                          = ::WID_CB_FUND_REGULAR,
+		WID_CB_POWERFUND                             = ::WID_CB_POWERFUND,
+		WID_CB_DETAILS                               = ::WID_CB_DETAILS,
+		WID_CB_CARGO_NAME                            = ::WID_CB_CARGO_NAME,
+		WID_CB_CARGO_AMOUNT                          = ::WID_CB_CARGO_AMOUNT,
+		WID_CB_CARGO_REQ                             = ::WID_CB_CARGO_REQ,
+		WID_CB_CARGO_PREVIOUS                        = ::WID_CB_CARGO_PREVIOUS,
+		WID_CB_CARGO_STORE                           = ::WID_CB_CARGO_STORE,
+		WID_CB_CARGO_STORE_PCT                       = ::WID_CB_CARGO_STORE_PCT,
+		WID_CB_CARGO_FROM                            = ::WID_CB_CARGO_FROM,
+		WID_CB_TOWN_VIEW                             = ::WID_CB_TOWN_VIEW,
+		WID_CB_SHOW_AUTHORITY                        = ::WID_CB_SHOW_AUTHORITY,
+		WID_CB_SELECT_REQUIREMENTS                   = ::WID_CB_SELECT_REQUIREMENTS,
+		WID_CB_GOALS                                 = ::WID_CB_GOALS,
+	};
+
+	/* automatically generated from ../../widgets/transparency_widget.h */
+	/* automatically generated from ../../widgets/tree_widget.h */
+	/* automatically generated from ../../widgets/vehicle_widget.h */
+	/* automatically generated from ../../widgets/viewport_widget.h */
+	/* automatically generated from ../../widgets/waypoint_widget.h */
+	// @endenum
+};
+
+#endif /* SCRIPT_WINDOW_HPP */
@@ -0,0 +1,44 @@
+file(REMOVE_RECURSE
+  "../../baseset/OpenTTD-Mono.ttf"
+  "../../baseset/OpenTTD-Sans.ttf"
+  "../../baseset/OpenTTD-Serif.ttf"
+  "../../baseset/OpenTTD-Small.ttf"
+  "../../baseset/no_music.obm"
+  "../../baseset/no_sound.obs"
+  "../../baseset/openttd.32.bmp"
+  "../../baseset/openttd.grf"
+  "../../baseset/opntitle.dat"
+  "../../baseset/orig_dos.obg"
+  "../../baseset/orig_dos.obm"
+  "../../baseset/orig_dos.obs"
+  "../../baseset/orig_dos_de.obg"
+  "../../baseset/orig_extra.grf"
+  "../../baseset/orig_tto.obm"
+  "../../baseset/orig_win.obg"
+  "../../baseset/orig_win.obm"
+  "../../baseset/orig_win.obs"
+  "CMakeFiles/baseset_files"
+  "OpenTTD-Mono.ttf.timestamp"
+  "OpenTTD-Sans.ttf.timestamp"
+  "OpenTTD-Serif.ttf.timestamp"
+  "OpenTTD-Small.ttf.timestamp"
+  "no_music.obm.timestamp"
+  "no_sound.obs.timestamp"
+  "openttd.32.bmp.timestamp"
+  "openttd.grf.timestamp"
+  "opntitle.dat.timestamp"
+  "orig_dos.obg.timestamp"
+  "orig_dos.obm.timestamp"
+  "orig_dos.obs.timestamp"
+  "orig_dos_de.obg.timestamp"
+  "orig_extra.grf.timestamp"
+  "orig_tto.obm.timestamp"
+  "orig_win.obg.timestamp"
+  "orig_win.obm.timestamp"
+  "orig_win.obs.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/baseset_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
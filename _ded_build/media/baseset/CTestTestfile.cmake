@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/media/baseset
+# Build directory: /root/repo/_ded_build/media/baseset
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("openttd")
+subdirs("orig_extra")
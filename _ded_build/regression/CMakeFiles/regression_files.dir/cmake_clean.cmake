@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/regression_files"
+  "regression.cfg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regression_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/regression
+# Build directory: /root/repo/_ded_build/regression
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("regression")
+subdirs("stationlist")
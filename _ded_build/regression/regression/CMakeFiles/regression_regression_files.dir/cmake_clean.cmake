@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../ai/regression/info.nut"
+  "../../ai/regression/main.nut"
+  "../../ai/regression/require.nut"
+  "../../ai/regression/result.txt"
+  "../../ai/regression/test.sav"
+  "CMakeFiles/regression_regression_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regression_regression_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/regression/regression
+# Build directory: /root/repo/_ded_build/regression/regression
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(regression_regression "/usr/bin/cmake" "-DOPENTTD_EXECUTABLE=/root/repo/_ded_build/openttd" "-DEDITBIN_EXECUTABLE=" "-DREGRESSION_TEST=regression" "-P" "/root/repo/cmake/scripts/Regression.cmake")
+set_tests_properties(regression_regression PROPERTIES  WORKING_DIRECTORY "/root/repo/_ded_build" _BACKTRACE_TRIPLES "/root/repo/cmake/CreateRegression.cmake;48;add_test;/root/repo/regression/regression/CMakeLists.txt;2;create_regression;/root/repo/regression/regression/CMakeLists.txt;0;")
@@ -0,0 +1,12 @@
+file(REMOVE_RECURSE
+  "../../ai/stationlist/info.nut"
+  "../../ai/stationlist/main.nut"
+  "../../ai/stationlist/result.txt"
+  "../../ai/stationlist/test.sav"
+  "CMakeFiles/regression_stationlist_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/regression_stationlist_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/3rdparty
+# Build directory: /root/repo/_ded_build/src/3rdparty
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("catch2")
+subdirs("fmt")
+subdirs("icu")
+subdirs("md5")
+subdirs("monocypher")
+subdirs("squirrel")
+subdirs("nlohmann")
+subdirs("opengl")
+subdirs("openttd_social_integration_api")
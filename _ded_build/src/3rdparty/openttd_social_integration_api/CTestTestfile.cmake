@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/3rdparty/openttd_social_integration_api
+# Build directory: /root/repo/_ded_build/src/3rdparty/openttd_social_integration_api
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/3rdparty/squirrel
+# Build directory: /root/repo/_ded_build/src/3rdparty/squirrel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("include")
+subdirs("sqstdlib")
+subdirs("squirrel")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/3rdparty/squirrel/squirrel
+# Build directory: /root/repo/_ded_build/src/3rdparty/squirrel/squirrel
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
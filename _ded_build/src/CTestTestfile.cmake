@@ -0,0 +1,31 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src
+# Build directory: /root/repo/_ded_build/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("script")
+subdirs("settingsgen")
+subdirs("strgen")
+subdirs("3rdparty")
+subdirs("ai")
+subdirs("blitter")
+subdirs("citymania")
+subdirs("core")
+subdirs("fontcache")
+subdirs("game")
+subdirs("lang")
+subdirs("linkgraph")
+subdirs("misc")
+subdirs("music")
+subdirs("network")
+subdirs("os")
+subdirs("pathfinder")
+subdirs("saveload")
+subdirs("sound")
+subdirs("spriteloader")
+subdirs("table")
+subdirs("tests")
+subdirs("timer")
+subdirs("video")
+subdirs("widgets")
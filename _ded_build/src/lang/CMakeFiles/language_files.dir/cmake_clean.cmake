@@ -0,0 +1,73 @@
+file(REMOVE_RECURSE
+  "../../lang/afrikaans.lng"
+  "../../lang/arabic_egypt.lng"
+  "../../lang/basque.lng"
+  "../../lang/belarusian.lng"
+  "../../lang/brazilian_portuguese.lng"
+  "../../lang/bulgarian.lng"
+  "../../lang/catalan.lng"
+  "../../lang/chuvash.lng"
+  "../../lang/croatian.lng"
+  "../../lang/czech.lng"
+  "../../lang/danish.lng"
+  "../../lang/dutch.lng"
+  "../../lang/english.lng"
+  "../../lang/english_AU.lng"
+  "../../lang/english_US.lng"
+  "../../lang/esperanto.lng"
+  "../../lang/estonian.lng"
+  "../../lang/faroese.lng"
+  "../../lang/finnish.lng"
+  "../../lang/french.lng"
+  "../../lang/frisian.lng"
+  "../../lang/gaelic.lng"
+  "../../lang/galician.lng"
+  "../../lang/german.lng"
+  "../../lang/greek.lng"
+  "../../lang/hebrew.lng"
+  "../../lang/hindi.lng"
+  "../../lang/hungarian.lng"
+  "../../lang/icelandic.lng"
+  "../../lang/ido.lng"
+  "../../lang/indonesian.lng"
+  "../../lang/irish.lng"
+  "../../lang/italian.lng"
+  "../../lang/japanese.lng"
+  "../../lang/korean.lng"
+  "../../lang/latin.lng"
+  "../../lang/latvian.lng"
+  "../../lang/lithuanian.lng"
+  "../../lang/luxembourgish.lng"
+  "../../lang/macedonian.lng"
+  "../../lang/malay.lng"
+  "../../lang/maltese.lng"
+  "../../lang/marathi.lng"
+  "../../lang/norwegian_bokmal.lng"
+  "../../lang/norwegian_nynorsk.lng"
+  "../../lang/persian.lng"
+  "../../lang/polish.lng"
+  "../../lang/portuguese.lng"
+  "../../lang/romanian.lng"
+  "../../lang/russian.lng"
+  "../../lang/serbian.lng"
+  "../../lang/simplified_chinese.lng"
+  "../../lang/slovak.lng"
+  "../../lang/slovenian.lng"
+  "../../lang/spanish.lng"
+  "../../lang/spanish_MX.lng"
+  "../../lang/swedish.lng"
+  "../../lang/tamil.lng"
+  "../../lang/thai.lng"
+  "../../lang/traditional_chinese.lng"
+  "../../lang/turkish.lng"
+  "../../lang/ukrainian.lng"
+  "../../lang/urdu.lng"
+  "../../lang/vietnamese.lng"
+  "../../lang/welsh.lng"
+  "CMakeFiles/language_files"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/language_files.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../generated/table/strings.h"
+  "CMakeFiles/table_strings"
+  "strings.h.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/table_strings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
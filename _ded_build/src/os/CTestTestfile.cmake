@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/os
+# Build directory: /root/repo/_ded_build/src/os
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("macosx")
+subdirs("unix")
+subdirs("windows")
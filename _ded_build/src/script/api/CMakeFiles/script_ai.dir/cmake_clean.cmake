@@ -0,0 +1,158 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/ai/ai_accounting.hpp.sq"
+  "../../../generated/script/api/ai/ai_admin.hpp.sq"
+  "../../../generated/script/api/ai/ai_airport.hpp.sq"
+  "../../../generated/script/api/ai/ai_asyncmode.hpp.sq"
+  "../../../generated/script/api/ai/ai_base.hpp.sq"
+  "../../../generated/script/api/ai/ai_basestation.hpp.sq"
+  "../../../generated/script/api/ai/ai_bridge.hpp.sq"
+  "../../../generated/script/api/ai/ai_bridgelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_cargo.hpp.sq"
+  "../../../generated/script/api/ai/ai_cargolist.hpp.sq"
+  "../../../generated/script/api/ai/ai_cargomonitor.hpp.sq"
+  "../../../generated/script/api/ai/ai_client.hpp.sq"
+  "../../../generated/script/api/ai/ai_clientlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_company.hpp.sq"
+  "../../../generated/script/api/ai/ai_companymode.hpp.sq"
+  "../../../generated/script/api/ai/ai_date.hpp.sq"
+  "../../../generated/script/api/ai/ai_depotlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_engine.hpp.sq"
+  "../../../generated/script/api/ai/ai_enginelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_error.hpp.sq"
+  "../../../generated/script/api/ai/ai_event.hpp.sq"
+  "../../../generated/script/api/ai/ai_event_types.hpp.sq"
+  "../../../generated/script/api/ai/ai_execmode.hpp.sq"
+  "../../../generated/script/api/ai/ai_game.hpp.sq"
+  "../../../generated/script/api/ai/ai_gamesettings.hpp.sq"
+  "../../../generated/script/api/ai/ai_goal.hpp.sq"
+  "../../../generated/script/api/ai/ai_group.hpp.sq"
+  "../../../generated/script/api/ai/ai_grouplist.hpp.sq"
+  "../../../generated/script/api/ai/ai_industry.hpp.sq"
+  "../../../generated/script/api/ai/ai_industrylist.hpp.sq"
+  "../../../generated/script/api/ai/ai_industrytype.hpp.sq"
+  "../../../generated/script/api/ai/ai_industrytypelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_info_docs.hpp.sq"
+  "../../../generated/script/api/ai/ai_infrastructure.hpp.sq"
+  "../../../generated/script/api/ai/ai_league.hpp.sq"
+  "../../../generated/script/api/ai/ai_list.hpp.sq"
+  "../../../generated/script/api/ai/ai_log.hpp.sq"
+  "../../../generated/script/api/ai/ai_log_types.hpp.sq"
+  "../../../generated/script/api/ai/ai_map.hpp.sq"
+  "../../../generated/script/api/ai/ai_marine.hpp.sq"
+  "../../../generated/script/api/ai/ai_newgrf.hpp.sq"
+  "../../../generated/script/api/ai/ai_news.hpp.sq"
+  "../../../generated/script/api/ai/ai_object.hpp.sq"
+  "../../../generated/script/api/ai/ai_objecttype.hpp.sq"
+  "../../../generated/script/api/ai/ai_objecttypelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_order.hpp.sq"
+  "../../../generated/script/api/ai/ai_priorityqueue.hpp.sq"
+  "../../../generated/script/api/ai/ai_rail.hpp.sq"
+  "../../../generated/script/api/ai/ai_railtypelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_road.hpp.sq"
+  "../../../generated/script/api/ai/ai_roadtypelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_sign.hpp.sq"
+  "../../../generated/script/api/ai/ai_signlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_station.hpp.sq"
+  "../../../generated/script/api/ai/ai_stationlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_story_page.hpp.sq"
+  "../../../generated/script/api/ai/ai_storypageelementlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_storypagelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_subsidy.hpp.sq"
+  "../../../generated/script/api/ai/ai_subsidylist.hpp.sq"
+  "../../../generated/script/api/ai/ai_testmode.hpp.sq"
+  "../../../generated/script/api/ai/ai_text.hpp.sq"
+  "../../../generated/script/api/ai/ai_tile.hpp.sq"
+  "../../../generated/script/api/ai/ai_tilelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_timemode.hpp.sq"
+  "../../../generated/script/api/ai/ai_town.hpp.sq"
+  "../../../generated/script/api/ai/ai_townlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_tunnel.hpp.sq"
+  "../../../generated/script/api/ai/ai_types.hpp.sq"
+  "../../../generated/script/api/ai/ai_vehicle.hpp.sq"
+  "../../../generated/script/api/ai/ai_vehiclelist.hpp.sq"
+  "../../../generated/script/api/ai/ai_viewport.hpp.sq"
+  "../../../generated/script/api/ai/ai_waypoint.hpp.sq"
+  "../../../generated/script/api/ai/ai_waypointlist.hpp.sq"
+  "../../../generated/script/api/ai/ai_window.hpp.sq"
+  "CMakeFiles/script_ai"
+  "ai_accounting.hpp.sq.timestamp"
+  "ai_admin.hpp.sq.timestamp"
+  "ai_airport.hpp.sq.timestamp"
+  "ai_asyncmode.hpp.sq.timestamp"
+  "ai_base.hpp.sq.timestamp"
+  "ai_basestation.hpp.sq.timestamp"
+  "ai_bridge.hpp.sq.timestamp"
+  "ai_bridgelist.hpp.sq.timestamp"
+  "ai_cargo.hpp.sq.timestamp"
+  "ai_cargolist.hpp.sq.timestamp"
+  "ai_cargomonitor.hpp.sq.timestamp"
+  "ai_client.hpp.sq.timestamp"
+  "ai_clientlist.hpp.sq.timestamp"
+  "ai_company.hpp.sq.timestamp"
+  "ai_companymode.hpp.sq.timestamp"
+  "ai_date.hpp.sq.timestamp"
+  "ai_depotlist.hpp.sq.timestamp"
+  "ai_engine.hpp.sq.timestamp"
+  "ai_enginelist.hpp.sq.timestamp"
+  "ai_error.hpp.sq.timestamp"
+  "ai_event.hpp.sq.timestamp"
+  "ai_event_types.hpp.sq.timestamp"
+  "ai_execmode.hpp.sq.timestamp"
+  "ai_game.hpp.sq.timestamp"
+  "ai_gamesettings.hpp.sq.timestamp"
+  "ai_goal.hpp.sq.timestamp"
+  "ai_group.hpp.sq.timestamp"
+  "ai_grouplist.hpp.sq.timestamp"
+  "ai_industry.hpp.sq.timestamp"
+  "ai_industrylist.hpp.sq.timestamp"
+  "ai_industrytype.hpp.sq.timestamp"
+  "ai_industrytypelist.hpp.sq.timestamp"
+  "ai_info_docs.hpp.sq.timestamp"
+  "ai_infrastructure.hpp.sq.timestamp"
+  "ai_league.hpp.sq.timestamp"
+  "ai_list.hpp.sq.timestamp"
+  "ai_log.hpp.sq.timestamp"
+  "ai_log_types.hpp.sq.timestamp"
+  "ai_map.hpp.sq.timestamp"
+  "ai_marine.hpp.sq.timestamp"
+  "ai_newgrf.hpp.sq.timestamp"
+  "ai_news.hpp.sq.timestamp"
+  "ai_object.hpp.sq.timestamp"
+  "ai_objecttype.hpp.sq.timestamp"
+  "ai_objecttypelist.hpp.sq.timestamp"
+  "ai_order.hpp.sq.timestamp"
+  "ai_priorityqueue.hpp.sq.timestamp"
+  "ai_rail.hpp.sq.timestamp"
+  "ai_railtypelist.hpp.sq.timestamp"
+  "ai_road.hpp.sq.timestamp"
+  "ai_roadtypelist.hpp.sq.timestamp"
+  "ai_sign.hpp.sq.timestamp"
+  "ai_signlist.hpp.sq.timestamp"
+  "ai_station.hpp.sq.timestamp"
+  "ai_stationlist.hpp.sq.timestamp"
+  "ai_story_page.hpp.sq.timestamp"
+  "ai_storypageelementlist.hpp.sq.timestamp"
+  "ai_storypagelist.hpp.sq.timestamp"
+  "ai_subsidy.hpp.sq.timestamp"
+  "ai_subsidylist.hpp.sq.timestamp"
+  "ai_testmode.hpp.sq.timestamp"
+  "ai_text.hpp.sq.timestamp"
+  "ai_tile.hpp.sq.timestamp"
+  "ai_tilelist.hpp.sq.timestamp"
+  "ai_timemode.hpp.sq.timestamp"
+  "ai_town.hpp.sq.timestamp"
+  "ai_townlist.hpp.sq.timestamp"
+  "ai_tunnel.hpp.sq.timestamp"
+  "ai_types.hpp.sq.timestamp"
+  "ai_vehicle.hpp.sq.timestamp"
+  "ai_vehiclelist.hpp.sq.timestamp"
+  "ai_viewport.hpp.sq.timestamp"
+  "ai_waypoint.hpp.sq.timestamp"
+  "ai_waypointlist.hpp.sq.timestamp"
+  "ai_window.hpp.sq.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_ai.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
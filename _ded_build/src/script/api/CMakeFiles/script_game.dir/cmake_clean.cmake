@@ -0,0 +1,158 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/game/game_accounting.hpp.sq"
+  "../../../generated/script/api/game/game_admin.hpp.sq"
+  "../../../generated/script/api/game/game_airport.hpp.sq"
+  "../../../generated/script/api/game/game_asyncmode.hpp.sq"
+  "../../../generated/script/api/game/game_base.hpp.sq"
+  "../../../generated/script/api/game/game_basestation.hpp.sq"
+  "../../../generated/script/api/game/game_bridge.hpp.sq"
+  "../../../generated/script/api/game/game_bridgelist.hpp.sq"
+  "../../../generated/script/api/game/game_cargo.hpp.sq"
+  "../../../generated/script/api/game/game_cargolist.hpp.sq"
+  "../../../generated/script/api/game/game_cargomonitor.hpp.sq"
+  "../../../generated/script/api/game/game_client.hpp.sq"
+  "../../../generated/script/api/game/game_clientlist.hpp.sq"
+  "../../../generated/script/api/game/game_company.hpp.sq"
+  "../../../generated/script/api/game/game_companymode.hpp.sq"
+  "../../../generated/script/api/game/game_date.hpp.sq"
+  "../../../generated/script/api/game/game_depotlist.hpp.sq"
+  "../../../generated/script/api/game/game_engine.hpp.sq"
+  "../../../generated/script/api/game/game_enginelist.hpp.sq"
+  "../../../generated/script/api/game/game_error.hpp.sq"
+  "../../../generated/script/api/game/game_event.hpp.sq"
+  "../../../generated/script/api/game/game_event_types.hpp.sq"
+  "../../../generated/script/api/game/game_execmode.hpp.sq"
+  "../../../generated/script/api/game/game_game.hpp.sq"
+  "../../../generated/script/api/game/game_gamesettings.hpp.sq"
+  "../../../generated/script/api/game/game_goal.hpp.sq"
+  "../../../generated/script/api/game/game_group.hpp.sq"
+  "../../../generated/script/api/game/game_grouplist.hpp.sq"
+  "../../../generated/script/api/game/game_industry.hpp.sq"
+  "../../../generated/script/api/game/game_industrylist.hpp.sq"
+  "../../../generated/script/api/game/game_industrytype.hpp.sq"
+  "../../../generated/script/api/game/game_industrytypelist.hpp.sq"
+  "../../../generated/script/api/game/game_info_docs.hpp.sq"
+  "../../../generated/script/api/game/game_infrastructure.hpp.sq"
+  "../../../generated/script/api/game/game_league.hpp.sq"
+  "../../../generated/script/api/game/game_list.hpp.sq"
+  "../../../generated/script/api/game/game_log.hpp.sq"
+  "../../../generated/script/api/game/game_log_types.hpp.sq"
+  "../../../generated/script/api/game/game_map.hpp.sq"
+  "../../../generated/script/api/game/game_marine.hpp.sq"
+  "../../../generated/script/api/game/game_newgrf.hpp.sq"
+  "../../../generated/script/api/game/game_news.hpp.sq"
+  "../../../generated/script/api/game/game_object.hpp.sq"
+  "../../../generated/script/api/game/game_objecttype.hpp.sq"
+  "../../../generated/script/api/game/game_objecttypelist.hpp.sq"
+  "../../../generated/script/api/game/game_order.hpp.sq"
+  "../../../generated/script/api/game/game_priorityqueue.hpp.sq"
+  "../../../generated/script/api/game/game_rail.hpp.sq"
+  "../../../generated/script/api/game/game_railtypelist.hpp.sq"
+  "../../../generated/script/api/game/game_road.hpp.sq"
+  "../../../generated/script/api/game/game_roadtypelist.hpp.sq"
+  "../../../generated/script/api/game/game_sign.hpp.sq"
+  "../../../generated/script/api/game/game_signlist.hpp.sq"
+  "../../../generated/script/api/game/game_station.hpp.sq"
+  "../../../generated/script/api/game/game_stationlist.hpp.sq"
+  "../../../generated/script/api/game/game_story_page.hpp.sq"
+  "../../../generated/script/api/game/game_storypageelementlist.hpp.sq"
+  "../../../generated/script/api/game/game_storypagelist.hpp.sq"
+  "../../../generated/script/api/game/game_subsidy.hpp.sq"
+  "../../../generated/script/api/game/game_subsidylist.hpp.sq"
+  "../../../generated/script/api/game/game_testmode.hpp.sq"
+  "../../../generated/script/api/game/game_text.hpp.sq"
+  "../../../generated/script/api/game/game_tile.hpp.sq"
+  "../../../generated/script/api/game/game_tilelist.hpp.sq"
+  "../../../generated/script/api/game/game_timemode.hpp.sq"
+  "../../../generated/script/api/game/game_town.hpp.sq"
+  "../../../generated/script/api/game/game_townlist.hpp.sq"
+  "../../../generated/script/api/game/game_tunnel.hpp.sq"
+  "../../../generated/script/api/game/game_types.hpp.sq"
+  "../../../generated/script/api/game/game_vehicle.hpp.sq"
+  "../../../generated/script/api/game/game_vehiclelist.hpp.sq"
+  "../../../generated/script/api/game/game_viewport.hpp.sq"
+  "../../../generated/script/api/game/game_waypoint.hpp.sq"
+  "../../../generated/script/api/game/game_waypointlist.hpp.sq"
+  "../../../generated/script/api/game/game_window.hpp.sq"
+  "CMakeFiles/script_game"
+  "game_accounting.hpp.sq.timestamp"
+  "game_admin.hpp.sq.timestamp"
+  "game_airport.hpp.sq.timestamp"
+  "game_asyncmode.hpp.sq.timestamp"
+  "game_base.hpp.sq.timestamp"
+  "game_basestation.hpp.sq.timestamp"
+  "game_bridge.hpp.sq.timestamp"
+  "game_bridgelist.hpp.sq.timestamp"
+  "game_cargo.hpp.sq.timestamp"
+  "game_cargolist.hpp.sq.timestamp"
+  "game_cargomonitor.hpp.sq.timestamp"
+  "game_client.hpp.sq.timestamp"
+  "game_clientlist.hpp.sq.timestamp"
+  "game_company.hpp.sq.timestamp"
+  "game_companymode.hpp.sq.timestamp"
+  "game_date.hpp.sq.timestamp"
+  "game_depotlist.hpp.sq.timestamp"
+  "game_engine.hpp.sq.timestamp"
+  "game_enginelist.hpp.sq.timestamp"
+  "game_error.hpp.sq.timestamp"
+  "game_event.hpp.sq.timestamp"
+  "game_event_types.hpp.sq.timestamp"
+  "game_execmode.hpp.sq.timestamp"
+  "game_game.hpp.sq.timestamp"
+  "game_gamesettings.hpp.sq.timestamp"
+  "game_goal.hpp.sq.timestamp"
+  "game_group.hpp.sq.timestamp"
+  "game_grouplist.hpp.sq.timestamp"
+  "game_industry.hpp.sq.timestamp"
+  "game_industrylist.hpp.sq.timestamp"
+  "game_industrytype.hpp.sq.timestamp"
+  "game_industrytypelist.hpp.sq.timestamp"
+  "game_info_docs.hpp.sq.timestamp"
+  "game_infrastructure.hpp.sq.timestamp"
+  "game_league.hpp.sq.timestamp"
+  "game_list.hpp.sq.timestamp"
+  "game_log.hpp.sq.timestamp"
+  "game_log_types.hpp.sq.timestamp"
+  "game_map.hpp.sq.timestamp"
+  "game_marine.hpp.sq.timestamp"
+  "game_newgrf.hpp.sq.timestamp"
+  "game_news.hpp.sq.timestamp"
+  "game_object.hpp.sq.timestamp"
+  "game_objecttype.hpp.sq.timestamp"
+  "game_objecttypelist.hpp.sq.timestamp"
+  "game_order.hpp.sq.timestamp"
+  "game_priorityqueue.hpp.sq.timestamp"
+  "game_rail.hpp.sq.timestamp"
+  "game_railtypelist.hpp.sq.timestamp"
+  "game_road.hpp.sq.timestamp"
+  "game_roadtypelist.hpp.sq.timestamp"
+  "game_sign.hpp.sq.timestamp"
+  "game_signlist.hpp.sq.timestamp"
+  "game_station.hpp.sq.timestamp"
+  "game_stationlist.hpp.sq.timestamp"
+  "game_story_page.hpp.sq.timestamp"
+  "game_storypageelementlist.hpp.sq.timestamp"
+  "game_storypagelist.hpp.sq.timestamp"
+  "game_subsidy.hpp.sq.timestamp"
+  "game_subsidylist.hpp.sq.timestamp"
+  "game_testmode.hpp.sq.timestamp"
+  "game_text.hpp.sq.timestamp"
+  "game_tile.hpp.sq.timestamp"
+  "game_tilelist.hpp.sq.timestamp"
+  "game_timemode.hpp.sq.timestamp"
+  "game_town.hpp.sq.timestamp"
+  "game_townlist.hpp.sq.timestamp"
+  "game_tunnel.hpp.sq.timestamp"
+  "game_types.hpp.sq.timestamp"
+  "game_vehicle.hpp.sq.timestamp"
+  "game_vehiclelist.hpp.sq.timestamp"
+  "game_viewport.hpp.sq.timestamp"
+  "game_waypoint.hpp.sq.timestamp"
+  "game_waypointlist.hpp.sq.timestamp"
+  "game_window.hpp.sq.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_game.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/game/game_includes.hpp"
+  "CMakeFiles/script_game_includes"
+  "game_includes.hpp.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_game_includes.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
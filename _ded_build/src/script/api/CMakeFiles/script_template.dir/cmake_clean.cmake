@@ -0,0 +1,158 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/template/template_accounting.hpp.sq"
+  "../../../generated/script/api/template/template_admin.hpp.sq"
+  "../../../generated/script/api/template/template_airport.hpp.sq"
+  "../../../generated/script/api/template/template_asyncmode.hpp.sq"
+  "../../../generated/script/api/template/template_base.hpp.sq"
+  "../../../generated/script/api/template/template_basestation.hpp.sq"
+  "../../../generated/script/api/template/template_bridge.hpp.sq"
+  "../../../generated/script/api/template/template_bridgelist.hpp.sq"
+  "../../../generated/script/api/template/template_cargo.hpp.sq"
+  "../../../generated/script/api/template/template_cargolist.hpp.sq"
+  "../../../generated/script/api/template/template_cargomonitor.hpp.sq"
+  "../../../generated/script/api/template/template_client.hpp.sq"
+  "../../../generated/script/api/template/template_clientlist.hpp.sq"
+  "../../../generated/script/api/template/template_company.hpp.sq"
+  "../../../generated/script/api/template/template_companymode.hpp.sq"
+  "../../../generated/script/api/template/template_date.hpp.sq"
+  "../../../generated/script/api/template/template_depotlist.hpp.sq"
+  "../../../generated/script/api/template/template_engine.hpp.sq"
+  "../../../generated/script/api/template/template_enginelist.hpp.sq"
+  "../../../generated/script/api/template/template_error.hpp.sq"
+  "../../../generated/script/api/template/template_event.hpp.sq"
+  "../../../generated/script/api/template/template_event_types.hpp.sq"
+  "../../../generated/script/api/template/template_execmode.hpp.sq"
+  "../../../generated/script/api/template/template_game.hpp.sq"
+  "../../../generated/script/api/template/template_gamesettings.hpp.sq"
+  "../../../generated/script/api/template/template_goal.hpp.sq"
+  "../../../generated/script/api/template/template_group.hpp.sq"
+  "../../../generated/script/api/template/template_grouplist.hpp.sq"
+  "../../../generated/script/api/template/template_industry.hpp.sq"
+  "../../../generated/script/api/template/template_industrylist.hpp.sq"
+  "../../../generated/script/api/template/template_industrytype.hpp.sq"
+  "../../../generated/script/api/template/template_industrytypelist.hpp.sq"
+  "../../../generated/script/api/template/template_info_docs.hpp.sq"
+  "../../../generated/script/api/template/template_infrastructure.hpp.sq"
+  "../../../generated/script/api/template/template_league.hpp.sq"
+  "../../../generated/script/api/template/template_list.hpp.sq"
+  "../../../generated/script/api/template/template_log.hpp.sq"
+  "../../../generated/script/api/template/template_log_types.hpp.sq"
+  "../../../generated/script/api/template/template_map.hpp.sq"
+  "../../../generated/script/api/template/template_marine.hpp.sq"
+  "../../../generated/script/api/template/template_newgrf.hpp.sq"
+  "../../../generated/script/api/template/template_news.hpp.sq"
+  "../../../generated/script/api/template/template_object.hpp.sq"
+  "../../../generated/script/api/template/template_objecttype.hpp.sq"
+  "../../../generated/script/api/template/template_objecttypelist.hpp.sq"
+  "../../../generated/script/api/template/template_order.hpp.sq"
+  "../../../generated/script/api/template/template_priorityqueue.hpp.sq"
+  "../../../generated/script/api/template/template_rail.hpp.sq"
+  "../../../generated/script/api/template/template_railtypelist.hpp.sq"
+  "../../../generated/script/api/template/template_road.hpp.sq"
+  "../../../generated/script/api/template/template_roadtypelist.hpp.sq"
+  "../../../generated/script/api/template/template_sign.hpp.sq"
+  "../../../generated/script/api/template/template_signlist.hpp.sq"
+  "../../../generated/script/api/template/template_station.hpp.sq"
+  "../../../generated/script/api/template/template_stationlist.hpp.sq"
+  "../../../generated/script/api/template/template_story_page.hpp.sq"
+  "../../../generated/script/api/template/template_storypageelementlist.hpp.sq"
+  "../../../generated/script/api/template/template_storypagelist.hpp.sq"
+  "../../../generated/script/api/template/template_subsidy.hpp.sq"
+  "../../../generated/script/api/template/template_subsidylist.hpp.sq"
+  "../../../generated/script/api/template/template_testmode.hpp.sq"
+  "../../../generated/script/api/template/template_text.hpp.sq"
+  "../../../generated/script/api/template/template_tile.hpp.sq"
+  "../../../generated/script/api/template/template_tilelist.hpp.sq"
+  "../../../generated/script/api/template/template_timemode.hpp.sq"
+  "../../../generated/script/api/template/template_town.hpp.sq"
+  "../../../generated/script/api/template/template_townlist.hpp.sq"
+  "../../../generated/script/api/template/template_tunnel.hpp.sq"
+  "../../../generated/script/api/template/template_types.hpp.sq"
+  "../../../generated/script/api/template/template_vehicle.hpp.sq"
+  "../../../generated/script/api/template/template_vehiclelist.hpp.sq"
+  "../../../generated/script/api/template/template_viewport.hpp.sq"
+  "../../../generated/script/api/template/template_waypoint.hpp.sq"
+  "../../../generated/script/api/template/template_waypointlist.hpp.sq"
+  "../../../generated/script/api/template/template_window.hpp.sq"
+  "CMakeFiles/script_template"
+  "template_accounting.hpp.sq.timestamp"
+  "template_admin.hpp.sq.timestamp"
+  "template_airport.hpp.sq.timestamp"
+  "template_asyncmode.hpp.sq.timestamp"
+  "template_base.hpp.sq.timestamp"
+  "template_basestation.hpp.sq.timestamp"
+  "template_bridge.hpp.sq.timestamp"
+  "template_bridgelist.hpp.sq.timestamp"
+  "template_cargo.hpp.sq.timestamp"
+  "template_cargolist.hpp.sq.timestamp"
+  "template_cargomonitor.hpp.sq.timestamp"
+  "template_client.hpp.sq.timestamp"
+  "template_clientlist.hpp.sq.timestamp"
+  "template_company.hpp.sq.timestamp"
+  "template_companymode.hpp.sq.timestamp"
+  "template_date.hpp.sq.timestamp"
+  "template_depotlist.hpp.sq.timestamp"
+  "template_engine.hpp.sq.timestamp"
+  "template_enginelist.hpp.sq.timestamp"
+  "template_error.hpp.sq.timestamp"
+  "template_event.hpp.sq.timestamp"
+  "template_event_types.hpp.sq.timestamp"
+  "template_execmode.hpp.sq.timestamp"
+  "template_game.hpp.sq.timestamp"
+  "template_gamesettings.hpp.sq.timestamp"
+  "template_goal.hpp.sq.timestamp"
+  "template_group.hpp.sq.timestamp"
+  "template_grouplist.hpp.sq.timestamp"
+  "template_industry.hpp.sq.timestamp"
+  "template_industrylist.hpp.sq.timestamp"
+  "template_industrytype.hpp.sq.timestamp"
+  "template_industrytypelist.hpp.sq.timestamp"
+  "template_info_docs.hpp.sq.timestamp"
+  "template_infrastructure.hpp.sq.timestamp"
+  "template_league.hpp.sq.timestamp"
+  "template_list.hpp.sq.timestamp"
+  "template_log.hpp.sq.timestamp"
+  "template_log_types.hpp.sq.timestamp"
+  "template_map.hpp.sq.timestamp"
+  "template_marine.hpp.sq.timestamp"
+  "template_newgrf.hpp.sq.timestamp"
+  "template_news.hpp.sq.timestamp"
+  "template_object.hpp.sq.timestamp"
+  "template_objecttype.hpp.sq.timestamp"
+  "template_objecttypelist.hpp.sq.timestamp"
+  "template_order.hpp.sq.timestamp"
+  "template_priorityqueue.hpp.sq.timestamp"
+  "template_rail.hpp.sq.timestamp"
+  "template_railtypelist.hpp.sq.timestamp"
+  "template_road.hpp.sq.timestamp"
+  "template_roadtypelist.hpp.sq.timestamp"
+  "template_sign.hpp.sq.timestamp"
+  "template_signlist.hpp.sq.timestamp"
+  "template_station.hpp.sq.timestamp"
+  "template_stationlist.hpp.sq.timestamp"
+  "template_story_page.hpp.sq.timestamp"
+  "template_storypageelementlist.hpp.sq.timestamp"
+  "template_storypagelist.hpp.sq.timestamp"
+  "template_subsidy.hpp.sq.timestamp"
+  "template_subsidylist.hpp.sq.timestamp"
+  "template_testmode.hpp.sq.timestamp"
+  "template_text.hpp.sq.timestamp"
+  "template_tile.hpp.sq.timestamp"
+  "template_tilelist.hpp.sq.timestamp"
+  "template_timemode.hpp.sq.timestamp"
+  "template_town.hpp.sq.timestamp"
+  "template_townlist.hpp.sq.timestamp"
+  "template_tunnel.hpp.sq.timestamp"
+  "template_types.hpp.sq.timestamp"
+  "template_vehicle.hpp.sq.timestamp"
+  "template_vehiclelist.hpp.sq.timestamp"
+  "template_viewport.hpp.sq.timestamp"
+  "template_waypoint.hpp.sq.timestamp"
+  "template_waypointlist.hpp.sq.timestamp"
+  "template_window.hpp.sq.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_template.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
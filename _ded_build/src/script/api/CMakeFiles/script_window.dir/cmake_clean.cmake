@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../../generated/script/api/script_window.hpp"
+  "CMakeFiles/script_window"
+  "script_window.hpp.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/script_window.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
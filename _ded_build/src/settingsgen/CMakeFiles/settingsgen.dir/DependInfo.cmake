@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/alloc_func.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/__/core/alloc_func.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/__/core/alloc_func.cpp.o.d"
+  "/root/repo/src/error.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/__/error.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/__/error.cpp.o.d"
+  "/root/repo/src/ini_load.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/__/ini_load.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/__/ini_load.cpp.o.d"
+  "/root/repo/src/misc/getoptdata.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/__/misc/getoptdata.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/__/misc/getoptdata.cpp.o.d"
+  "/root/repo/src/string.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/__/string.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/__/string.cpp.o.d"
+  "/root/repo/src/settingsgen/settingsgen.cpp" "src/settingsgen/CMakeFiles/settingsgen.dir/settingsgen.cpp.o" "gcc" "src/settingsgen/CMakeFiles/settingsgen.dir/settingsgen.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
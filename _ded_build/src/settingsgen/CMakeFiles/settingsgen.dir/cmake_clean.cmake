@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/settingsgen.dir/__/core/alloc_func.cpp.o"
+  "CMakeFiles/settingsgen.dir/__/core/alloc_func.cpp.o.d"
+  "CMakeFiles/settingsgen.dir/__/error.cpp.o"
+  "CMakeFiles/settingsgen.dir/__/error.cpp.o.d"
+  "CMakeFiles/settingsgen.dir/__/ini_load.cpp.o"
+  "CMakeFiles/settingsgen.dir/__/ini_load.cpp.o.d"
+  "CMakeFiles/settingsgen.dir/__/misc/getoptdata.cpp.o"
+  "CMakeFiles/settingsgen.dir/__/misc/getoptdata.cpp.o.d"
+  "CMakeFiles/settingsgen.dir/__/string.cpp.o"
+  "CMakeFiles/settingsgen.dir/__/string.cpp.o.d"
+  "CMakeFiles/settingsgen.dir/settingsgen.cpp.o"
+  "CMakeFiles/settingsgen.dir/settingsgen.cpp.o.d"
+  "settingsgen"
+  "settingsgen.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/settingsgen.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
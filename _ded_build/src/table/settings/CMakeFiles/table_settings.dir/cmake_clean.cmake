@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "../../../generated/table/settings.h"
+  "CMakeFiles/table_settings"
+  "settings.h.timestamp"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/table_settings.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -325,6 +325,35 @@ void Blitter_32bppAnim::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomL
 	}
 }
 
+/**
+ * Draw a batch of already clipped images to the screen, in order.
+ * All entries share the same destination and zoom level, so blitters can
+ *  keep per-destination and per-remap state around between entries.
+ * @param entries The images to draw.
+ * @param zoom The zoom level all images are drawn at.
+ */
+void Blitter_32bppAnim::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	if (_screen_disable_anim) {
+		/* This means our output is not to the screen, so we can't be doing any animation stuff, so use our parent DrawBatch() */
+		Blitter_32bppOptimized::DrawBatch(entries, zoom);
+		return;
+	}
+
+	ForEachBlitterModeRun(entries, [this, zoom](BlitterMode mode, std::span<BatchEntry> run) {
+		switch (mode) {
+			default: NOT_REACHED();
+			case BM_NORMAL:       for (const BatchEntry &entry : run) Draw<BM_NORMAL>      (&entry.bp, zoom); return;
+			case BM_COLOUR_REMAP: for (const BatchEntry &entry : run) Draw<BM_COLOUR_REMAP>(&entry.bp, zoom); return;
+			case CM_BM_TINT_REMAP: for (const BatchEntry &entry : run) Draw<CM_BM_TINT_REMAP>(&entry.bp, zoom); return;
+			case BM_TRANSPARENT:  for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT> (&entry.bp, zoom); return;
+			case BM_TRANSPARENT_REMAP: for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT_REMAP>(&entry.bp, zoom); return;
+			case BM_CRASH_REMAP:  for (const BatchEntry &entry : run) Draw<BM_CRASH_REMAP> (&entry.bp, zoom); return;
+			case BM_BLACK_REMAP:  for (const BatchEntry &entry : run) Draw<BM_BLACK_REMAP> (&entry.bp, zoom); return;
+		}
+	});
+}
+
 void Blitter_32bppAnim::DrawColourMappingRect(void *dst, int width, int height, PaletteID pal)
 {
 	if (_screen_disable_anim) {
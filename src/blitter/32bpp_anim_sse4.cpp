@@ -436,4 +436,21 @@ bm_normal:
 	}
 }
 
+/**
+ * Draws a batch of sprites to a (screen) buffer, calling the dispatcher above directly instead of through the vtable.
+ *
+ * @param entries the sprites to draw
+ * @param zoom zoom level at which we are drawing
+ */
+void Blitter_32bppSSE4_Anim::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	if (_screen_disable_anim) {
+		/* This means our output is not to the screen, so we can't be doing any animation stuff, so use our parent DrawBatch() */
+		Blitter_32bppSSE4::DrawBatch(entries, zoom);
+		return;
+	}
+
+	for (BatchEntry &entry : entries) Blitter_32bppSSE4_Anim::Draw(&entry.bp, entry.mode, zoom);
+}
+
 #endif /* WITH_SSE */
@@ -12,6 +12,7 @@
 #include "../settings_type.h"
 #include "../palette_func.h"
 #include "32bpp_optimized.hpp"
+#include "common.hpp"
 
 #include "../citymania/cm_colour.hpp"
 
@@ -307,6 +308,31 @@ void Blitter_32bppOptimized::Draw(Blitter::BlitterParams *bp, BlitterMode mode,
 template void Blitter_32bppOptimized::Draw<true>(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom);
 template void Blitter_32bppOptimized::Draw<false>(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom);
 
+template <bool Tpal_to_rgb>
+void Blitter_32bppOptimized::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	ForEachBlitterModeRun(entries, [this, zoom](BlitterMode mode, std::span<BatchEntry> run) {
+		switch (mode) {
+			default: NOT_REACHED();
+			case BM_NORMAL:       for (const BatchEntry &entry : run) Draw<BM_NORMAL, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case BM_COLOUR_REMAP: for (const BatchEntry &entry : run) Draw<BM_COLOUR_REMAP, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case CM_BM_TINT_REMAP: for (const BatchEntry &entry : run) Draw<CM_BM_TINT_REMAP, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case BM_TRANSPARENT:  for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case BM_TRANSPARENT_REMAP: for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT_REMAP, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case BM_CRASH_REMAP:  for (const BatchEntry &entry : run) Draw<BM_CRASH_REMAP, Tpal_to_rgb>(&entry.bp, zoom); return;
+			case BM_BLACK_REMAP:  for (const BatchEntry &entry : run) Draw<BM_BLACK_REMAP, Tpal_to_rgb>(&entry.bp, zoom); return;
+		}
+	});
+}
+
+template void Blitter_32bppOptimized::DrawBatch<true>(std::span<BatchEntry> entries, ZoomLevel zoom);
+template void Blitter_32bppOptimized::DrawBatch<false>(std::span<BatchEntry> entries, ZoomLevel zoom);
+
+void Blitter_32bppOptimized::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	this->DrawBatch<false>(entries, zoom);
+}
+
 /**
  * Draws a sprite to a (screen) buffer. Calls adequate templated function.
  *
@@ -30,6 +30,7 @@
 class Blitter_32bppSSE4 : public Blitter_32bppSSSE3 {
 public:
 	void Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom) override;
+	void DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom) override;
 	template <BlitterMode mode, Blitter_32bppSSE_Base::ReadMode read_mode, Blitter_32bppSSE_Base::BlockType bt_last, bool translucent>
 	void Draw(const Blitter::BlitterParams *bp, ZoomLevel zoom);
 	const char *GetName() override { return "32bpp-sse4"; }
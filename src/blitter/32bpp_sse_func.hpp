@@ -488,6 +488,31 @@ bm_normal:
 		case BM_BLACK_REMAP:  Draw<BM_BLACK_REMAP, RM_NONE, BT_NONE, true>(bp, zoom); return;
 	}
 }
+
+/**
+ * Draws a batch of sprites to a (screen) buffer.
+ * The read mode depends on each sprite, so every sprite goes through the dispatcher above,
+ * but it is called directly instead of through the vtable.
+ *
+ * @param entries the sprites to draw
+ * @param zoom zoom level at which we are drawing
+ */
+#if (SSE_VERSION == 2)
+void Blitter_32bppSSE2::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	for (BatchEntry &entry : entries) Blitter_32bppSSE2::Draw(&entry.bp, entry.mode, zoom);
+}
+#elif (SSE_VERSION == 3)
+void Blitter_32bppSSSE3::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	for (BatchEntry &entry : entries) Blitter_32bppSSSE3::Draw(&entry.bp, entry.mode, zoom);
+}
+#elif (SSE_VERSION == 4)
+void Blitter_32bppSSE4::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	for (BatchEntry &entry : entries) Blitter_32bppSSE4::Draw(&entry.bp, entry.mode, zoom);
+}
+#endif
 #endif /* FULL_ANIMATION */
 
 #endif /* WITH_SSE */
@@ -361,6 +361,36 @@ void Blitter_40bppAnim::Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomL
 	}
 }
 
+/**
+ * Draws a batch of sprites to a (screen) buffer, dispatching on the blitter mode once per run of sprites sharing it.
+ *
+ * @param entries the sprites to draw
+ * @param zoom zoom level at which we are drawing
+ */
+void Blitter_40bppAnim::DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+{
+	assert(_screen.dst_ptr != nullptr);
+
+	if (_screen_disable_anim || VideoDriver::GetInstance()->GetAnimBuffer() == nullptr) {
+		/* This means our output is not to the screen, so we can't be doing any animation stuff, so use our parent DrawBatch() */
+		Blitter_32bppOptimized::DrawBatch<true>(entries, zoom);
+		return;
+	}
+
+	ForEachBlitterModeRun(entries, [this, zoom](BlitterMode mode, std::span<BatchEntry> run) {
+		switch (mode) {
+			default: NOT_REACHED();
+			case BM_NORMAL:       for (const BatchEntry &entry : run) Draw<BM_NORMAL>      (&entry.bp, zoom); return;
+			case BM_COLOUR_REMAP: for (const BatchEntry &entry : run) Draw<BM_COLOUR_REMAP>(&entry.bp, zoom); return;
+			case CM_BM_TINT_REMAP: for (const BatchEntry &entry : run) Draw<CM_BM_TINT_REMAP>(&entry.bp, zoom); return;
+			case BM_TRANSPARENT:  for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT> (&entry.bp, zoom); return;
+			case BM_TRANSPARENT_REMAP: for (const BatchEntry &entry : run) Draw<BM_TRANSPARENT_REMAP>(&entry.bp, zoom); return;
+			case BM_CRASH_REMAP:  for (const BatchEntry &entry : run) Draw<BM_CRASH_REMAP> (&entry.bp, zoom); return;
+			case BM_BLACK_REMAP:  for (const BatchEntry &entry : run) Draw<BM_BLACK_REMAP> (&entry.bp, zoom); return;
+		}
+	});
+}
+
 void Blitter_40bppAnim::DrawColourMappingRect(void *dst, int width, int height, PaletteID pal)
 {
 	if (_screen_disable_anim) {
@@ -47,6 +47,12 @@ public:
 		int pitch;          ///< The pitch of the destination buffer
 	};
 
+	/** A single already clipped sprite of a batch passed to DrawBatch(). */
+	struct BatchEntry {
+		BlitterParams bp;   ///< Blitting parameters, including the resolved remap.
+		BlitterMode mode;   ///< The mode to blit the sprite with.
+	};
+
 	/** Types of palette animation. */
 	enum PaletteAnimation {
 		PALETTE_ANIMATION_NONE,           ///< No palette animation
@@ -70,6 +76,18 @@ public:
 	 */
 	virtual void Draw(Blitter::BlitterParams *bp, BlitterMode mode, ZoomLevel zoom) = 0;
 
+	/**
+	 * Draw a batch of already clipped images to the screen, in order.
+	 * All entries share the same destination and zoom level, so blitters can
+	 *  keep per-destination and per-remap state around between entries.
+	 * @param entries The images to draw.
+	 * @param zoom The zoom level all images are drawn at.
+	 */
+	virtual void DrawBatch(std::span<BatchEntry> entries, ZoomLevel zoom)
+	{
+		for (BatchEntry &entry : entries) this->Draw(&entry.bp, entry.mode, zoom);
+	}
+
 	/**
 	 * Draw a colourtable to the screen. This is: the colour of the screen is read
 	 *  and is looked-up in the palette to match a new colour, which then is put
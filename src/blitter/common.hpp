@@ -15,6 +15,23 @@
 
 #include <utility>
 
+/**
+ * Split a batch of sprites into runs of consecutive sprites drawn with the same blitter mode,
+ * so blitters only have to dispatch on the mode once per run.
+ * @param entries The sprites of the batch.
+ * @param draw_run Function called with the mode and the sprites of each run, in order.
+ */
+template <typename DrawRunT>
+void ForEachBlitterModeRun(std::span<Blitter::BatchEntry> entries, DrawRunT draw_run)
+{
+	for (auto first = entries.begin(); first != entries.end();) {
+		BlitterMode mode = first->mode;
+		auto last = std::find_if(first, entries.end(), [mode](const Blitter::BatchEntry &entry) { return entry.mode != mode; });
+		draw_run(mode, std::span<Blitter::BatchEntry>(first, last));
+		first = last;
+	}
+}
+
 template <typename SetPixelT>
 void Blitter::DrawLineGeneric(int x1, int y1, int x2, int y2, int screen_width, int screen_height, int width, int dash, SetPixelT set_pixel)
 {
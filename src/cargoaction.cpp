@@ -205,9 +205,8 @@ bool StationCargoReroute::operator()(CargoPacket *cp)
 		this->destination->AddToCache(cp_new);
 	}
 
-	/* Legal, as insert doesn't invalidate iterators in the MultiMap, however
-	 * this might insert the packet between range.first and range.second (which might be end())
-	 * This is why we check for GetKey above to avoid infinite loops. */
+	/* Legal, as the packet never goes into the range being rerouted and
+	 * inserting into other ranges of the MultiMap doesn't invalidate it. */
 	this->destination->packets.Insert(next, cp_new);
 	return cp_new == cp;
 }
@@ -229,8 +228,8 @@ bool VehicleCargoReroute::operator()(CargoPacket *cp)
 		this->destination->AddToMeta(cp_new, VehicleCargoList::MTA_TRANSFER);
 	}
 
-	/* Legal, as front pushing doesn't invalidate iterators in std::list. */
-	this->destination->packets.push_front(cp_new);
+	/* The source may be the destination, so only collect the packet here. */
+	this->rerouted.push_back(cp_new);
 	return cp_new == cp;
 }
 
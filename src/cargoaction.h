@@ -137,9 +137,11 @@ public:
 
 /** Action of rerouting cargo staged for transfer in a vehicle. */
 class VehicleCargoReroute : public CargoReroute<VehicleCargoList> {
+protected:
+	CargoPacketList &rerouted; ///< Rerouted packets, to be prepended to the destination in reverse order.
 public:
-	VehicleCargoReroute(VehicleCargoList *source, VehicleCargoList *dest, uint max_move, StationID avoid, StationID avoid2, const GoodsEntry *ge) :
-			CargoReroute<VehicleCargoList>(source, dest, max_move, avoid, avoid2, ge)
+	VehicleCargoReroute(VehicleCargoList *source, VehicleCargoList *dest, uint max_move, StationID avoid, StationID avoid2, const GoodsEntry *ge, CargoPacketList &rerouted) :
+			CargoReroute<VehicleCargoList>(source, dest, max_move, avoid, avoid2, ge), rerouted(rerouted)
 	{
 		assert(this->max_move <= source->ActionCount(VehicleCargoList::MTA_TRANSFER));
 	}
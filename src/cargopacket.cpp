@@ -294,15 +294,13 @@ void VehicleCargoList::Append(CargoPacket *cp, MoveToAction action)
 template<class Taction>
 void VehicleCargoList::ShiftCargo(Taction action)
 {
-	Iterator it(this->packets.begin());
-	while (it != this->packets.end() && action.MaxMove() > 0) {
-		CargoPacket *cp = *it;
-		if (action(cp)) {
-			it = this->packets.erase(it);
-		} else {
-			break;
-		}
+	/* Erase the shifted packets in one go once the action is done with them. */
+	size_t shifted = 0;
+	while (shifted < this->packets.size() && action.MaxMove() > 0) {
+		if (!action(this->packets[shifted])) break;
+		++shifted;
 	}
+	this->packets.erase(this->packets.begin(), this->packets.begin() + shifted);
 }
 
 /**
@@ -316,21 +314,9 @@ void VehicleCargoList::ShiftCargo(Taction action)
 template<class Taction>
 void VehicleCargoList::PopCargo(Taction action)
 {
-	if (this->packets.empty()) return;
-	Iterator it(--(this->packets.end()));
-	Iterator begin(this->packets.begin());
-	while (action.MaxMove() > 0) {
-		CargoPacket *cp = *it;
-		if (action(cp)) {
-			if (it != begin) {
-				this->packets.erase(it--);
-			} else {
-				this->packets.erase(it);
-				break;
-			}
-		} else {
-			break;
-		}
+	while (!this->packets.empty() && action.MaxMove() > 0) {
+		if (!action(this->packets.back())) break;
+		this->packets.pop_back();
 	}
 }
 
@@ -441,18 +427,20 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 	this->AssertCountConsistency();
 	assert(this->action_counts[MTA_LOAD] == 0);
 	this->action_counts[MTA_TRANSFER] = this->action_counts[MTA_DELIVER] = this->action_counts[MTA_KEEP] = 0;
-	Iterator deliver = this->packets.end();
-	Iterator it = this->packets.begin();
-	uint sum = 0;
+
+	/* Sort the packets into their chunks and put the list back together afterwards. */
+	CargoPacketList transfer;
+	CargoPacketList deliver;
+	CargoPacketList keep;
+	transfer.reserve(this->packets.size());
+	deliver.reserve(this->packets.size());
+	keep.reserve(this->packets.size());
 
 	bool force_keep = (order_flags & OUFB_NO_UNLOAD) != 0;
 	bool force_unload = (order_flags & OUFB_UNLOAD) != 0;
 	bool force_transfer = (order_flags & (OUFB_TRANSFER | OUFB_UNLOAD)) != 0;
-	assert(this->count > 0 || it == this->packets.end());
-	while (sum < this->count) {
-		CargoPacket *cp = *it;
-
-		this->packets.erase(it++);
+	assert(this->count > 0 || this->packets.empty());
+	for (CargoPacket *cp : this->packets) {
 		StationID cargo_next = INVALID_STATION;
 		MoveToAction action = MTA_LOAD;
 		if (force_keep) {
@@ -503,14 +491,13 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 		Money share;
 		switch (action) {
 			case MTA_KEEP:
-				this->packets.push_back(cp);
-				if (deliver == this->packets.end()) --deliver;
+				keep.push_back(cp);
 				break;
 			case MTA_DELIVER:
-				this->packets.insert(deliver, cp);
+				deliver.push_back(cp);
 				break;
 			case MTA_TRANSFER:
-				this->packets.push_front(cp);
+				transfer.push_back(cp);
 				/* Add feeder share here to allow reusing field for next station. */
 				share = payment->PayTransfer(cp, cp->count, current_tile);
 				cp->AddFeederShare(share);
@@ -521,8 +508,12 @@ bool VehicleCargoList::Stage(bool accepted, StationID current_station, StationID
 				NOT_REACHED();
 		}
 		this->action_counts[action] += cp->count;
-		sum += cp->count;
 	}
+
+	/* Packets to be transferred are prepended one after another, so they end up in reverse order. */
+	this->packets.assign(transfer.rbegin(), transfer.rend());
+	this->packets.insert(this->packets.end(), deliver.begin(), deliver.end());
+	this->packets.insert(this->packets.end(), keep.begin(), keep.end());
 	this->AssertCountConsistency();
 	return this->action_counts[MTA_DELIVER] > 0 || this->action_counts[MTA_TRANSFER] > 0;
 }
@@ -569,14 +560,14 @@ uint VehicleCargoList::Reassign<VehicleCargoList::MTA_DELIVER, VehicleCargoList:
 	max_move = std::min(this->action_counts[MTA_DELIVER], max_move);
 
 	uint sum = 0;
-	for (Iterator it(this->packets.begin()); sum < this->action_counts[MTA_TRANSFER] + max_move;) {
-		CargoPacket *cp = *it++;
+	for (size_t i = 0; sum < this->action_counts[MTA_TRANSFER] + max_move;) {
+		CargoPacket *cp = this->packets[i++];
 		sum += cp->Count();
 		if (sum <= this->action_counts[MTA_TRANSFER]) continue;
 		if (sum > this->action_counts[MTA_TRANSFER] + max_move) {
 			CargoPacket *cp_split = cp->Split(sum - this->action_counts[MTA_TRANSFER] + max_move);
 			sum -= cp_split->Count();
-			this->packets.insert(it, cp_split);
+			this->packets.insert(this->packets.begin() + i++, cp_split);
 		}
 		cp->next_hop = INVALID_STATION;
 	}
@@ -663,7 +654,9 @@ uint VehicleCargoList::Truncate(uint max_move)
 uint VehicleCargoList::Reroute(uint max_move, VehicleCargoList *dest, StationID avoid, StationID avoid2, const GoodsEntry *ge)
 {
 	max_move = std::min(this->action_counts[MTA_TRANSFER], max_move);
-	this->ShiftCargo(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge));
+	CargoPacketList rerouted;
+	this->ShiftCargo(VehicleCargoReroute(this, dest, max_move, avoid, avoid2, ge, rerouted));
+	dest->packets.insert(dest->packets.begin(), rerouted.rbegin(), rerouted.rend());
 	return max_move;
 }
 
@@ -711,17 +704,23 @@ void StationCargoList::Append(CargoPacket *cp, StationID next)
 template <class Taction>
 bool StationCargoList::ShiftCargo(Taction &action, StationID next)
 {
-	std::pair<Iterator, Iterator> range(this->packets.equal_range(next));
-	for (Iterator it(range.first); it != range.second && it.GetKey() == next;) {
-		if (action.MaxMove() == 0) return false;
-		CargoPacket *cp = *it;
-		if (action(cp)) {
-			it = this->packets.erase(it);
-		} else {
-			return false;
+	StationCargoPacketMap::MapIterator range = this->packets.find(next);
+	if (range == this->packets.end()) return true;
+
+	/* Erase the shifted packets in one go once the action is done with them. */
+	StationCargoPacketMap::List &list = range->second;
+	size_t shifted = 0;
+	bool all = true;
+	while (shifted < list.size()) {
+		if (action.MaxMove() == 0 || !action(list[shifted])) {
+			all = false;
+			break;
 		}
+		++shifted;
 	}
-	return true;
+	list.erase(list.begin(), list.begin() + shifted);
+	if (list.empty()) this->packets.Map::erase(range);
+	return all;
 }
 
 /**
@@ -768,38 +767,53 @@ uint StationCargoList::Truncate(uint max_move, StationCargoAmountMap *cargo_per_
 	uint loop = 0;
 	bool do_count = cargo_per_source != nullptr;
 	while (max_move > moved) {
-		for (Iterator it(this->packets.begin()); it != this->packets.end();) {
-			CargoPacket *cp = *it;
-			if (prev_count > max_move && RandomRange(prev_count) < prev_count - max_move) {
-				if (do_count && loop == 0) {
-					(*cargo_per_source)[cp->first_station] += cp->count;
+		for (StationCargoPacketMap::MapIterator range = this->packets.begin(); range != this->packets.end();) {
+			/* Compact each list in place instead of erasing the removed packets one by one. */
+			StationCargoPacketMap::List &list = range->second;
+			auto kept = list.begin();
+			bool done = false;
+			for (CargoPacket *cp : list) {
+				if (done) {
+					*kept++ = cp;
+					continue;
 				}
-				++it;
-				continue;
-			}
-			uint diff = max_move - moved;
-			if (cp->count > diff) {
-				if (diff > 0) {
-					this->RemoveFromCache(cp, diff);
-					cp->Reduce(diff);
-					moved += diff;
+				if (prev_count > max_move && RandomRange(prev_count) < prev_count - max_move) {
+					if (do_count && loop == 0) {
+						(*cargo_per_source)[cp->first_station] += cp->count;
+					}
+					*kept++ = cp;
+					continue;
 				}
-				if (loop > 0) {
-					if (do_count) (*cargo_per_source)[cp->first_station] -= diff;
-					return moved;
+				uint diff = max_move - moved;
+				if (cp->count > diff) {
+					if (diff > 0) {
+						this->RemoveFromCache(cp, diff);
+						cp->Reduce(diff);
+						moved += diff;
+					}
+					if (loop > 0) {
+						if (do_count) (*cargo_per_source)[cp->first_station] -= diff;
+						done = true;
+					} else {
+						if (do_count) (*cargo_per_source)[cp->first_station] += cp->count;
+					}
+					*kept++ = cp;
 				} else {
-					if (do_count) (*cargo_per_source)[cp->first_station] += cp->count;
-					++it;
+					if (do_count && loop > 0) {
+						(*cargo_per_source)[cp->first_station] -= cp->count;
+					}
+					moved += cp->count;
+					this->RemoveFromCache(cp, cp->count);
+					delete cp;
 				}
+			}
+			list.erase(kept, list.end());
+			if (list.empty()) {
+				range = this->packets.Map::erase(range);
 			} else {
-				it = this->packets.erase(it);
-				if (do_count && loop > 0) {
-					(*cargo_per_source)[cp->first_station] -= cp->count;
-				}
-				moved += cp->count;
-				this->RemoveFromCache(cp, cp->count);
-				delete cp;
+				++range;
 			}
+			if (done) return moved;
 		}
 		loop++;
 	}
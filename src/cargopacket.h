@@ -303,8 +303,8 @@ public:
 	};
 
 protected:
-	uint count;                   ///< Cache for the number of cargo entities.
-	uint64_t cargo_periods_in_transit; ///< Cache for the sum of number of cargo aging periods in transit of each entity; comparable to man-hours.
+	uint count{0};                   ///< Cache for the number of cargo entities.
+	uint64_t cargo_periods_in_transit{0}; ///< Cache for the sum of number of cargo aging periods in transit of each entity; comparable to man-hours.
 
 	Tcont packets;              ///< The cargo packets in this list.
 
@@ -343,7 +343,7 @@ public:
 	void InvalidateCache();
 };
 
-typedef std::list<CargoPacket *> CargoPacketList;
+typedef std::vector<CargoPacket *> CargoPacketList;
 
 /**
  * CargoList that is used for vehicles.
@@ -353,8 +353,8 @@ protected:
 	/** The (direct) parent of this class. */
 	typedef CargoList<VehicleCargoList, CargoPacketList> Parent;
 
-	Money feeder_share;                     ///< Cache for the feeder share.
-	uint action_counts[NUM_MOVE_TO_ACTION]; ///< Counts of cargo to be transferred, delivered, kept and loaded.
+	Money feeder_share{0};                     ///< Cache for the feeder share.
+	uint action_counts[NUM_MOVE_TO_ACTION]{}; ///< Counts of cargo to be transferred, delivered, kept and loaded.
 
 	template<class Taction>
 	void ShiftCargo(Taction action);
@@ -531,7 +531,7 @@ protected:
 	/** The (direct) parent of this class. */
 	typedef CargoList<StationCargoList, StationCargoPacketMap> Parent;
 
-	uint reserved_count; ///< Amount of cargo being reserved for loading.
+	uint reserved_count{0}; ///< Amount of cargo being reserved for loading.
 
 public:
 	/** The super class ought to know what it's doing. */
@@ -8,6 +8,7 @@
 #define CM_SLE_VAR(name, base, variable, type) CM_SLE_GENERAL(name, SL_VAR, base, variable, type, 0, SLV_TABLE_CHUNKS, SL_MAX_VERSION, 0)
 #define CM_SLE_VAR(name, base, variable, type) CM_SLE_GENERAL(name, SL_VAR, base, variable, type, 0, SLV_TABLE_CHUNKS, SL_MAX_VERSION, 0)
 #define CM_SLE_ARR(name, base, variable, type, length) CM_SLE_GENERAL(name, SL_ARR, base, variable, type, length, SLV_TABLE_CHUNKS, SL_MAX_VERSION, 0)
+#define CM_SLE_VECTOR(name, base, variable, type) CM_SLE_GENERAL(name, SL_VECTOR, base, variable, type, 0, SLV_TABLE_CHUNKS, SL_MAX_VERSION, 0)
 
 
 namespace citymania {
@@ -61,10 +61,16 @@ struct CBSettings {
     bool allow_negative_growth;  // Make town shrink (with the same speed as growth) if requirements aren't satisfied
 };
 
+struct LinkGraphSettings {
+    bool mcf_flat_dijkstra;  // Use the indexed heap and recycled path annotations in the MCF Dijkstra searches
+    uint8_t recalc_tolerance;  // Change of supply or link capacity in percent up to which flows aren't recalculated; 0 always recalculates all flows
+};
+
 struct Settings {
     CBSettings cb;
     EconomySettings economy;
     LimitsSettings limits;
+    LinkGraphSettings linkgraph;
 
     GameType game_type;  // GameType
     ControllerType controller_type;  // ControllerType
@@ -300,6 +300,70 @@ static void TileLoop_Clear(TileIndex tile)
 	MarkTileDirtyByTile(tile);
 }
 
+/** Plans of TileLoopPlan_Clear. */
+enum ClearTileLoopPlan : uint8_t {
+	CTLP_NOTHING = 1, ///< Nothing changes.
+	CTLP_COUNTER,     ///< The grass counter increases.
+	CTLP_DENSITY,     ///< The grass counter wraps and the grass grows denser.
+};
+
+/**
+ * Plan the tile loop of a clear tile. Only grass growth, which just looks at
+ * the tile itself, is planned. Snow, desert, fields and the editor run the
+ * tile loop as usual.
+ * @param tile The tile to plan for.
+ * @return The plan.
+ */
+static uint8_t TileLoopPlan_Clear(TileIndex tile)
+{
+	if (_game_mode == GM_EDITOR || HasGrfMiscBit(GMB_AMBIENT_SOUND_CALLBACK)) return TILE_LOOP_RUN;
+
+	switch (_settings_game.game_creation.landscape) {
+		case LT_TROPIC:
+			if (GetTropicZone(tile) == TROPICZONE_DESERT || IsClearGround(tile, CLEAR_DESERT)) return TILE_LOOP_RUN;
+			break;
+
+		case LT_ARCTIC:
+			if (IsSnowTile(tile) || GetTileZ(tile) - GetSnowLine() + 1 >= 0) return TILE_LOOP_RUN;
+			break;
+	}
+
+	switch (GetClearGround(tile)) {
+		case CLEAR_GRASS:
+			if (GetClearDensity(tile) == 3) return CTLP_NOTHING;
+			return GetClearCounter(tile) < 7 ? CTLP_COUNTER : CTLP_DENSITY;
+
+		case CLEAR_FIELDS:
+			return TILE_LOOP_RUN;
+
+		default:
+			return CTLP_NOTHING;
+	}
+}
+
+/**
+ * Carry out a plan of TileLoopPlan_Clear, like TileLoop_Clear would have done.
+ * @param tile The tile to change.
+ * @param plan The plan.
+ */
+static void TileLoopApply_Clear(TileIndex tile, uint8_t plan)
+{
+	switch (plan) {
+		case CTLP_COUNTER:
+			AddClearCounter(tile, 1);
+			break;
+
+		case CTLP_DENSITY:
+			SetClearCounter(tile, 0);
+			AddClearDensity(tile, 1);
+			MarkTileDirtyByTile(tile);
+			break;
+
+		default:
+			break;
+	}
+}
+
 void GenerateClearTile()
 {
 	uint i, gi;
@@ -390,4 +454,6 @@ extern const TileTypeProcs _tile_type_clear_procs = {
 	nullptr,                     ///< vehicle_enter_tile_proc
 	GetFoundation_Clear,      ///< get_foundation_proc
 	TerraformTile_Clear,      ///< terraform_tile_proc
+	TileLoopPlan_Clear,       ///< tile_loop_plan_proc
+	TileLoopApply_Clear,      ///< tile_loop_apply_proc
 };
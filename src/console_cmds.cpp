@@ -45,6 +45,16 @@
 #include "3rdparty/fmt/chrono.h"
 #include "company_cmd.h"
 #include "misc_cmd.h"
+#include "train.h"
+#include "pathfinder/yapf/yapf.h"
+#include "linkgraph/linkgraphjob.h"
+#include "linkgraph/init.h"
+#include "linkgraph/demands.h"
+#include "linkgraph/mcf.h"
+#include "linkgraph/flowmapper.h"
+#include "station_base.h"
+#include "core/random_func.hpp"
+#include "vehicle_func.h"
 
 #include <sstream>
 
@@ -1575,13 +1585,14 @@ DEF_CONSOLE_CMD(ConAlias)
 DEF_CONSOLE_CMD(ConScreenShot)
 {
 	if (argc == 0) {
-		IConsolePrint(CC_HELP, "Create a screenshot of the game. Usage: 'screenshot [viewport | normal | big | giant | heightmap | minimap] [no_con] [size <width> <height>] [<filename>]'.");
+		IConsolePrint(CC_HELP, "Create a screenshot of the game. Usage: 'screenshot [viewport | normal | big | giant | heightmap | minimap | tiles] [no_con] [size <width> <height>] [<filename>]'.");
 		IConsolePrint(CC_HELP, "  'viewport' (default) makes a screenshot of the current viewport (including menus, windows).");
 		IConsolePrint(CC_HELP, "  'normal' makes a screenshot of the visible area.");
 		IConsolePrint(CC_HELP, "  'big' makes a zoomed-in screenshot of the visible area.");
 		IConsolePrint(CC_HELP, "  'giant' makes a screenshot of the whole map.");
 		IConsolePrint(CC_HELP, "  'heightmap' makes a heightmap screenshot of the map that can be loaded in as heightmap.");
 		IConsolePrint(CC_HELP, "  'minimap' makes a top-viewed minimap screenshot of the whole world which represents one tile by one pixel.");
+		IConsolePrint(CC_HELP, "  'tiles' exports the whole map as a z/x/y pyramid of 256x256 tiles for web map viewers into a directory named after the file name. Later exports only render the tiles where the map changed.");
 		IConsolePrint(CC_HELP, "  'no_con' hides the console to create the screenshot (only useful in combination with 'viewport').");
 		IConsolePrint(CC_HELP, "  'size' sets the width and height of the viewport to make a screenshot of (only useful in combination with 'normal' or 'big').");
 		IConsolePrint(CC_HELP, "  A filename ending in # will prevent overwriting existing files and will number files counting upwards.");
@@ -1615,6 +1626,9 @@ DEF_CONSOLE_CMD(ConScreenShot)
 		} else if (strcmp(argv[arg_index], "minimap") == 0) {
 			type = SC_MINIMAP;
 			arg_index += 1;
+		} else if (strcmp(argv[arg_index], "tiles") == 0) {
+			type = SC_TILES;
+			arg_index += 1;
 		}
 	}
 
@@ -1649,7 +1663,18 @@ DEF_CONSOLE_CMD(ConScreenShot)
 		return false;
 	}
 
-	MakeScreenshot(type, name, width, height);
+	ScreenshotProgressCallback progress;
+	if (type == SC_WORLD) {
+		/* Giant screenshots can take a while; report every 10%. */
+		progress = [last = 0U](uint done, uint total) mutable {
+			uint percent = static_cast<uint>(static_cast<uint64_t>(done) * 100 / total);
+			if (percent / 10 == last / 10 && done != total) return;
+			last = percent;
+			IConsolePrint(CC_INFO, "Screenshot {}% done.", percent);
+		};
+	}
+
+	MakeScreenshot(type, name, width, height, progress);
 	return true;
 }
 
@@ -2302,6 +2327,8 @@ DEF_CONSOLE_CMD(ConNewGRFProfile)
 		IConsolePrint(CC_HELP, "  End profiling and write the collected data to CSV files.");
 		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile abort':");
 		IConsolePrint(CC_HELP, "  End profiling and discard all collected data.");
+		IConsolePrint(CC_HELP, "Usage: 'newgrf_profile benchmark [<iterations>]':");
+		IConsolePrint(CC_HELP, "  Measure the throughput of resolving all industry tile sprites, without the resolution cache.");
 		return true;
 	}
 
@@ -2404,6 +2431,12 @@ DEF_CONSOLE_CMD(ConNewGRFProfile)
 		return true;
 	}
 
+	/* "benchmark" sub-command */
+	if (StrStartsWithIgnoreCase(argv[1], "ben")) {
+		NewGRFProfiler::Benchmark(argc >= 3 ? std::max(atoi(argv[2]), 1) : 10);
+		return true;
+	}
+
 	return false;
 }
 
@@ -2447,6 +2480,221 @@ DEF_CONSOLE_CMD(ConFramerateWindow)
 	return true;
 }
 
+DEF_CONSOLE_CMD(ConYapfBenchmark)
+{
+	if (argc == 0 || argc > 2) {
+		IConsolePrint(CC_HELP, "Measure the rail pathfinder on the current game. Usage: 'yapf_benchmark [<rounds>]'.");
+		IConsolePrint(CC_HELP, "Every round searches the path of each train once, without reserving anything.");
+		return true;
+	}
+
+	uint32_t rounds = 10;
+	if (argc == 2 && (!GetArgumentInteger(&rounds, argv[1]) || rounds == 0)) {
+		IConsolePrint(CC_ERROR, "Invalid number of rounds.");
+		return false;
+	}
+
+	std::vector<const Train *> trains;
+	for (const Train *t : Train::Iterate()) {
+		if (t->IsFrontEngine() && !t->IsInDepot() && (t->vehstatus & VS_CRASHED) == 0) trains.push_back(t);
+	}
+	if (trains.empty()) {
+		IConsolePrint(CC_ERROR, "There are no trains to route.");
+		return false;
+	}
+
+	uint found = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (uint32_t i = 0; i < rounds; i++) {
+		for (const Train *t : trains) {
+			bool path_found = false;
+			YapfTrainChooseTrack(t, t->tile, INVALID_DIAGDIR, TRACK_BIT_NONE, path_found, false, nullptr, nullptr);
+			if (path_found) found++;
+		}
+	}
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+	uint64_t searches = static_cast<uint64_t>(rounds) * trains.size();
+	IConsolePrint(CC_INFO, "{} searches for {} trains in {} ms, {} paths found.", searches, trains.size(), elapsed.count() / 1000, found);
+	IConsolePrint(CC_INFO, "{:.1f} us per search, {:.0f} searches per second.",
+			static_cast<double>(elapsed.count()) / searches, elapsed.count() > 0 ? searches * 1000000.0 / elapsed.count() : 0.0);
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConLinkGraphBenchmark)
+{
+	if (argc == 0 || argc > 2) {
+		IConsolePrint(CC_HELP, "Measure the cargo distribution solver on the current game. Usage: 'linkgraph_benchmark [<rounds>]'.");
+		IConsolePrint(CC_HELP, "Every round calculates a copy of each link graph twice, with the plain and with the flat Dijkstra search, and compares the resulting flows.");
+		return true;
+	}
+
+	uint32_t rounds = 3;
+	if (argc == 2 && (!GetArgumentInteger(&rounds, argv[1]) || rounds == 0)) {
+		IConsolePrint(CC_ERROR, "Invalid number of rounds.");
+		return false;
+	}
+
+	std::vector<const LinkGraph *> graphs;
+	uint nodes = 0;
+	for (const LinkGraph *lg : LinkGraph::Iterate()) {
+		if (lg->Size() < 2) continue;
+		graphs.push_back(lg);
+		nodes += lg->Size();
+	}
+	if (graphs.empty()) {
+		IConsolePrint(CC_ERROR, "There are no link graphs to calculate.");
+		return false;
+	}
+
+	std::chrono::microseconds elapsed[2] = {};
+	bool identical = true;
+	for (uint32_t i = 0; i < rounds; i++) {
+		for (const LinkGraph *lg : graphs) {
+			/* Without a valid link graph the job doesn't write its results back. */
+			LinkGraph copy(*lg);
+			copy.index = INVALID_LINK_GRAPH;
+
+			std::vector<uint> flows[2];
+			for (int flat = 0; flat < 2; flat++) {
+				/* Not part of the pool, so it doesn't take the place of a real job. */
+				LinkGraphJob job(copy);
+
+				InitHandler().Run(job);
+				DemandHandler().Run(job);
+				auto start = std::chrono::steady_clock::now();
+				MCF1stPass(job, flat != 0);
+				FlowMapper(false).Run(job);
+				MCF2ndPass(job, flat != 0);
+				FlowMapper(true).Run(job);
+				elapsed[flat] += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+				for (NodeID node = 0; node < job.Size(); node++) {
+					for (const auto &edge : job[node].edges) flows[flat].push_back(edge.Flow());
+				}
+			}
+			if (flows[0] != flows[1]) identical = false;
+		}
+	}
+
+	uint64_t runs = static_cast<uint64_t>(rounds) * graphs.size();
+	IConsolePrint(CC_INFO, "{} link graphs with {} nodes, {} rounds.", graphs.size(), nodes, rounds);
+	IConsolePrint(CC_INFO, "Dijkstra: {} ms, {:.1f} ms per link graph.", elapsed[0].count() / 1000, elapsed[0].count() / 1000.0 / runs);
+	IConsolePrint(CC_INFO, "Flat Dijkstra: {} ms, {:.1f} ms per link graph.", elapsed[1].count() / 1000, elapsed[1].count() / 1000.0 / runs);
+	if (identical) {
+		IConsolePrint(CC_INFO, "Both produced the same flows.");
+	} else {
+		IConsolePrint(CC_ERROR, "The flows differ.");
+	}
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConCargoBenchmark)
+{
+	if (argc == 0 || argc > 2) {
+		IConsolePrint(CC_HELP, "Measure cargo loading and unloading on the current game. Usage: 'cargo_benchmark [<rounds>]'.");
+		IConsolePrint(CC_HELP, "Every round reserves the waiting cargo of a copy of each station for a vehicle and returns it, one next hop at a time. Finally half of the copied cargo is truncated.");
+		return true;
+	}
+
+	uint32_t rounds = 10;
+	if (argc == 2 && (!GetArgumentInteger(&rounds, argv[1]) || rounds == 0)) {
+		IConsolePrint(CC_ERROR, "Invalid number of rounds.");
+		return false;
+	}
+
+	/* Truncating picks random packets; don't let that affect the game. */
+	SavedRandomSeeds saved_seeds;
+	SaveRandomSeeds(&saved_seeds);
+
+	std::chrono::microseconds elapsed_move{};
+	std::chrono::microseconds elapsed_truncate{};
+	uint lists = 0;
+	uint64_t moved = 0;
+	for (const Station *st : Station::Iterate()) {
+		for (const GoodsEntry &ge : st->goods) {
+			if (ge.cargo.AvailableCount() == 0) continue;
+
+			/* Work on copies of the packets, so that the station itself isn't touched. */
+			StationCargoList copy;
+			std::vector<std::pair<StationID, uint>> hops;
+			for (const auto &[next, packets] : *ge.cargo.Packets()) {
+				uint amount = 0;
+				for (CargoPacket *cp : packets) {
+					if (!CargoPacket::CanAllocateItem()) {
+						IConsolePrint(CC_ERROR, "Too many cargo packets to copy.");
+						RestoreRandomSeeds(saved_seeds);
+						return false;
+					}
+					copy.Append(new CargoPacket(cp->Count(), cp->GetFeederShare(), *cp), next);
+					amount += cp->Count();
+				}
+				hops.emplace_back(next, amount);
+			}
+			lists++;
+
+			VehicleCargoList vehicle;
+			auto start = std::chrono::steady_clock::now();
+			for (uint32_t i = 0; i < rounds; i++) {
+				for (const auto &[next, amount] : hops) {
+					/* Reserve only the hop's own cargo, not the one that can go anywhere. */
+					uint reserved = copy.Reserve(amount, &vehicle, StationIDStack(next), st->xy);
+					vehicle.Return(reserved, &copy, next, st->xy);
+					moved += reserved;
+				}
+			}
+			elapsed_move += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+			start = std::chrono::steady_clock::now();
+			copy.Truncate(copy.AvailableCount() / 2);
+			elapsed_truncate += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+		}
+	}
+	RestoreRandomSeeds(saved_seeds);
+
+	if (lists == 0) {
+		IConsolePrint(CC_ERROR, "There is no cargo waiting at any station.");
+		return false;
+	}
+
+	IConsolePrint(CC_INFO, "{} station cargo lists, {} rounds, {} cargo moved.", lists, rounds, moved);
+	IConsolePrint(CC_INFO, "Reserve and return: {} ms, {:.1f} us per list and round.", elapsed_move.count() / 1000, static_cast<double>(elapsed_move.count()) / lists / rounds);
+	IConsolePrint(CC_INFO, "Truncate: {} ms, {:.1f} us per list.", elapsed_truncate.count() / 1000, static_cast<double>(elapsed_truncate.count()) / lists);
+	return true;
+}
+
+DEF_CONSOLE_CMD(ConVehicleHash)
+{
+	if (argc == 0 || argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		IConsolePrint(CC_HELP, "Show how the vehicle tile hash is used. Usage: 'vehicle_hash [reset]'.");
+		IConsolePrint(CC_HELP, "Prints the number of position queries and the vehicles they visited since the last reset, and how the vehicles are spread over the hash.");
+		IConsolePrint(CC_HELP, "The queries are only counted while the misc debug level is at least 1, see 'debug_level misc=1'.");
+		return true;
+	}
+
+	if (argc == 2) {
+		_vehicle_hash_stats.Reset();
+		IConsolePrint(CC_DEFAULT, "Vehicle hash counters reset.");
+		return true;
+	}
+
+	VehicleHashOccupancy occupancy = GetVehicleTileHashOccupancy();
+	IConsolePrint(CC_DEFAULT, "Tile hash: {} x {} chains, {} vehicles in {} chains, longest chain {}.",
+			occupancy.size_x, occupancy.size_y, occupancy.vehicles, occupancy.used_chains, occupancy.longest_chain);
+
+	if (_debug_misc_level < 1) {
+		IConsolePrint(CC_WARNING, "Queries are not counted; set 'debug_level misc=1' to count them.");
+		return true;
+	}
+
+	uint64_t queries = _vehicle_hash_stats.queries;
+	uint64_t visited = _vehicle_hash_stats.visited;
+	uint64_t aliased = _vehicle_hash_stats.aliased;
+	IConsolePrint(CC_DEFAULT, "Queries: {}, vehicles visited: {} ({:.2f} per query), on another tile: {}.",
+			queries, visited, queries == 0 ? 0.0 : (double)visited / queries, aliased);
+	return true;
+}
+
 static void ConDumpRoadTypes()
 {
 	IConsolePrint(CC_DEFAULT, "  Flags:");
@@ -2759,6 +3007,10 @@ void IConsoleStdLibRegister()
 #endif
 	IConsole::CmdRegister("fps",                     ConFramerate);
 	IConsole::CmdRegister("fps_wnd",                 ConFramerateWindow);
+	IConsole::CmdRegister("yapf_benchmark",          ConYapfBenchmark);
+	IConsole::CmdRegister("linkgraph_benchmark",     ConLinkGraphBenchmark);
+	IConsole::CmdRegister("cargo_benchmark",         ConCargoBenchmark);
+	IConsole::CmdRegister("vehicle_hash",            ConVehicleHash);
 
 	/* NewGRF development stuff */
 	IConsole::CmdRegister("reload_newgrfs",          ConNewGRFReload,     ConHookNewGRFDeveloperTool);
@@ -11,7 +11,6 @@
 #include "../debug.h"
 #include "../fontcache.h"
 #include "../fontdetection.h"
-#include "../blitter/factory.hpp"
 #include "../core/math_func.hpp"
 #include "../zoom_func.h"
 #include "../fileio_func.h"
@@ -303,7 +302,7 @@ const Sprite *FreeTypeFontCache::InternalGetGlyph(GlyphID key, bool aa)
 	}
 
 	GlyphEntry new_glyph;
-	new_glyph.sprite = BlitterFactory::GetCurrentBlitter()->Encode(spritecollection, SimpleSpriteAlloc);
+	new_glyph.sprite = this->atlas.Encode(spritecollection);
 	new_glyph.width  = slot->advance.x >> 6;
 
 	this->SetGlyphPtr(key, &new_glyph);
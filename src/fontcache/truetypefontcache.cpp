@@ -17,6 +17,56 @@
 
 #include "../safeguards.h"
 
+/* static */ GlyphAtlas *GlyphAtlas::target = nullptr;
+
+/**
+ * Allocator for the sprite encoder, taking the memory from the #target atlas.
+ * @param size Number of bytes to allocate.
+ * @return The allocated memory.
+ */
+/* static */ void *GlyphAtlas::Allocate(size_t size)
+{
+	GlyphAtlas *atlas = GlyphAtlas::target;
+	assert(atlas != nullptr);
+
+	size = Align(size, alignof(std::max_align_t));
+	if (size > ATLAS_PAGE_SIZE) {
+		/* Huge glyphs get a page of their own; keep filling the current page. */
+		atlas->pages.emplace(atlas->pages.begin(), new byte[size]);
+		return atlas->pages.front().get();
+	}
+
+	if (atlas->used + size > ATLAS_PAGE_SIZE) {
+		atlas->pages.emplace_back(new byte[ATLAS_PAGE_SIZE]);
+		atlas->used = 0;
+	}
+
+	void *ptr = atlas->pages.back().get() + atlas->used;
+	atlas->used += size;
+	return ptr;
+}
+
+/**
+ * Encode a glyph for the current blitter and store it in the atlas.
+ * @param sprite The glyph to encode.
+ * @return The encoded glyph, valid until the atlas is cleared.
+ */
+Sprite *GlyphAtlas::Encode(const SpriteLoader::SpriteCollection &sprite)
+{
+	assert(GlyphAtlas::target == nullptr);
+	GlyphAtlas::target = this;
+	Sprite *result = BlitterFactory::GetCurrentBlitter()->Encode(sprite, &GlyphAtlas::Allocate);
+	GlyphAtlas::target = nullptr;
+	return result;
+}
+
+/** Release all glyphs stored in the atlas. */
+void GlyphAtlas::Clear()
+{
+	this->pages.clear();
+	this->used = ATLAS_PAGE_SIZE;
+}
+
 /**
  * Create a new TrueTypeFontCache.
  * @param fs     The font size that is going to be cached.
@@ -49,16 +99,12 @@ void TrueTypeFontCache::ClearFontCache()
 	for (int i = 0; i < 256; i++) {
 		if (this->glyph_to_sprite[i] == nullptr) continue;
 
-		for (int j = 0; j < 256; j++) {
-			if (this->glyph_to_sprite[i][j].duplicate) continue;
-			free(this->glyph_to_sprite[i][j].sprite);
-		}
-
 		free(this->glyph_to_sprite[i]);
 	}
 
 	free(this->glyph_to_sprite);
 	this->glyph_to_sprite = nullptr;
+	this->atlas.Clear();
 
 	Layouter::ResetFontCache(this->fs);
 }
@@ -71,7 +117,7 @@ TrueTypeFontCache::GlyphEntry *TrueTypeFontCache::GetGlyphPtr(GlyphID key)
 	return &this->glyph_to_sprite[GB(key, 8, 8)][GB(key, 0, 8)];
 }
 
-void TrueTypeFontCache::SetGlyphPtr(GlyphID key, const GlyphEntry *glyph, bool duplicate)
+void TrueTypeFontCache::SetGlyphPtr(GlyphID key, const GlyphEntry *glyph)
 {
 	if (this->glyph_to_sprite == nullptr) {
 		Debug(fontcache, 3, "Allocating root glyph cache for size {}", this->fs);
@@ -86,7 +132,6 @@ void TrueTypeFontCache::SetGlyphPtr(GlyphID key, const GlyphEntry *glyph, bool d
 	Debug(fontcache, 4, "Set glyph for unicode character 0x{:04X}, size {}", key, this->fs);
 	this->glyph_to_sprite[GB(key, 8, 8)][GB(key, 0, 8)].sprite = glyph->sprite;
 	this->glyph_to_sprite[GB(key, 8, 8)][GB(key, 0, 8)].width = glyph->width;
-	this->glyph_to_sprite[GB(key, 8, 8)][GB(key, 0, 8)].duplicate = duplicate;
 }
 
 bool TrueTypeFontCache::GetDrawGlyphShadow()
@@ -146,18 +191,18 @@ const Sprite *TrueTypeFontCache::GetGlyph(GlyphID key)
 				builtin_questionmark_data
 			} }};
 
-			Sprite *spr = BlitterFactory::GetCurrentBlitter()->Encode(builtin_questionmark, SimpleSpriteAlloc);
+			Sprite *spr = this->atlas.Encode(builtin_questionmark);
 			assert(spr != nullptr);
 			GlyphEntry new_glyph;
 			new_glyph.sprite = spr;
 			new_glyph.width  = spr->width + (this->fs != FS_NORMAL);
-			this->SetGlyphPtr(key, &new_glyph, false);
+			this->SetGlyphPtr(key, &new_glyph);
 			return new_glyph.sprite;
 		} else {
 			/* Use '?' for missing characters. */
 			this->GetGlyph(question_glyph);
 			glyph = this->GetGlyphPtr(question_glyph);
-			this->SetGlyphPtr(key, glyph, true);
+			this->SetGlyphPtr(key, glyph);
 			return glyph->sprite;
 		}
 	}
@@ -11,6 +11,7 @@
 #define TRUETYPEFONTCACHE_H
 
 #include "../fontcache.h"
+#include "../spriteloader/spriteloader.hpp"
 
 
 static const int MAX_FONT_SIZE = 72; ///< Maximum font size.
@@ -18,6 +19,26 @@ static const int MAX_FONT_SIZE = 72; ///< Maximum font size.
 static const byte FACE_COLOUR = 1;
 static const byte SHADOW_COLOUR = 2;
 
+/**
+ * Storage for the glyph sprites of a font cache.
+ * The encoded sprites are packed one after another into large pages, so the
+ * glyphs of a string are close together in memory, allocating a glyph is a
+ * pointer increment and all glyphs of a font are released at once.
+ */
+class GlyphAtlas {
+	static constexpr size_t ATLAS_PAGE_SIZE = 64 * 1024; ///< Size of a page of the atlas, in bytes.
+
+	std::vector<std::unique_ptr<byte[]>> pages;       ///< The allocated pages; the last one is being filled.
+	size_t used = ATLAS_PAGE_SIZE;                    ///< Number of bytes used of the last page.
+
+	static GlyphAtlas *target; ///< Atlas #Allocate puts the sprite being encoded in.
+	static void *Allocate(size_t size);
+
+public:
+	Sprite *Encode(const SpriteLoader::SpriteCollection &sprite);
+	void Clear();
+};
+
 /** Font cache for fonts that are based on a TrueType font. */
 class TrueTypeFontCache : public FontCache {
 protected:
@@ -34,7 +55,6 @@ protected:
 	struct GlyphEntry {
 		Sprite *sprite; ///< The loaded sprite.
 		byte width;     ///< The width of the glyph.
-		bool duplicate; ///< Whether this glyph entry is a duplicate, i.e. may this be freed?
 	};
 
 	/**
@@ -51,9 +71,10 @@ protected:
 	 * This can be simply changed in the two functions Get & SetGlyphPtr.
 	 */
 	GlyphEntry **glyph_to_sprite;
+	GlyphAtlas atlas; ///< Storage of the sprites of the glyphs in #glyph_to_sprite.
 
 	GlyphEntry *GetGlyphPtr(GlyphID key);
-	void SetGlyphPtr(GlyphID key, const GlyphEntry *glyph, bool duplicate = false);
+	void SetGlyphPtr(GlyphID key, const GlyphEntry *glyph);
 
 	virtual const void *InternalGetFontTable(uint32_t tag, size_t &length) = 0;
 	virtual const Sprite *InternalGetGlyph(GlyphID key, bool aa) = 0;
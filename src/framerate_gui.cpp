@@ -1098,6 +1098,15 @@ void ConPrintFramerate()
 		printed_anything = true;
 	}
 
+	const DirtyBlockStats &dirty = GetDirtyBlockStats();
+	if (dirty.rects_added != 0) {
+		IConsolePrint(TC_SILVER, "Dirty rectangles: {} marked, {} redrawn after coalescing ({:.1f}% fewer), {} pixels",
+			dirty.rects_added,
+			dirty.rects_drawn,
+			100.0 * (dirty.rects_added - dirty.rects_drawn) / dirty.rects_added,
+			dirty.pixels_drawn);
+	}
+
 	if (!printed_anything) {
 		IConsolePrint(CC_ERROR, "No performance measurements have been taken yet.");
 	}
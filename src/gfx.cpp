@@ -87,6 +87,7 @@ static bool _whole_screen_dirty = false;
 bool _gfx_draw_active = false;
 static std::vector<Rect> _dirty_blocks;
 static std::vector<Rect> _pending_dirty_blocks;
+static DirtyBlockStats _dirty_block_stats;
 enum GfxDebugFlags {
 	GDF_SHOW_WINDOW_DIRTY,
 	GDF_SHOW_WIDGET_DIRTY,
@@ -1057,23 +1058,22 @@ void DrawSprite(SpriteID img, PaletteID pal, int x, int y, const SubSprite *sub,
 }
 
 /**
- * The code for setting up the blitter mode and sprite information before finally drawing the sprite.
+ * Set up the blitter parameters of a sprite, clipping it to the destination.
+ * The remap of the parameters is left untouched.
+ * @param bp The parameters to fill.
  * @param sprite The sprite to draw.
  * @param x The X location to draw.
  * @param y The Y location to draw.
- * @param mode The settings for the blitter to pass.
  * @param sub Whether to only draw a sub set of the sprite.
  * @param zoom The zoom level at which to draw the sprites.
- * @param dst Optional parameter for a different blitting destination.
+ * @param dpi The blitting destination.
  * @tparam ZOOM_BASE The factor required to get the sub sprite information into the right size.
  * @tparam SCALED_XY Whether the X and Y are scaled or unscaled.
+ * @return False iff nothing of the sprite is visible.
  */
 template <int ZOOM_BASE, bool SCALED_XY>
-static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mode, const SubSprite * const sub, SpriteID sprite_id, ZoomLevel zoom, const DrawPixelInfo *dst = nullptr)
+static bool ClipBlitterParams(Blitter::BlitterParams &bp, const Sprite * const sprite, int x, int y, const SubSprite * const sub, ZoomLevel zoom, const DrawPixelInfo *dpi)
 {
-	const DrawPixelInfo *dpi = (dst != nullptr) ? dst : _cur_dpi;
-	Blitter::BlitterParams bp;
-
 	if (SCALED_XY) {
 		/* Scale it */
 		x = ScaleByZoom(x, zoom);
@@ -1097,8 +1097,8 @@ static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mo
 		int clip_right  = std::max(0, sprite->width  - (-sprite->x_offs + (sub->right + 1)  * ZOOM_BASE));
 		int clip_bottom = std::max(0, sprite->height - (-sprite->y_offs + (sub->bottom + 1) * ZOOM_BASE));
 
-		if (clip_left + clip_right >= sprite->width) return;
-		if (clip_top + clip_bottom >= sprite->height) return;
+		if (clip_left + clip_right >= sprite->width) return false;
+		if (clip_top + clip_bottom >= sprite->height) return false;
 
 		bp.skip_left = UnScaleByZoomLower(clip_left, zoom);
 		bp.skip_top = UnScaleByZoomLower(clip_top, zoom);
@@ -1118,20 +1118,19 @@ static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mo
 
 	bp.dst = dpi->dst_ptr;
 	bp.pitch = dpi->pitch;
-	bp.remap = _colour_remap_ptr;
 
 	assert(sprite->width > 0);
 	assert(sprite->height > 0);
 
-	if (bp.width <= 0) return;
-	if (bp.height <= 0) return;
+	if (bp.width <= 0) return false;
+	if (bp.height <= 0) return false;
 
 	y -= SCALED_XY ? ScaleByZoom(dpi->top, zoom) : dpi->top;
 	int y_unscaled = UnScaleByZoom(y, zoom);
 	/* Check for top overflow */
 	if (y < 0) {
 		bp.height -= -y_unscaled;
-		if (bp.height <= 0) return;
+		if (bp.height <= 0) return false;
 		bp.skip_top += -y_unscaled;
 		y = 0;
 	} else {
@@ -1142,7 +1141,7 @@ static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mo
 	y += SCALED_XY ? ScaleByZoom(bp.height - dpi->height, zoom) : ScaleByZoom(bp.height, zoom) - dpi->height;
 	if (y > 0) {
 		bp.height -= UnScaleByZoom(y, zoom);
-		if (bp.height <= 0) return;
+		if (bp.height <= 0) return false;
 	}
 
 	x -= SCALED_XY ? ScaleByZoom(dpi->left, zoom) : dpi->left;
@@ -1150,7 +1149,7 @@ static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mo
 	/* Check for left overflow */
 	if (x < 0) {
 		bp.width -= -x_unscaled;
-		if (bp.width <= 0) return;
+		if (bp.width <= 0) return false;
 		bp.skip_left += -x_unscaled;
 		x = 0;
 	} else {
@@ -1161,29 +1160,64 @@ static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mo
 	x += SCALED_XY ? ScaleByZoom(bp.width - dpi->width, zoom) : ScaleByZoom(bp.width, zoom) - dpi->width;
 	if (x > 0) {
 		bp.width -= UnScaleByZoom(x, zoom);
-		if (bp.width <= 0) return;
+		if (bp.width <= 0) return false;
 	}
 
 	assert(bp.skip_left + bp.width <= UnScaleByZoom(sprite->width, zoom));
 	assert(bp.skip_top + bp.height <= UnScaleByZoom(sprite->height, zoom));
 
+	return true;
+}
+
+/**
+ * Record the sprite for the NewGRF debug sprite picker if it covers the clicked pixel.
+ * @param blitter The blitter the sprite is drawn with.
+ * @param bp The clipped blitter parameters of the sprite.
+ * @param sprite_id The sprite being drawn.
+ */
+static void CheckSpritePickerHit(Blitter *blitter, const Blitter::BlitterParams &bp, SpriteID sprite_id)
+{
 	/* We do not want to catch the mouse. However we also use that spritenumber for unknown (text) sprites. */
-	if (_newgrf_debug_sprite_picker.mode == SPM_REDRAW && sprite_id != SPR_CURSOR_MOUSE) {
-		Blitter *blitter = BlitterFactory::GetCurrentBlitter();
-		void *topleft = blitter->MoveTo(bp.dst, bp.left, bp.top);
-		void *bottomright = blitter->MoveTo(topleft, bp.width - 1, bp.height - 1);
+	if (sprite_id == SPR_CURSOR_MOUSE) return;
 
-		void *clicked = _newgrf_debug_sprite_picker.clicked_pixel;
+	void *topleft = blitter->MoveTo(bp.dst, bp.left, bp.top);
+	void *bottomright = blitter->MoveTo(topleft, bp.width - 1, bp.height - 1);
 
-		if (topleft <= clicked && clicked <= bottomright) {
-			uint offset = (((size_t)clicked - (size_t)topleft) / (blitter->GetScreenDepth() / 8)) % bp.pitch;
-			if (offset < (uint)bp.width) {
-				include(_newgrf_debug_sprite_picker.sprites, sprite_id);
-			}
+	void *clicked = _newgrf_debug_sprite_picker.clicked_pixel;
+
+	if (topleft <= clicked && clicked <= bottomright) {
+		uint offset = (((size_t)clicked - (size_t)topleft) / (blitter->GetScreenDepth() / 8)) % bp.pitch;
+		if (offset < (uint)bp.width) {
+			include(_newgrf_debug_sprite_picker.sprites, sprite_id);
 		}
 	}
+}
+
+/**
+ * The code for setting up the blitter mode and sprite information before finally drawing the sprite.
+ * @param sprite The sprite to draw.
+ * @param x The X location to draw.
+ * @param y The Y location to draw.
+ * @param mode The settings for the blitter to pass.
+ * @param sub Whether to only draw a sub set of the sprite.
+ * @param zoom The zoom level at which to draw the sprites.
+ * @param dst Optional parameter for a different blitting destination.
+ * @tparam ZOOM_BASE The factor required to get the sub sprite information into the right size.
+ * @tparam SCALED_XY Whether the X and Y are scaled or unscaled.
+ */
+template <int ZOOM_BASE, bool SCALED_XY>
+static void GfxBlitter(const Sprite * const sprite, int x, int y, BlitterMode mode, const SubSprite * const sub, SpriteID sprite_id, ZoomLevel zoom, const DrawPixelInfo *dst = nullptr)
+{
+	const DrawPixelInfo *dpi = (dst != nullptr) ? dst : _cur_dpi;
+	Blitter::BlitterParams bp;
+
+	if (!ClipBlitterParams<ZOOM_BASE, SCALED_XY>(bp, sprite, x, y, sub, zoom, dpi)) return;
+	bp.remap = _colour_remap_ptr;
+
+	Blitter *blitter = BlitterFactory::GetCurrentBlitter();
+	if (_newgrf_debug_sprite_picker.mode == SPM_REDRAW) CheckSpritePickerHit(blitter, bp, sprite_id);
 
-	BlitterFactory::GetCurrentBlitter()->Draw(&bp, mode, zoom);
+	blitter->Draw(&bp, mode, zoom);
 }
 
 /**
@@ -1259,6 +1293,85 @@ static void GfxMainBlitter(const Sprite *sprite, int x, int y, BlitterMode mode,
 	GfxBlitter<1, true>(sprite, x, y, mode, sub, sprite_id, zoom);
 }
 
+/**
+ * Draw a sequence of sprites in a viewport, in the given order.
+ * This is equivalent to calling DrawSpriteViewport() for each record, but the
+ * sprites are clipped up front and passed to the blitter in batches, and the
+ * colour remap is only looked up when the palette differs from the previous sprite.
+ * @param records The sprites to draw.
+ */
+void DrawSpriteViewportBatch(std::span<const ViewportSpriteDrawRecord> records)
+{
+	/** Maximum number of sprites handed to the blitter at once. */
+	static const size_t MAX_BATCH_SIZE = 256;
+	static std::vector<Blitter::BatchEntry> batch;
+
+	const DrawPixelInfo *dpi = _cur_dpi;
+	const ZoomLevel zoom = dpi->zoom;
+	Blitter *blitter = BlitterFactory::GetCurrentBlitter();
+	const bool sprite_picker = _newgrf_debug_sprite_picker.mode == SPM_REDRAW;
+
+	auto flush = [&]() {
+		if (batch.empty()) return;
+		blitter->DrawBatch(batch, zoom);
+		batch.clear();
+	};
+
+	/* Remap state of the previous sprite; only valid while the sprite cache is not touched. */
+	bool remap_valid = false;
+	SpriteID last_image = 0;
+	PaletteID last_pal = PAL_NONE;
+	const byte *remap = nullptr;
+	BlitterMode mode = BM_NORMAL;
+
+	for (const ViewportSpriteDrawRecord &record : records) {
+		SpriteID real_sprite = GB(record.image, 0, SPRITE_WIDTH);
+		bool transparent = HasBit(record.image, PALETTE_MODIFIER_TRANSPARENT);
+		bool same_remap = remap_valid && record.pal == last_pal && transparent == HasBit(last_image, PALETTE_MODIFIER_TRANSPARENT);
+
+		/* Loading a sprite may evict or move other sprites in the cache, and text recolours all
+		 * share one remap table. Those sprites flush the batch and take the unbatched path. */
+		if (!IsSpriteInCache(real_sprite, SpriteType::Normal) ||
+				(!same_remap && (transparent || record.pal != PAL_NONE) &&
+				((!transparent && HasBit(record.pal, PALETTE_TEXT_RECOLOUR)) || !IsSpriteInCache(GB(record.pal, 0, PALETTE_WIDTH), SpriteType::Recolour)))) {
+			flush();
+			DrawSpriteViewport(record.image, record.pal, record.x, record.y, record.sub);
+			remap_valid = false;
+			continue;
+		}
+
+		if (!same_remap) {
+			if (transparent) {
+				PaletteID pal = GB(record.pal, 0, PALETTE_WIDTH);
+				_colour_remap_ptr = GetNonSprite(pal, SpriteType::Recolour) + 1;
+				mode = pal == PALETTE_TO_TRANSPARENT ? BM_TRANSPARENT : BM_TRANSPARENT_REMAP;
+			} else if (record.pal != PAL_NONE) {
+				_colour_remap_ptr = GetNonSprite(GB(record.pal, 0, PALETTE_WIDTH), SpriteType::Recolour) + 1;
+				mode = GetBlitterMode(record.pal);
+			} else {
+				mode = BM_NORMAL;
+			}
+			remap = _colour_remap_ptr;
+			remap_valid = true;
+			last_image = record.image;
+			last_pal = record.pal;
+		}
+
+		Blitter::BatchEntry &entry = batch.emplace_back();
+		if (!ClipBlitterParams<ZOOM_LVL_BASE, false>(entry.bp, GetSprite(real_sprite, SpriteType::Normal), record.x, record.y, record.sub, zoom, dpi)) {
+			batch.pop_back();
+			continue;
+		}
+		entry.bp.remap = remap;
+		entry.mode = mode;
+
+		if (sprite_picker) CheckSpritePickerHit(blitter, entry.bp, real_sprite);
+		if (batch.size() == MAX_BATCH_SIZE) flush();
+	}
+
+	flush();
+}
+
 /**
  * Initialize _stringwidth_table cache
  * @param monospace Whether to load the monospace cache or the normal fonts.
@@ -1505,6 +1618,81 @@ static void DrawOverlappedWindowWithClipping(Window *w, int left, int top, int r
 	DrawOverlappedWindow(w, std::max(0, left), std::max(0, top), std::min(_screen.width, right), std::min(_screen.height, bottom), flags);
 }
 
+/**
+ * Merge pairs of dirty blocks which touch along a complete edge.
+ * The blocks in \a blocks are non-overlapping (see #AddDirtyBlocks) and the union
+ * of two such blocks sharing a whole edge is again a rectangle, so this never adds
+ * any overdraw, it only reduces the number of #RedrawScreenRect calls.
+ * @param blocks The dirty blocks to coalesce.
+ * @param vertical True to merge blocks stacked on top of each other, false to merge blocks next to each other.
+ * @return True if any blocks were merged.
+ */
+static bool MergeDirtyBlocks(std::vector<Rect> &blocks, bool vertical)
+{
+	if (vertical) {
+		std::sort(blocks.begin(), blocks.end(), [](const Rect &a, const Rect &b) {
+			return std::tie(a.left, a.right, a.top) < std::tie(b.left, b.right, b.top);
+		});
+	} else {
+		std::sort(blocks.begin(), blocks.end(), [](const Rect &a, const Rect &b) {
+			return std::tie(a.top, a.bottom, a.left) < std::tie(b.top, b.bottom, b.left);
+		});
+	}
+
+	size_t out = 0;
+	for (size_t i = 1; i < blocks.size(); i++) {
+		Rect &prev = blocks[out];
+		const Rect &r = blocks[i];
+		if (vertical && prev.left == r.left && prev.right == r.right && prev.bottom == r.top) {
+			prev.bottom = r.bottom;
+		} else if (!vertical && prev.top == r.top && prev.bottom == r.bottom && prev.right == r.left) {
+			prev.right = r.right;
+		} else {
+			blocks[++out] = r;
+		}
+	}
+	if (blocks.empty() || out + 1 == blocks.size()) return false;
+	blocks.resize(out + 1);
+	return true;
+}
+
+/**
+ * Coalesce the dirty blocks into fewer rectangles before they are redrawn.
+ * Splitting in #AddDirtyBlocks and #UnsetDirtyBlocks tends to fragment the
+ * dirty area into many small strips; gluing these back together saves the
+ * per-rectangle overhead of redrawing windows and overlays.
+ */
+static void CoalesceDirtyBlocks()
+{
+	_dirty_block_stats.rects_added += _dirty_blocks.size();
+
+	if (_dirty_blocks.size() > 1) {
+		/* Alternate directions until nothing merges anymore; merging one way can line up edges for the other. */
+		bool vertical = true;
+		bool merged_last = true;
+		for (;;) {
+			bool merged = MergeDirtyBlocks(_dirty_blocks, vertical);
+			if (!merged && !merged_last) break;
+			merged_last = merged;
+			vertical = !vertical;
+		}
+	}
+
+	_dirty_block_stats.rects_drawn += _dirty_blocks.size();
+	for (const Rect &r : _dirty_blocks) {
+		_dirty_block_stats.pixels_drawn += (uint64_t)(r.right - r.left) * (r.bottom - r.top);
+	}
+}
+
+/**
+ * Get the statistics of the dirty block coalescing.
+ * @return The counters accumulated since the game started.
+ */
+const DirtyBlockStats &GetDirtyBlockStats()
+{
+	return _dirty_block_stats;
+}
+
 /**
  * Repaints the rectangle blocks which are marked as 'dirty'.
  *
@@ -1687,6 +1875,7 @@ void DrawDirtyBlocks()
 
 		dpi_backup.Restore();
 
+		CoalesceDirtyBlocks();
 		for (const Rect &r : _dirty_blocks) {
 			RedrawScreenRect(r.left, r.top, r.right, r.bottom);
 		}
@@ -1703,6 +1892,7 @@ void DrawDirtyBlocks()
 			AddDirtyBlock(r.left, r.top, r.right, r.bottom);
 		}
 		_pending_dirty_blocks.clear();
+		CoalesceDirtyBlocks();
 		for (const Rect &r : _dirty_blocks) {
 			RedrawScreenRect(r.left, r.top, r.right, r.bottom);
 		}
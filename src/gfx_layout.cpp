@@ -34,6 +34,7 @@
 
 /** Cache of ParagraphLayout lines. */
 Layouter::LineCache *Layouter::linecache;
+uint64_t Layouter::linecache_clock = 0;
 
 /** Cache of Font instances. */
 Layouter::FontColourMap Layouter::fonts[FS_END];
@@ -379,6 +380,7 @@ Layouter::LineCacheItem &Layouter::GetCachedParagraphLayout(std::string_view str
 
 	if (auto match = linecache->find(LineCacheQuery{state, str});
 		match != linecache->end()) {
+		match->second.last_used = ++linecache_clock;
 		return match->second;
 	}
 
@@ -386,7 +388,9 @@ Layouter::LineCacheItem &Layouter::GetCachedParagraphLayout(std::string_view str
 	LineCacheKey key;
 	key.state_before = state;
 	key.str.assign(str);
-	return (*linecache)[key];
+	LineCacheItem &item = (*linecache)[key];
+	item.last_used = ++linecache_clock;
+	return item;
 }
 
 /**
@@ -402,8 +406,24 @@ void Layouter::ResetLineCache()
  */
 void Layouter::ReduceLineCache()
 {
-	if (linecache != nullptr) {
-		/* TODO LRU cache would be fancy, but not exactly necessary */
-		if (linecache->size() > 4096) ResetLineCache();
+	/** Number of lines above which the least recently used half is evicted. */
+	static const size_t MAX_LINE_CACHE_SIZE = 4096;
+
+	if (linecache == nullptr || linecache->size() <= MAX_LINE_CACHE_SIZE) return;
+
+	/* Find the access time separating the least recently used half of the lines from the rest. */
+	std::vector<uint64_t> last_used;
+	last_used.reserve(linecache->size());
+	for (const auto &it : *linecache) last_used.push_back(it.second.last_used);
+	auto middle = last_used.begin() + last_used.size() / 2;
+	std::nth_element(last_used.begin(), middle, last_used.end());
+	uint64_t threshold = *middle;
+
+	for (auto it = linecache->begin(); it != linecache->end(); /* nothing */) {
+		if (it->second.last_used < threshold) {
+			it = linecache->erase(it);
+		} else {
+			++it;
+		}
 	}
 }
@@ -159,6 +159,7 @@ public:
 
 		FontState state_after;     ///< Font state after the line.
 		ParagraphLayouter *layout; ///< Layout of the line.
+		uint64_t last_used = 0;    ///< Value of #linecache_clock when the line was last used.
 
 		LineCacheItem() : buffer(nullptr), layout(nullptr) {}
 		~LineCacheItem() { delete layout; free(buffer); }
@@ -166,6 +167,7 @@ public:
 private:
 	typedef std::map<LineCacheKey, LineCacheItem, LineCacheCompare> LineCache;
 	static LineCache *linecache;
+	static uint64_t linecache_clock; ///< Number of accesses to the linecache, for least recently used eviction.
 
 	static LineCacheItem &GetCachedParagraphLayout(std::string_view str, const FontState &state);
 
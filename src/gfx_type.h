@@ -240,6 +240,22 @@ struct SubSprite {
 	int left, top, right, bottom;
 };
 
+/** A sprite to draw in a viewport as part of a batch, see DrawSpriteViewportBatch(). */
+struct ViewportSpriteDrawRecord {
+	SpriteID image;        ///< Image number to draw.
+	PaletteID pal;         ///< Palette to use.
+	const SubSprite *sub;  ///< If available, draw only specified part of the sprite.
+	int32_t x;             ///< Left coordinate of image in viewport, scaled by zoom.
+	int32_t y;             ///< Top coordinate of image in viewport, scaled by zoom.
+};
+
+/** Counters of the dirty block coalescing, see GetDirtyBlockStats(). */
+struct DirtyBlockStats {
+	uint64_t rects_added = 0;  ///< Number of dirty rectangles before coalescing.
+	uint64_t rects_drawn = 0;  ///< Number of rectangles actually redrawn after coalescing.
+	uint64_t pixels_drawn = 0; ///< Total area of the redrawn rectangles.
+};
+
 enum Colours : byte {
 	COLOUR_BEGIN,
 	COLOUR_DARK_BLUE = COLOUR_BEGIN,
@@ -11,6 +11,7 @@
 #include "clear_map.h"
 #include "industry.h"
 #include "station_base.h"
+#include "station_func.h"
 #include "landscape.h"
 #include "viewport_func.h"
 #include "command_func.h"
@@ -47,6 +48,7 @@
 #include "timer/timer_game_calendar.h"
 #include "timer/timer_game_economy.h"
 #include "timer/timer_game_tick.h"
+#include "thread.h"
 
 #include "table/strings.h"
 #include "table/industry_land.h"
@@ -1960,6 +1962,7 @@ static void DoCreateNewIndustry(Industry *i, TileIndex tile, IndustryType type,
 			if (its->animation.status != ANIM_STATUS_NO_ANIMATION) AddAnimatedTile(cur_tile);
 		}
 	}
+	InvalidateAcceptanceChunks(i->location);
 
 	if (GetIndustrySpec(i->type)->behaviour & INDUSTRYBEH_PLANT_ON_BUILT) {
 		for (uint j = 0; j != 50; j++) PlantRandomFarmField(i);
@@ -2803,6 +2806,112 @@ int WhoCanServiceIndustry(Industry *ind)
 	return result;
 }
 
+/** News about a change of industry production, waiting to be published. */
+struct IndustryProductionNews {
+	Industry *industry; ///< Industry the news is about.
+	StringID str;       ///< News message, or #STR_NULL for a smooth economy production change.
+	bool closure;       ///< Whether the industry announces its closure.
+	CargoID cargo;      ///< Cargo whose production changed, for smooth economy production changes.
+	int percent;        ///< Percentage of change of a smooth economy production change.
+	int serviced;       ///< Who can service the industry, see #WhoCanServiceIndustry.
+};
+
+/** Minimum number of news per thread when finding out who services the industries of the monthly production changes. */
+static const size_t MIN_INDUSTRY_NEWS_SHARD = 8;
+
+static bool _defer_industry_news = false; ///< Whether production news is collected in #_industry_news instead of published right away.
+static std::vector<IndustryProductionNews> _industry_news; ///< Production news of the running monthly loop.
+
+/**
+ * Publish news about a change of industry production.
+ * @param news The news; for anything but closures, who services the industry must be known.
+ */
+static void PublishIndustryProductionNews(const IndustryProductionNews &news)
+{
+	Industry *i = news.industry;
+	const IndustrySpec *indspec = GetIndustrySpec(i->type);
+
+	NewsType nt;
+	/* Compute news category */
+	if (news.closure) {
+		nt = NT_INDUSTRY_CLOSE;
+	} else {
+		switch (news.serviced) {
+			case 0: nt = NT_INDUSTRY_NOBODY;  break;
+			case 1: nt = NT_INDUSTRY_OTHER;   break;
+			case 2: nt = NT_INDUSTRY_COMPANY; break;
+			default: NOT_REACHED();
+		}
+	}
+
+	if (news.str == STR_NULL) {
+		SetDParam(2, abs(news.percent));
+		SetDParam(0, CargoSpec::Get(news.cargo)->name);
+		SetDParam(1, i->index);
+		AddIndustryNewsItem(
+			news.percent >= 0 ? STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_SMOOTH : STR_NEWS_INDUSTRY_PRODUCTION_DECREASE_SMOOTH,
+			nt,
+			i->index
+		);
+		return;
+	}
+
+	/* Set parameters of news string */
+	if (news.str > STR_LAST_STRINGID) {
+		SetDParam(0, STR_TOWN_NAME);
+		SetDParam(1, i->town->index);
+		SetDParam(2, indspec->name);
+	} else if (news.closure) {
+		SetDParam(0, STR_FORMAT_INDUSTRY_NAME);
+		SetDParam(1, i->town->index);
+		SetDParam(2, indspec->name);
+	} else {
+		SetDParam(0, i->index);
+	}
+	/* and report the news to the user */
+	if (news.closure) {
+		AddTileNewsItem(news.str, nt, i->location.tile + TileDiffXY(1, 1));
+	} else {
+		AddIndustryNewsItem(news.str, nt, i->index);
+	}
+}
+
+/**
+ * Publish news about a change of industry production, or keep it for
+ * the end of the monthly loop.
+ * @param news The news.
+ */
+static void ReportIndustryProductionNews(IndustryProductionNews news)
+{
+	if (_defer_industry_news) {
+		_industry_news.push_back(news);
+		return;
+	}
+
+	if (!news.closure) news.serviced = WhoCanServiceIndustry(news.industry);
+	PublishIndustryProductionNews(news);
+}
+
+/**
+ * Publish the production news collected during the monthly loop.
+ * Finding out who services an industry scans all vehicles, which adds up
+ * with many news items, so that is done for all of them at the same time.
+ * It only reads vehicles, orders and stations. The news is then published
+ * in the order it was reported in.
+ */
+static void PublishDeferredIndustryNews()
+{
+	ParallelFor(_industry_news.size(), MIN_INDUSTRY_NEWS_SHARD, [](size_t i) {
+		IndustryProductionNews &news = _industry_news[i];
+		if (!news.closure) news.serviced = WhoCanServiceIndustry(news.industry);
+	});
+
+	for (const IndustryProductionNews &news : _industry_news) {
+		PublishIndustryProductionNews(news);
+	}
+	_industry_news.clear();
+}
+
 /**
  * Report news that industry production has changed significantly
  *
@@ -2812,22 +2921,7 @@ int WhoCanServiceIndustry(Industry *ind)
  */
 static void ReportNewsProductionChangeIndustry(Industry *ind, CargoID type, int percent)
 {
-	NewsType nt;
-
-	switch (WhoCanServiceIndustry(ind)) {
-		case 0: nt = NT_INDUSTRY_NOBODY;  break;
-		case 1: nt = NT_INDUSTRY_OTHER;   break;
-		case 2: nt = NT_INDUSTRY_COMPANY; break;
-		default: NOT_REACHED();
-	}
-	SetDParam(2, abs(percent));
-	SetDParam(0, CargoSpec::Get(type)->name);
-	SetDParam(1, ind->index);
-	AddIndustryNewsItem(
-		percent >= 0 ? STR_NEWS_INDUSTRY_PRODUCTION_INCREASE_SMOOTH : STR_NEWS_INDUSTRY_PRODUCTION_DECREASE_SMOOTH,
-		nt,
-		ind->index
-	);
+	ReportIndustryProductionNews({ind, STR_NULL, false, type, percent, 0});
 }
 
 static const uint PERCENT_TRANSPORTED_60 = 153;
@@ -3012,38 +3106,11 @@ static void ChangeIndustryProduction(Industry *i, bool monthly)
 	}
 
 	if (!suppress_message && str != STR_NULL) {
-		NewsType nt;
-		/* Compute news category */
 		if (closeit) {
-			nt = NT_INDUSTRY_CLOSE;
 			AI::BroadcastNewEvent(new ScriptEventIndustryClose(i->index));
 			Game::NewEvent(new ScriptEventIndustryClose(i->index));
-		} else {
-			switch (WhoCanServiceIndustry(i)) {
-				case 0: nt = NT_INDUSTRY_NOBODY;  break;
-				case 1: nt = NT_INDUSTRY_OTHER;   break;
-				case 2: nt = NT_INDUSTRY_COMPANY; break;
-				default: NOT_REACHED();
-			}
-		}
-		/* Set parameters of news string */
-		if (str > STR_LAST_STRINGID) {
-			SetDParam(0, STR_TOWN_NAME);
-			SetDParam(1, i->town->index);
-			SetDParam(2, indspec->name);
-		} else if (closeit) {
-			SetDParam(0, STR_FORMAT_INDUSTRY_NAME);
-			SetDParam(1, i->town->index);
-			SetDParam(2, indspec->name);
-		} else {
-			SetDParam(0, i->index);
-		}
-		/* and report the news to the user */
-		if (closeit) {
-			AddTileNewsItem(str, nt, i->location.tile + TileDiffXY(1, 1));
-		} else {
-			AddIndustryNewsItem(str, nt, i->index);
 		}
+		ReportIndustryProductionNews({i, str, closeit, INVALID_CARGO, 0, 0});
 	}
 }
 
@@ -3102,6 +3169,9 @@ static IntervalTimer<TimerGameEconomy> _economy_industries_monthly({TimerGameEco
 
 	_industry_builder.EconomyMonthlyLoop();
 
+	/* The production changes, with their callbacks and random numbers, stay in
+	 * industry order. Only the news about them waits for the end of the loop. */
+	_defer_industry_news = true;
 	for (Industry *i : Industry::Iterate()) {
 		UpdateIndustryStatistics(i);
 		if (i->prod_level == PRODLEVEL_CLOSURE) {
@@ -3111,6 +3181,8 @@ static IntervalTimer<TimerGameEconomy> _economy_industries_monthly({TimerGameEco
 			SetWindowDirty(WC_INDUSTRY_VIEW, i->index);
 		}
 	}
+	_defer_industry_news = false;
+	PublishDeferredIndustryNews();
 
 	cur_company.Restore();
 
@@ -3251,6 +3323,8 @@ extern const TileTypeProcs _tile_type_industry_procs = {
 	nullptr,                        // vehicle_enter_tile_proc
 	GetFoundation_Industry,      // get_foundation_proc
 	TerraformTile_Industry,      // terraform_tile_proc
+	nullptr,                     // tile_loop_plan_proc
+	nullptr,                     // tile_loop_apply_proc
 };
 
 bool IndustryCompare::operator() (const IndustryListEntry &lhs, const IndustryListEntry &rhs) const
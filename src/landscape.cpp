@@ -37,6 +37,7 @@
 #include "terraform_cmd.h"
 #include "station_func.h"
 #include "pathfinder/water_regions.h"
+#include "thread.h"
 
 #include "table/strings.h"
 #include "table/sprites.h"
@@ -755,8 +756,115 @@ std::tuple<CommandCost, Money> CmdClearArea(DoCommandFlag flags, TileIndex tile,
 
 TileIndex _cur_tileloop_tile;
 
+/** Number of tiles the tile loop runs ahead of the tile it is handling to prefetch their map data. */
+static const size_t TILE_LOOP_PREFETCH_DISTANCE = 16;
+
+/**
+ * Ask the CPU to start loading the map data of a tile, so it is in the cache by the time the tile is handled.
+ * @param tile The tile to prefetch.
+ */
+static inline void PrefetchTile(TileIndex tile)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	Tile t(tile);
+	__builtin_prefetch(&t.type());
+	__builtin_prefetch(&t.m6());
+#else
+	(void)tile;
+#endif
+}
+
+/**
+ * Minimum number of tiles per thread when planning the tile loop in parallel.
+ * Planning adds a pass over the batch, so it only pays off when at least two
+ * threads share it; smaller batches, and games without worker threads, run
+ * the tile loops directly.
+ */
+static const size_t MIN_TILE_LOOP_PLAN_TILES = 4096;
+
+/** Copy of the map data of a tile, to find out whether the tile changed since its tile loop was planned. */
+struct TileLoopSnapshot {
+	uint8_t type;
+	uint8_t height;
+	uint8_t m1;
+	uint8_t m3;
+	uint8_t m4;
+	uint8_t m5;
+	uint8_t m6;
+	uint8_t m7;
+	uint16_t m2;
+	uint16_t m8;
+
+	TileLoopSnapshot() = default;
+
+	TileLoopSnapshot(TileIndex index)
+	{
+		Tile t(index);
+		this->type = t.type();
+		this->height = t.height();
+		this->m1 = t.m1();
+		this->m3 = t.m3();
+		this->m4 = t.m4();
+		this->m5 = t.m5();
+		this->m6 = t.m6();
+		this->m7 = t.m7();
+		this->m2 = t.m2();
+		this->m8 = t.m8();
+	}
+
+	bool operator==(const TileLoopSnapshot &) const = default;
+};
+
+/**
+ * Run the tile loop of a batch in two passes. First the tile loop of every
+ * tile whose type has a TileLoopPlanProc is planned by the ParallelFor()
+ * worker pool, which claims the tiles in chunks. Planning only reads the map,
+ * so the plans do not depend on the number of threads. Then the tiles are
+ * handled in LFSR order: a planned tile whose map data is still the same as
+ * when it was planned gets its plan carried out, every other tile runs its
+ * TileLoopProc. As the plan procs only plan what the tile loop would have done
+ * anyway, and refuse anything involving randomness, the result is the same as
+ * running all tile loops one by one.
+ * @param batch The tiles of this tick in LFSR order.
+ */
+static void RunPlannedTileLoop(const std::vector<TileIndex> &batch)
+{
+	static std::vector<uint8_t> plans;
+	static std::vector<TileLoopSnapshot> snapshots;
+	plans.resize(batch.size());
+	snapshots.resize(batch.size());
+
+	ParallelFor(batch.size(), MIN_TILE_LOOP_PLAN_TILES, [&](size_t i) {
+		TileIndex tile = batch[i];
+		TileLoopPlanProc *proc = _tile_type_procs[GetTileType(tile)]->tile_loop_plan_proc;
+		plans[i] = proc == nullptr ? TILE_LOOP_RUN : proc(tile);
+		if (plans[i] != TILE_LOOP_RUN) snapshots[i] = TileLoopSnapshot(tile);
+	});
+
+	for (size_t i = 0; i < std::min(batch.size(), TILE_LOOP_PREFETCH_DISTANCE); i++) PrefetchTile(batch[i]);
+	for (size_t i = 0; i < batch.size(); i++) {
+		if (i + TILE_LOOP_PREFETCH_DISTANCE < batch.size()) PrefetchTile(batch[i + TILE_LOOP_PREFETCH_DISTANCE]);
+
+		TileIndex tile = batch[i];
+		const TileTypeProcs *procs = _tile_type_procs[GetTileType(tile)];
+		if (plans[i] != TILE_LOOP_RUN && snapshots[i] == TileLoopSnapshot(tile)) {
+			procs->tile_loop_apply_proc(tile, plans[i]);
+		} else {
+			procs->tile_loop_proc(tile);
+		}
+	}
+}
+
 /**
  * Gradually iterate over all tiles on the map, calling their TileLoopProcs once every 256 ticks.
+ *
+ * The tiles of a tick are first collected into a batch. The LFSR order spreads
+ * them all over the map, so nearly every tile is a cache miss; knowing the
+ * batch up front allows fetching the map data of the next tiles while the
+ * current one is handled. The tiles are still handled in LFSR order: most
+ * tile loop procs draw from the game RNG or change neighbouring tiles, so
+ * grouping them by tile type would change the game and break multiplayer.
+ * Large batches are planned in parallel first, see RunPlannedTileLoop.
  */
 void RunTileLoop()
 {
@@ -781,20 +889,35 @@ void RunTileLoop()
 	/* The LFSR cannot have a zeroed state. */
 	assert(tile != 0);
 
+	static std::vector<TileIndex> batch;
+	batch.clear();
+	batch.reserve(count);
+
 	/* Manually update tile 0 every 256 ticks - the LFSR never iterates over it itself.  */
 	if (TimerGameTick::counter % 256 == 0) {
-		_tile_type_procs[GetTileType(0)]->tile_loop_proc(0);
+		batch.push_back(0);
 		count--;
 	}
 
 	while (count--) {
-		_tile_type_procs[GetTileType(tile)]->tile_loop_proc(tile);
+		batch.push_back(tile);
 
 		/* Get the next tile in sequence using a Galois LFSR. */
 		tile = (tile.base() >> 1) ^ (-(int32_t)(tile.base() & 1) & feedback);
 	}
 
 	_cur_tileloop_tile = tile;
+
+	if (batch.size() >= 2 * MIN_TILE_LOOP_PLAN_TILES && GetParallelForWorkerCount() > 0) {
+		RunPlannedTileLoop(batch);
+		return;
+	}
+
+	for (size_t i = 0; i < std::min(batch.size(), TILE_LOOP_PREFETCH_DISTANCE); i++) PrefetchTile(batch[i]);
+	for (size_t i = 0; i < batch.size(); i++) {
+		if (i + TILE_LOOP_PREFETCH_DISTANCE < batch.size()) PrefetchTile(batch[i + TILE_LOOP_PREFETCH_DISTANCE]);
+		_tile_type_procs[GetTileType(batch[i])]->tile_loop_proc(batch[i]);
+	}
 }
 
 void InitializeLandscape()
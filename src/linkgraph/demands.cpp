@@ -8,6 +8,9 @@
 
 typedef std::queue<NodeID> NodeList;
 
+static const size_t MIN_BASE_DEMAND_NODES = 128;   ///< Minimum component size to calculate the base demands for up front.
+static const size_t MAX_BASE_DEMANDS      = 1 << 22; ///< Maximum number of node pairs to calculate the base demands for up front.
+
 /**
  * Scale various things according to symmetric/asymmetric distribution.
  */
@@ -55,7 +58,7 @@ public:
 	 * @param to The receiving node.
 	 * @return Effective supply.
 	 */
-	inline uint EffectiveSupply(const Node &from, const Node &to)
+	inline uint EffectiveSupply(const Node &from, const Node &to) const
 	{
 		return std::max(from.base.supply * std::max(1U, to.base.supply) * this->mod_size / 100 / this->demand_per_node, 1U);
 	}
@@ -106,7 +109,7 @@ public:
 	 * @param from The supplying node.
 	 * @param unused.
 	 */
-	inline uint EffectiveSupply(const Node &from, const Node &)
+	inline uint EffectiveSupply(const Node &from, const Node &) const
 	{
 		return from.base.supply;
 	}
@@ -155,6 +158,37 @@ inline void Scaler::SetDemands(LinkGraphJob &job, NodeID from_id, NodeID to_id,
 	job[from_id].DeliverSupply(to_id, demand_forw);
 }
 
+/**
+ * Calculate the demand from one node to another before any supply has run out.
+ * @param job Job to calculate the demands for.
+ * @param scaler Scaler to be used for scaling demands.
+ * @param from_id The supplying node.
+ * @param to_id The receiving node.
+ * @tparam Tscaler Scaler to be used for scaling demands.
+ * @return Demand, or 0 if the nodes are too far apart or the supply is too small.
+ */
+template<class Tscaler>
+uint DemandCalculator::BaseDemand(LinkGraphJob &job, const Tscaler &scaler, NodeID from_id, NodeID to_id) const
+{
+	int32_t supply = scaler.EffectiveSupply(job[from_id], job[to_id]);
+	assert(supply > 0);
+
+	/* Scale the distance by mod_dist around max_distance */
+	int32_t distance = this->max_distance - (this->max_distance -
+			(int32_t)DistanceMaxPlusManhattan(job[from_id].base.xy, job[to_id].base.xy)) *
+			this->mod_dist / 100;
+
+	/* Scale the accuracy by distance around accuracy / 2 */
+	int32_t divisor = this->accuracy * (this->mod_dist - 50) / 100 +
+			this->accuracy * distance / this->max_distance + 1;
+
+	assert(divisor > 0);
+
+	/* Only distribute demand if effective supply / accuracy divisor >= 1.
+	 * Others are too small or too far away to be considered. */
+	return divisor <= supply ? supply / divisor : 0;
+}
+
 /**
  * Do the actual demand calculation, called from constructor.
  * @param job Job to calculate the demands for.
@@ -188,6 +222,22 @@ void DemandCalculator::CalcDemand(LinkGraphJob &job, Tscaler scaler)
 	scaler.SetDemandPerNode(num_demands);
 	uint chance = 0;
 
+	/* Until supply runs out the demand between two nodes only depends on the
+	 * nodes themselves. For large components calculate it in parallel before
+	 * distributing anything. */
+	size_t size = job.Size();
+	std::vector<uint> base_demands;
+	if (size >= MIN_BASE_DEMAND_NODES && size * size <= MAX_BASE_DEMANDS) {
+		base_demands.resize(size * size);
+		ParallelFor(size, MIN_BASE_DEMAND_NODES / 2, [&](size_t from_id) {
+			if (job[from_id].base.supply == 0) return;
+			for (NodeID to_id = 0; to_id < size; to_id++) {
+				if (to_id == from_id || job[to_id].base.demand == 0) continue;
+				base_demands[from_id * size + to_id] = this->BaseDemand(job, scaler, from_id, to_id);
+			}
+		});
+	}
+
 	while (!supplies.empty() && !demands.empty()) {
 		NodeID from_id = supplies.front();
 		supplies.pop();
@@ -204,27 +254,8 @@ void DemandCalculator::CalcDemand(LinkGraphJob &job, Tscaler scaler)
 				continue;
 			}
 
-			int32_t supply = scaler.EffectiveSupply(job[from_id], job[to_id]);
-			assert(supply > 0);
-
-			/* Scale the distance by mod_dist around max_distance */
-			int32_t distance = this->max_distance - (this->max_distance -
-					(int32_t)DistanceMaxPlusManhattan(job[from_id].base.xy, job[to_id].base.xy)) *
-					this->mod_dist / 100;
-
-			/* Scale the accuracy by distance around accuracy / 2 */
-			int32_t divisor = this->accuracy * (this->mod_dist - 50) / 100 +
-					this->accuracy * distance / this->max_distance + 1;
-
-			assert(divisor > 0);
-
-			uint demand_forw = 0;
-			if (divisor <= supply) {
-				/* At first only distribute demand if
-				 * effective supply / accuracy divisor >= 1
-				 * Others are too small or too far away to be considered. */
-				demand_forw = supply / divisor;
-			} else if (++chance > this->accuracy * num_demands * num_supplies) {
+			uint demand_forw = base_demands.empty() ? this->BaseDemand(job, scaler, from_id, to_id) : base_demands[from_id * size + to_id];
+			if (demand_forw == 0 && ++chance > this->accuracy * num_demands * num_supplies) {
 				/* After some trying, if there is still supply left, distribute
 				 * demand also to other nodes. */
 				demand_forw = 1;
@@ -280,4 +311,12 @@ DemandCalculator::DemandCalculator(LinkGraphJob &job) :
 			/* Nothing to do. */
 			break;
 	}
+
+	/* Sources not recalculated by an incremental job keep their current flows. */
+	if (job.IsIncremental()) {
+		for (NodeID node = 0; node < job.Size(); ++node) {
+			if (job.IsRecalculatedSource(node)) continue;
+			for (auto &demand : job[node].demands) demand = {};
+		}
+	}
 }
@@ -18,6 +18,9 @@ private:
 	int32_t mod_dist;     ///< Distance modifier, determines how much demands decrease with distance.
 	int32_t accuracy;     ///< Accuracy of the calculation.
 
+	template<class Tscaler>
+	uint BaseDemand(LinkGraphJob &job, const Tscaler &scaler, NodeID from_id, NodeID to_id) const;
+
 	template<class Tscaler>
 	void CalcDemand(LinkGraphJob &job, Tscaler scaler);
 };
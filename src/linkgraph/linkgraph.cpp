@@ -30,6 +30,7 @@ LinkGraph::BaseNode::BaseNode(TileIndex xy, StationID st, uint demand)
 	this->demand = demand;
 	this->station = st;
 	this->last_update = EconomyTime::INVALID_DATE;
+	this->last_job_supply = 0;
 }
 
 /**
@@ -43,6 +44,7 @@ LinkGraph::BaseEdge::BaseEdge(NodeID dest_node)
 	this->last_unrestricted_update = EconomyTime::INVALID_DATE;
 	this->last_restricted_update = EconomyTime::INVALID_DATE;
 	this->dest_node = dest_node;
+	this->last_job_capacity = 0;
 }
 
 /**
@@ -83,6 +85,90 @@ void LinkGraph::Compress()
 	}
 }
 
+/**
+ * Check if a monthly value has drifted too far from the one it had at the last recalculation.
+ * @param value Current monthly value.
+ * @param last Monthly value at the last recalculation.
+ * @param tolerance Allowed deviation in percent.
+ * @return True if the deviation exceeds the tolerance.
+ */
+static inline bool ExceedsTolerance(uint value, uint last, uint tolerance)
+{
+	return (uint64_t)Delta(value, last) * 100 > (uint64_t)tolerance * std::max(value, last);
+}
+
+/**
+ * Remember the current supplies and capacities as the ones the flows have been
+ * calculated for.
+ */
+void LinkGraph::TakeJobSnapshot()
+{
+	for (BaseNode &node : this->nodes) {
+		node.last_job_supply = this->Monthly(node.supply);
+		for (BaseEdge &edge : node.edges) edge.last_job_capacity = std::max(1U, this->Monthly(edge.capacity));
+	}
+	this->structure_changed = false;
+}
+
+/**
+ * Determine which sources need new flows because their supply or the capacity
+ * of links they send cargo over changed noticeably since the last
+ * recalculation. The changes found are considered handled afterwards.
+ * @param tolerance Change of supply or capacity in percent up to which it is ignored. 0 always requests a full recalculation.
+ * @param[out] sources Sorted list of sources to be recalculated, or empty if everything has to be recalculated.
+ * @return False if nothing has to be recalculated.
+ */
+bool LinkGraph::CollectChangedSources(uint tolerance, std::vector<NodeID> &sources)
+{
+	sources.clear();
+	if (tolerance == 0 || this->structure_changed) {
+		this->TakeJobSnapshot();
+		return true;
+	}
+
+	std::vector<bool> changed(this->Size(), false);
+	for (NodeID from = 0; from < this->Size(); ++from) {
+		BaseNode &node = this->nodes[from];
+		if (ExceedsTolerance(this->Monthly(node.supply), node.last_job_supply, tolerance)) changed[from] = true;
+
+		const GoodsEntry &ge = Station::Get(node.station)->goods[this->cargo];
+		for (BaseEdge &edge : node.edges) {
+			/* New links may attract flows from anywhere. */
+			if (edge.last_job_capacity == 0) {
+				this->TakeJobSnapshot();
+				return true;
+			}
+
+			uint capacity = std::max(1U, this->Monthly(edge.capacity));
+			if (!ExceedsTolerance(capacity, edge.last_job_capacity, tolerance)) continue;
+			edge.last_job_capacity = capacity;
+			changed[from] = true;
+
+			/* Recalculate all sources whose cargo currently travels over the link. */
+			StationID via = this->nodes[edge.dest_node].station;
+			for (const auto &[origin, flow] : ge.flows) {
+				if (flow.GetShare(via) == 0) continue;
+				const Station *st = Station::GetIfValid(origin);
+				if (st != nullptr && st->goods[this->cargo].link_graph == this->index) changed[st->goods[this->cargo].node] = true;
+			}
+		}
+	}
+
+	for (NodeID node = 0; node < this->Size(); ++node) {
+		if (changed[node]) sources.push_back(node);
+	}
+	if (sources.empty()) return false;
+
+	if (sources.size() * 100 > this->Size() * INCREMENTAL_MAX_SOURCES) {
+		sources.clear();
+		this->TakeJobSnapshot();
+		return true;
+	}
+
+	for (NodeID node : sources) this->nodes[node].last_job_supply = this->Monthly(this->nodes[node].supply);
+	return true;
+}
+
 /**
  * Merge a link graph with another one.
  * @param other LinkGraph to be merged into this one.
@@ -106,6 +192,7 @@ void LinkGraph::Merge(LinkGraph *other)
 			new_edge.travel_time_sum = LinkGraph::Scale(e.travel_time_sum, age, other_age);
 		}
 	}
+	this->structure_changed = true;
 	delete other;
 }
 
@@ -116,6 +203,7 @@ void LinkGraph::Merge(LinkGraph *other)
 void LinkGraph::RemoveNode(NodeID id)
 {
 	assert(id < this->Size());
+	this->structure_changed = true;
 
 	NodeID last_node = this->Size() - 1;
 	Station::Get(this->nodes[last_node].station)->goods[this->cargo].node = id;
@@ -152,6 +240,7 @@ NodeID LinkGraph::AddNode(const Station *st)
 
 	NodeID new_node = this->Size();
 	this->nodes.emplace_back(st->xy, st->index, HasBit(good.status, GoodsEntry::GES_ACCEPTANCE));
+	this->structure_changed = true;
 
 	return new_node;
 }
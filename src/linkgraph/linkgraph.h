@@ -46,6 +46,7 @@ public:
 		TimerGameEconomy::Date last_unrestricted_update; ///< When the unrestricted part of the link was last updated.
 		TimerGameEconomy::Date last_restricted_update;   ///< When the restricted part of the link was last updated.
 		NodeID dest_node;              ///< Destination of the edge.
+		uint last_job_capacity;        ///< Monthly capacity when the flows over the link were last recalculated, 0 if never.
 
 		BaseEdge(NodeID dest_node = INVALID_NODE);
 
@@ -93,6 +94,7 @@ public:
 		StationID station;       ///< Station ID.
 		TileIndex xy;            ///< Location of the station referred to by the node.
 		TimerGameEconomy::Date last_update;        ///< When the supply was last updated.
+		uint last_job_supply;    ///< Monthly supply when the flows from the station were last recalculated.
 
 		std::vector<BaseEdge> edges; ///< Sorted list of outgoing edges from this node.
 
@@ -175,6 +177,9 @@ public:
 	/** Minimum number of days between subsequent compressions of a LG. */
 	static constexpr TimerGameEconomy::Date COMPRESSION_INTERVAL = 256;
 
+	/** Share of changed sources, in percent of all nodes, above which a full recalculation is done instead of an incremental one. */
+	static const uint INCREMENTAL_MAX_SOURCES = 50;
+
 	/**
 	 * Scale a value from a link graph of age orig_age for usage in one of age
 	 * target_age. Make sure that the value stays > 0 if it was > 0 before.
@@ -189,12 +194,12 @@ public:
 	}
 
 	/** Bare constructor, only for save/load. */
-	LinkGraph() : cargo(INVALID_CARGO), last_compression(0) {}
+	LinkGraph() : cargo(INVALID_CARGO), last_compression(0), structure_changed(true) {}
 	/**
 	 * Real constructor.
 	 * @param cargo Cargo the link graph is about.
 	 */
-	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(TimerGameEconomy::date) {}
+	LinkGraph(CargoID cargo) : cargo(cargo), last_compression(TimerGameEconomy::date), structure_changed(true) {}
 
 	void Init(uint size);
 	void ShiftDates(TimerGameEconomy::Date interval);
@@ -254,6 +259,14 @@ public:
 	NodeID AddNode(const Station *st);
 	void RemoveNode(NodeID id);
 
+	/**
+	 * Note that links have been removed or restricted, so that the next
+	 * recalculation can't be incremental.
+	 */
+	inline void MarkStructureChanged() { this->structure_changed = true; }
+
+	bool CollectChangedSources(uint tolerance, std::vector<NodeID> &sources);
+
 protected:
 	friend SaveLoadTable GetLinkGraphDesc();
 	friend SaveLoadTable GetLinkGraphJobDesc();
@@ -264,6 +277,9 @@ protected:
 	CargoID cargo;         ///< Cargo of this component's link graph.
 	TimerGameEconomy::Date last_compression; ///< Last time the capacities and supplies were compressed.
 	NodeVector nodes;      ///< Nodes in the component.
+	bool structure_changed; ///< Have nodes or links been removed or merged since the last recalculation?
+
+	void TakeJobSnapshot();
 };
 
 #endif /* LINKGRAPH_H */
@@ -31,16 +31,69 @@ INSTANTIATE_POOL_METHODS(LinkGraphJob)
  * that the calculations don't interfer with the normal operations on the
  * original. The job is immediately started.
  * @param orig Original LinkGraph to be copied.
+ * @param incremental_sources Sorted list of sources to recalculate, or empty to recalculate all of them.
  */
-LinkGraphJob::LinkGraphJob(const LinkGraph &orig) :
+LinkGraphJob::LinkGraphJob(const LinkGraph &orig, std::vector<NodeID> &&incremental_sources) :
 		/* Copying the link graph here also copies its index member.
 		 * This is on purpose. */
 		link_graph(orig),
 		settings(_settings_game.linkgraph),
+		flat_dijkstra(_settings_game.citymania.linkgraph.mcf_flat_dijkstra),
 		join_date(TimerGameEconomy::date + (_settings_game.linkgraph.recalc_time / EconomyTime::SECONDS_PER_DAY)),
+		incremental_sources(std::move(incremental_sources)),
 		job_completed(false),
 		job_aborted(false)
 {
+	if (this->IsIncremental()) this->ReserveKeptFlows();
+}
+
+/**
+ * Check if the current flows of a source station are kept when joining the job.
+ * @param origin Source station.
+ * @return True if the job is incremental and doesn't recalculate the source.
+ */
+bool LinkGraphJob::KeepsFlowsOf(StationID origin) const
+{
+	if (!this->IsIncremental()) return false;
+	const Station *st = Station::GetIfValid(origin);
+	if (st == nullptr) return false;
+	const GoodsEntry &ge = st->goods[this->Cargo()];
+	return ge.link_graph == this->link_graph.index && ge.node < this->Size() &&
+			this->link_graph[ge.node].station == origin && !this->IsRecalculatedSource(ge.node);
+}
+
+/**
+ * Take the capacity used by the flows which an incremental job keeps out of the
+ * job's copy of the link graph, so that the recalculated flows are planned
+ * around them. This has to be done on spawning, while the station flows still
+ * are the ones the job will be joined with.
+ */
+void LinkGraphJob::ReserveKeptFlows()
+{
+	LinkGraph &lg = this->link_graph;
+	/* Flows are monthly values, capacities have been accumulated since the last compression. */
+	uint64_t runtime = (TimerGameEconomy::date - lg.LastCompression() + 1).base();
+	for (NodeID from = 0; from < lg.Size(); ++from) {
+		LinkGraph::BaseNode &node = lg[from];
+		for (const auto &[origin, flow] : Station::Get(node.station)->goods[this->Cargo()].flows) {
+			if (!this->KeepsFlowsOf(origin)) continue;
+			uint32_t prev = 0;
+			for (const auto &[share, via] : *flow.GetShares()) {
+				uint amount = share - prev;
+				prev = share;
+				const Station *st = Station::GetIfValid(via);
+				if (st == nullptr || st->goods[this->Cargo()].link_graph != lg.index) continue;
+				NodeID to = st->goods[this->Cargo()].node;
+				if (!node.HasEdgeTo(to)) continue;
+
+				LinkGraph::BaseEdge &edge = node[to];
+				if (edge.capacity <= 1) continue;
+				uint capacity = edge.capacity - (uint)std::min<uint64_t>(edge.capacity - 1, amount * runtime / 30);
+				edge.travel_time_sum = edge.travel_time_sum * capacity / edge.capacity;
+				edge.capacity = capacity;
+			}
+		}
+	}
 }
 
 /**
@@ -151,7 +204,10 @@ LinkGraphJob::~LinkGraphJob()
 		for (FlowStatMap::iterator it(ge.flows.begin()); it != ge.flows.end();) {
 			FlowStatMap::iterator new_it = flows.find(it->first);
 			if (new_it == flows.end()) {
-				if (_settings_game.linkgraph.GetDistributionType(this->Cargo()) != DT_MANUAL) {
+				if (this->KeepsFlowsOf(it->first)) {
+					/* Source hasn't been recalculated by an incremental job. */
+					++it;
+				} else if (_settings_game.linkgraph.GetDistributionType(this->Cargo()) != DT_MANUAL) {
 					it->second.Invalidate();
 					++it;
 				} else {
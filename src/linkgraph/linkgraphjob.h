@@ -160,30 +160,50 @@ private:
 	friend class LinkGraphSchedule;
 
 protected:
-	const LinkGraph link_graph;        ///< Link graph to by analyzed. Is copied when job is started and mustn't be modified later.
+	LinkGraph link_graph;              ///< Link graph to by analyzed. Is copied when job is started and mustn't be modified later, except by ReserveKeptFlows() while spawning.
 	const LinkGraphSettings settings;  ///< Copy of _settings_game.linkgraph at spawn time.
+	const bool flat_dijkstra;          ///< Copy of _settings_game.citymania.linkgraph.mcf_flat_dijkstra at spawn time.
 	std::thread thread;                ///< Thread the job is running in or a default-constructed thread if it's running in the main thread.
 	TimerGameEconomy::Date join_date; ///< Date when the job is to be joined.
 	NodeAnnotationVector nodes;        ///< Extra node data necessary for link graph calculation.
+	std::vector<NodeID> incremental_sources; ///< Sorted list of sources recalculated by an incremental job, empty if all flows are recalculated.
 	std::atomic<bool> job_completed;   ///< Is the job still running. This is accessed by multiple threads and reads may be stale.
 	std::atomic<bool> job_aborted;     ///< Has the job been aborted. This is accessed by multiple threads and reads may be stale.
 
 	void EraseFlows(NodeID from);
 	void JoinThread();
 	void SpawnThread();
+	void ReserveKeptFlows();
 
 public:
 	/**
 	 * Bare constructor, only for save/load. link_graph, join_date and actually
 	 * settings have to be brutally const-casted in order to populate them.
 	 */
-	LinkGraphJob() : settings(_settings_game.linkgraph),
+	LinkGraphJob() : settings(_settings_game.linkgraph), flat_dijkstra(_settings_game.citymania.linkgraph.mcf_flat_dijkstra),
 			join_date(EconomyTime::INVALID_DATE), job_completed(false), job_aborted(false) {}
 
-	LinkGraphJob(const LinkGraph &orig);
+	LinkGraphJob(const LinkGraph &orig, std::vector<NodeID> &&incremental_sources = {});
 	~LinkGraphJob();
 
 	void Init();
+	bool KeepsFlowsOf(StationID origin) const;
+
+	/**
+	 * Check if the job only recalculates the flows of some sources.
+	 * @return True if the job is incremental.
+	 */
+	inline bool IsIncremental() const { return !this->incremental_sources.empty(); }
+
+	/**
+	 * Check if the flows of a source are recalculated by this job.
+	 * @param node Source node.
+	 * @return True if the source gets new flows.
+	 */
+	inline bool IsRecalculatedSource(NodeID node) const
+	{
+		return !this->IsIncremental() || std::binary_search(this->incremental_sources.begin(), this->incremental_sources.end(), node);
+	}
 
 	/**
 	 * Check if job has actually finished.
@@ -231,6 +251,12 @@ public:
 	 */
 	inline const LinkGraphSettings &Settings() const { return this->settings; }
 
+	/**
+	 * Check whether the MCF passes of this job use the flat Dijkstra search.
+	 * @return True if MultiCommodityFlow::FlatDijkstra() is used.
+	 */
+	inline bool UseFlatDijkstra() const { return this->flat_dijkstra; }
+
 	/**
 	 * Get a node abstraction with the specified id.
 	 * @param num ID of the node.
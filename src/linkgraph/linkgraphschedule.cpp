@@ -42,8 +42,14 @@ void LinkGraphSchedule::SpawnNext()
 	}
 	assert(next == LinkGraph::Get(next->index));
 	this->schedule.pop_front();
+	std::vector<NodeID> sources;
+	if (!next->CollectChangedSources(_settings_game.citymania.linkgraph.recalc_tolerance, sources)) {
+		/* Nothing changed enough to be worth a recalculation; keep the current flows. */
+		this->schedule.push_back(next);
+		return;
+	}
 	if (LinkGraphJob::CanAllocateItem()) {
-		LinkGraphJob *job = new LinkGraphJob(*next);
+		LinkGraphJob *job = new LinkGraphJob(*next, std::move(sources));
 		job->SpawnThread();
 		this->running.push_back(job);
 	} else {
@@ -9,6 +9,12 @@
 
 typedef std::map<NodeID, Path *> PathViaMap;
 
+template <typename T>
+bool Greater(T x_anno, T y_anno, NodeID x, NodeID y);
+
+static const uint16_t MCF_PARALLEL_MIN_NODES = 256; ///< Minimum component size to search the paths of several sources in parallel.
+static const size_t MCF_PARALLEL_BATCH_SIZE = 32;   ///< Number of sources to search the paths of in parallel.
+
 /**
  * Distance-based annotation for use in the Dijkstra algorithm. This is close
  * to the original meaning of "annotation" in this context. Paths are rated
@@ -37,6 +43,12 @@ public:
 	 */
 	inline void UpdateAnnotation() { }
 
+	/**
+	 * Check if a node comes before another one in the queue of Dijkstra().
+	 * @return If the shorter distance, or the lower node ID on equal distances, is x's.
+	 */
+	static inline bool Before(uint x_anno, NodeID x, uint y_anno, NodeID y) { return !Greater<uint>(x_anno, y_anno, x, y); }
+
 	/**
 	 * Comparator for std containers.
 	 */
@@ -61,7 +73,7 @@ public:
 	 * @param n ID of node to be annotated.
 	 * @param source If the node is the source of its path.
 	 */
-	CapacityAnnotation(NodeID n, bool source = false) : Path(n, source) {}
+	CapacityAnnotation(NodeID n, bool source = false) : Path(n, source), cached_annotation(0) {}
 
 	bool IsBetter(const CapacityAnnotation *base, uint cap, int free_cap, uint dist) const;
 
@@ -79,6 +91,12 @@ public:
 		this->cached_annotation = this->GetCapacityRatio();
 	}
 
+	/**
+	 * Check if a node comes before another one in the queue of Dijkstra().
+	 * @return If the higher capacity, or the higher node ID on equal capacities, is x's.
+	 */
+	static inline bool Before(int x_anno, NodeID x, int y_anno, NodeID y) { return Greater<int>(x_anno, y_anno, x, y); }
+
 	/**
 	 * Comparator for std containers.
 	 */
@@ -187,6 +205,141 @@ public:
 	}
 };
 
+/**
+ * Priority queue of the nodes in FlatDijkstra(). It is a 4-ary heap of the
+ * annotation values and node IDs, kept in one flat array so sifting doesn't
+ * need to look at the annotations themselves. The position of each node in
+ * the heap is known, so a changed annotation is moved in place.
+ * @tparam Tannotation Annotation the nodes are ordered by.
+ */
+template <class Tannotation>
+class AnnotationQueue {
+private:
+	using Value = decltype(std::declval<Tannotation>().GetAnnotation());
+
+	/** Entry of the heap. */
+	struct Item {
+		Value annotation; ///< Copy of the annotation value of the node.
+		NodeID node;      ///< Node being queued.
+	};
+
+	static constexpr uint ARITY = 4;                   ///< Number of children per heap entry.
+	static constexpr uint32_t NOT_QUEUED = UINT32_MAX; ///< Position of nodes which are not in the heap.
+
+	std::vector<Item> heap;         ///< The heap, the first item is the next one to visit.
+	std::vector<uint32_t> position; ///< Position of each node in the heap or #NOT_QUEUED.
+
+	inline bool Before(const Item &x, const Item &y) const
+	{
+		return Tannotation::Before(x.annotation, x.node, y.annotation, y.node);
+	}
+
+	inline void Place(uint32_t pos, const Item &item)
+	{
+		this->heap[pos] = item;
+		this->position[item.node] = pos;
+	}
+
+	void SiftUp(uint32_t pos, Item item)
+	{
+		while (pos > 0) {
+			uint32_t parent = (pos - 1) / ARITY;
+			if (!this->Before(item, this->heap[parent])) break;
+			this->Place(pos, this->heap[parent]);
+			pos = parent;
+		}
+		this->Place(pos, item);
+	}
+
+	void SiftDown(uint32_t pos, Item item)
+	{
+		uint32_t size = static_cast<uint32_t>(this->heap.size());
+		for (;;) {
+			uint32_t first = pos * ARITY + 1;
+			if (first >= size) break;
+			uint32_t best = first;
+			for (uint32_t child = first + 1; child < std::min(first + ARITY, size); ++child) {
+				if (this->Before(this->heap[child], this->heap[best])) best = child;
+			}
+			if (!this->Before(this->heap[best], item)) break;
+			this->Place(pos, this->heap[best]);
+			pos = best;
+		}
+		this->Place(pos, item);
+	}
+
+public:
+	/**
+	 * Create an empty queue.
+	 * @param size Number of nodes in the link graph.
+	 */
+	AnnotationQueue(uint16_t size) : position(size, NOT_QUEUED)
+	{
+		this->heap.reserve(size);
+	}
+
+	/**
+	 * Check if all nodes have been visited.
+	 * @return If the queue is empty.
+	 */
+	inline bool IsEmpty() const { return this->heap.empty(); }
+
+	/**
+	 * Add an annotation without restoring the heap order; call Heapify() afterwards.
+	 * @param anno Annotation to add.
+	 */
+	inline void Append(const Tannotation *anno)
+	{
+		this->position[anno->GetNode()] = static_cast<uint32_t>(this->heap.size());
+		this->heap.push_back({anno->GetAnnotation(), anno->GetNode()});
+	}
+
+	/**
+	 * Restore the heap order after calls to Append().
+	 */
+	void Heapify()
+	{
+		if (this->heap.size() < 2) return;
+		for (uint32_t pos = static_cast<uint32_t>(this->heap.size() - 2) / ARITY + 1; pos-- > 0;) {
+			this->SiftDown(pos, this->heap[pos]);
+		}
+	}
+
+	/**
+	 * Remove the first node from the queue.
+	 * @return ID of the node.
+	 */
+	NodeID Pop()
+	{
+		NodeID node = this->heap.front().node;
+		this->position[node] = NOT_QUEUED;
+		Item last = this->heap.back();
+		this->heap.pop_back();
+		if (!this->heap.empty()) this->SiftDown(0, last);
+		return node;
+	}
+
+	/**
+	 * Queue a node again after its annotation has changed.
+	 * @param anno Changed annotation.
+	 */
+	void Update(const Tannotation *anno)
+	{
+		Item item{anno->GetAnnotation(), anno->GetNode()};
+		uint32_t pos = this->position[item.node];
+		if (pos == NOT_QUEUED) {
+			/* Nodes that have been visited already are queued again, like in Dijkstra(). */
+			pos = static_cast<uint32_t>(this->heap.size());
+			this->heap.push_back(item);
+			this->SiftUp(pos, item);
+		} else if (pos > 0 && this->Before(item, this->heap[(pos - 1) / ARITY])) {
+			this->SiftUp(pos, item);
+		} else {
+			this->SiftDown(pos, item);
+		}
+	}
+};
+
 /**
  * Determines if an extension to the given Path with the given parameters is
  * better than this path.
@@ -256,6 +409,11 @@ bool CapacityAnnotation::IsBetter(const CapacityAnnotation *base, uint cap,
 template<class Tannotation, class Tedge_iterator>
 void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 {
+	if (this->flat_dijkstra) {
+		this->FlatDijkstra<Tannotation, Tedge_iterator>(source_node, paths);
+		return;
+	}
+
 	typedef std::set<Tannotation *, typename Tannotation::Comparator> AnnoSet;
 	Tedge_iterator iter(this->job);
 	uint16_t size = this->job.Size();
@@ -276,22 +434,8 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 		for (NodeID to = iter.Next(); to != INVALID_NODE; to = iter.Next()) {
 			if (to == from) continue; // Not a real edge but a consumption sign.
 			const Edge &edge = this->job[from][to];
-			uint capacity = edge.base.capacity;
-			if (this->max_saturation != UINT_MAX) {
-				capacity *= this->max_saturation;
-				capacity /= 100;
-				if (capacity == 0) capacity = 1;
-			}
-			/* Prioritize the fastest route for passengers, mail and express cargo,
-			 * and the shortest route for other classes of cargo.
-			 * In-between stops are punished with a 1 tile or 1 day penalty. */
-			bool express = IsCargoInClass(this->job.Cargo(), CC_PASSENGERS) ||
-				IsCargoInClass(this->job.Cargo(), CC_MAIL) ||
-				IsCargoInClass(this->job.Cargo(), CC_EXPRESS);
-			uint distance = DistanceMaxPlusManhattan(this->job[from].base.xy, this->job[to].base.xy) + 1;
-			/* Compute a default travel time from the distance and an average speed of 1 tile/day. */
-			uint time = (edge.base.TravelTime() != 0) ? edge.base.TravelTime() + Ticks::DAY_TICKS : distance * Ticks::DAY_TICKS;
-			uint distance_anno = express ? time : distance;
+			uint capacity = this->EdgeCapacity(edge);
+			uint distance_anno = this->EdgeDistance(from, to, edge);
 
 			Tannotation *dest = static_cast<Tannotation *>(paths[to]);
 			if (dest->IsBetter(source, capacity, capacity - edge.Flow(), distance_anno)) {
@@ -304,6 +448,92 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
 	}
 }
 
+/**
+ * Variant of Dijkstra() without allocations per node. The annotations left
+ * in \a paths by CleanupPaths() are reused and the nodes are queued in an
+ * AnnotationQueue. Nodes are visited in the same order as in Dijkstra(), so
+ * the result is the same.
+ * @tparam Tannotation Annotation to be used.
+ * @tparam Tedge_iterator Iterator to be used for getting outgoing edges.
+ * @param source_node Node where the algorithm starts.
+ * @param paths Container for the paths to be calculated.
+ */
+template<class Tannotation, class Tedge_iterator>
+void MultiCommodityFlow::FlatDijkstra(NodeID source_node, PathVector &paths)
+{
+	Tedge_iterator iter(this->job);
+	uint16_t size = this->job.Size();
+	AnnotationQueue<Tannotation> annos(size);
+	paths.resize(size, nullptr);
+	for (NodeID node = 0; node < size; ++node) {
+		Tannotation *anno = static_cast<Tannotation *>(paths[node]);
+		if (anno == nullptr) {
+			anno = new Tannotation(node, node == source_node);
+			paths[node] = anno;
+		} else {
+			*anno = Tannotation(node, node == source_node);
+		}
+		anno->UpdateAnnotation();
+		annos.Append(anno);
+	}
+	annos.Heapify();
+	while (!annos.IsEmpty()) {
+		NodeID from = annos.Pop();
+		Tannotation *source = static_cast<Tannotation *>(paths[from]);
+		iter.SetNode(source_node, from);
+		for (NodeID to = iter.Next(); to != INVALID_NODE; to = iter.Next()) {
+			if (to == from) continue; // Not a real edge but a consumption sign.
+			const Edge &edge = this->job[from][to];
+			uint capacity = this->EdgeCapacity(edge);
+			uint distance_anno = this->EdgeDistance(from, to, edge);
+
+			Tannotation *dest = static_cast<Tannotation *>(paths[to]);
+			if (dest->IsBetter(source, capacity, capacity - edge.Flow(), distance_anno)) {
+				dest->Fork(source, capacity, capacity - edge.Flow(), distance_anno);
+				dest->UpdateAnnotation();
+				annos.Update(dest);
+			}
+		}
+	}
+}
+
+/**
+ * Get the capacity of an edge, reduced by the maximum saturation.
+ * @param edge Edge to get the capacity of.
+ * @return Usable capacity of the edge.
+ */
+uint MultiCommodityFlow::EdgeCapacity(const Edge &edge) const
+{
+	uint capacity = edge.base.capacity;
+	if (this->max_saturation != UINT_MAX) {
+		capacity *= this->max_saturation;
+		capacity /= 100;
+		if (capacity == 0) capacity = 1;
+	}
+	return capacity;
+}
+
+/**
+ * Get the length of an edge as used for rating paths in Dijkstra().
+ * @param from Node the edge starts at.
+ * @param to Node the edge ends at.
+ * @param edge The edge.
+ * @return Travel time for express cargo, distance for other cargo.
+ */
+uint MultiCommodityFlow::EdgeDistance(NodeID from, NodeID to, const Edge &edge)
+{
+	/* Prioritize the fastest route for passengers, mail and express cargo,
+	 * and the shortest route for other classes of cargo.
+	 * In-between stops are punished with a 1 tile or 1 day penalty. */
+	bool express = IsCargoInClass(this->job.Cargo(), CC_PASSENGERS) ||
+		IsCargoInClass(this->job.Cargo(), CC_MAIL) ||
+		IsCargoInClass(this->job.Cargo(), CC_EXPRESS);
+	uint distance = DistanceMaxPlusManhattan(this->job[from].base.xy, this->job[to].base.xy) + 1;
+	/* Compute a default travel time from the distance and an average speed of 1 tile/day. */
+	uint time = (edge.base.TravelTime() != 0) ? edge.base.TravelTime() + Ticks::DAY_TICKS : distance * Ticks::DAY_TICKS;
+	return express ? time : distance;
+}
+
 /**
  * Clean up paths that lead nowhere and the root path.
  * @param source_id ID of the root node.
@@ -311,6 +541,19 @@ void MultiCommodityFlow::Dijkstra(NodeID source_node, PathVector &paths)
  */
 void MultiCommodityFlow::CleanupPaths(NodeID source_id, PathVector &paths)
 {
+	if (this->flat_dijkstra) {
+		/* Detach the same paths as below, but keep the unused ones in place
+		 * for the next call to FlatDijkstra(). Paths with flow are part of
+		 * the result now and are taken out. */
+		Path *source = paths[source_id];
+		for (Path *&path : paths) {
+			if (path == source) continue;
+			if (path->GetParent() == source || path->GetFlow() == 0) path->Detach();
+			if (path->GetFlow() > 0) path = nullptr;
+		}
+		return;
+	}
+
 	Path *source = paths[source_id];
 	paths[source_id] = nullptr;
 	for (PathVector::iterator i = paths.begin(); i != paths.end(); ++i) {
@@ -331,6 +574,16 @@ void MultiCommodityFlow::CleanupPaths(NodeID source_id, PathVector &paths)
 	paths.clear();
 }
 
+/**
+ * Delete all paths left over from Dijkstra() or CleanupPaths().
+ * @param paths Paths to be deleted.
+ */
+void MultiCommodityFlow::DeletePaths(PathVector &paths)
+{
+	for (Path *path : paths) delete path;
+	paths.clear();
+}
+
 /**
  * Push flow along a path and update the unsatisfied_demand of the associated
  * edge.
@@ -351,6 +604,38 @@ uint MultiCommodityFlow::PushFlow(Node &node, NodeID to, Path *path, uint accura
 	return flow;
 }
 
+/**
+ * Push flow along a path like PushFlow() and record if any edge of the path
+ * ran out of capacity. The result of Dijkstra<DistanceAnnotation> only
+ * depends on which edges have capacity left, so searches started before
+ * stay valid as long as that doesn't happen.
+ * @param node Node where the path starts.
+ * @param to Node where the path ends.
+ * @param path End of the path the flow should be pushed on.
+ * @param accuracy Accuracy of the calculation.
+ * @param max_saturation If < UINT_MAX only push flow up to the given
+ *                       saturation, otherwise the path can be "overloaded".
+ */
+uint MCF1stPass::PushFlowTracked(Node &node, NodeID to, Path *path, uint accuracy, uint max_saturation)
+{
+	this->path_free.clear();
+	for (Path *leg = path; leg->GetParent() != nullptr; leg = leg->GetParent()) {
+		this->path_free.push_back(this->HasFreeCapacity(this->job[leg->GetParent()->GetNode()][leg->GetNode()]));
+	}
+
+	uint flow = this->PushFlow(node, to, path, accuracy, max_saturation);
+
+	/* Flow only grows in this pass, so edges can only lose their capacity. */
+	auto was_free = this->path_free.begin();
+	for (Path *leg = path; flow > 0 && leg->GetParent() != nullptr; leg = leg->GetParent(), ++was_free) {
+		if (*was_free && !this->HasFreeCapacity(this->job[leg->GetParent()->GetNode()][leg->GetNode()])) {
+			this->saturation_changed = true;
+			break;
+		}
+	}
+	return flow;
+}
+
 /**
  * Find the flow along a cycle including cycle_begin in path.
  * @param path Set of paths that form the cycle.
@@ -495,56 +780,86 @@ bool MCF1stPass::EliminateCycles()
 /**
  * Run the first pass of the MCF calculation.
  * @param job Link graph job to calculate.
+ * @param flat_dijkstra Use FlatDijkstra() instead of Dijkstra().
  */
-MCF1stPass::MCF1stPass(LinkGraphJob &job) : MultiCommodityFlow(job)
+MCF1stPass::MCF1stPass(LinkGraphJob &job, bool flat_dijkstra) : MultiCommodityFlow(job, flat_dijkstra)
 {
-	PathVector paths;
 	uint16_t size = job.Size();
 	uint accuracy = job.Settings().accuracy;
 	bool more_loops;
 	std::vector<bool> finished_sources(size);
 
+	/* Search the shortest paths of a batch of sources in parallel. Pushing
+	 * flow for one source invalidates the searches of the following ones only
+	 * if it saturates an edge; these are then searched again. */
+	size_t batch_size = size >= MCF_PARALLEL_MIN_NODES ? MCF_PARALLEL_BATCH_SIZE : 1;
+	std::vector<NodeID> batch;
+	std::vector<PathVector> batch_paths(batch_size);
+
 	do {
 		more_loops = false;
-		for (NodeID source = 0; source < size; ++source) {
-			if (finished_sources[source]) continue;
+		for (NodeID next = 0; next < size;) {
+			batch.clear();
+			for (; next < size && batch.size() < batch_size; ++next) {
+				if (!finished_sources[next]) batch.push_back(next);
+			}
 
 			/* First saturate the shortest paths. */
-			this->Dijkstra<DistanceAnnotation, GraphEdgeIterator>(source, paths);
+			ParallelFor(batch.size(), 1, [&](size_t i) {
+				this->Dijkstra<DistanceAnnotation, GraphEdgeIterator>(batch[i], batch_paths[i]);
+			});
+
+			this->saturation_changed = false;
+			for (size_t i = 0; i < batch.size(); ++i) {
+				if (this->saturation_changed) {
+					/* Throw away the outdated searches and continue with a new
+					 * batch. FlatDijkstra() just overwrites them. */
+					if (!this->flat_dijkstra) {
+						for (size_t j = i; j < batch.size(); ++j) this->DeletePaths(batch_paths[j]);
+					}
+					next = batch[i];
+					break;
+				}
 
-			Node &src_node = job[source];
-			bool source_demand_left = false;
-			for (NodeID dest = 0; dest < size; ++dest) {
-				if (src_node.UnsatisfiedDemandTo(dest) > 0) {
-					Path *path = paths[dest];
-					assert(path != nullptr);
-					/* Generally only allow paths that don't exceed the
-					 * available capacity. But if no demand has been assigned
-					 * yet, make an exception and allow any valid path *once*. */
-					if (path->GetFreeCapacity() > 0 && this->PushFlow(src_node, dest, path,
-							accuracy, this->max_saturation) > 0) {
-						/* If a path has been found there is a chance we can
-						 * find more. */
-						more_loops = more_loops || (src_node.UnsatisfiedDemandTo(dest) > 0);
-					} else if (src_node.UnsatisfiedDemandTo(dest) == src_node.DemandTo(dest) &&
-							path->GetFreeCapacity() > INT_MIN) {
-						this->PushFlow(src_node, dest, path, accuracy, UINT_MAX);
+				NodeID source = batch[i];
+				PathVector &paths = batch_paths[i];
+				Node &src_node = job[source];
+				bool source_demand_left = false;
+				for (NodeID dest = 0; dest < size; ++dest) {
+					if (src_node.UnsatisfiedDemandTo(dest) > 0) {
+						Path *path = paths[dest];
+						assert(path != nullptr);
+						/* Generally only allow paths that don't exceed the
+						 * available capacity. But if no demand has been assigned
+						 * yet, make an exception and allow any valid path *once*. */
+						if (path->GetFreeCapacity() > 0 && this->PushFlowTracked(src_node, dest, path,
+								accuracy, this->max_saturation) > 0) {
+							/* If a path has been found there is a chance we can
+							 * find more. */
+							more_loops = more_loops || (src_node.UnsatisfiedDemandTo(dest) > 0);
+						} else if (src_node.UnsatisfiedDemandTo(dest) == src_node.DemandTo(dest) &&
+								path->GetFreeCapacity() > INT_MIN) {
+							this->PushFlowTracked(src_node, dest, path, accuracy, UINT_MAX);
+						}
+						if (src_node.UnsatisfiedDemandTo(dest) > 0) source_demand_left = true;
 					}
-					if (src_node.UnsatisfiedDemandTo(dest) > 0) source_demand_left = true;
 				}
+				finished_sources[source] = !source_demand_left;
+				this->CleanupPaths(source, paths);
 			}
-			finished_sources[source] = !source_demand_left;
-			this->CleanupPaths(source, paths);
 		}
 	} while ((more_loops || this->EliminateCycles()) && !job.IsJobAborted());
+
+	for (PathVector &paths : batch_paths) this->DeletePaths(paths);
 }
 
 /**
  * Run the second pass of the MCF calculation which assigns all remaining
  * demands to existing paths.
  * @param job Link graph job to calculate.
+ * @param flat_dijkstra Use FlatDijkstra() instead of Dijkstra().
  */
-MCF2ndPass::MCF2ndPass(LinkGraphJob &job) : MultiCommodityFlow(job)
+MCF2ndPass::MCF2ndPass(LinkGraphJob &job, bool flat_dijkstra) : MultiCommodityFlow(job, flat_dijkstra)
 {
 	this->max_saturation = UINT_MAX; // disable artificial cap on saturation
 	PathVector paths;
@@ -575,6 +890,8 @@ MCF2ndPass::MCF2ndPass(LinkGraphJob &job) : MultiCommodityFlow(job)
 			this->CleanupPaths(source, paths);
 		}
 	}
+
+	this->DeletePaths(paths);
 }
 
 /**
@@ -15,20 +15,40 @@ protected:
 	/**
 	 * Constructor.
 	 * @param job Link graph job being executed.
+	 * @param flat_dijkstra Use FlatDijkstra() instead of Dijkstra().
 	 */
-	MultiCommodityFlow(LinkGraphJob &job) : job(job),
-			max_saturation(job.Settings().short_path_saturation)
+	MultiCommodityFlow(LinkGraphJob &job, bool flat_dijkstra) : job(job),
+			max_saturation(job.Settings().short_path_saturation),
+			flat_dijkstra(flat_dijkstra)
 	{}
 
 	template<class Tannotation, class Tedge_iterator>
 	void Dijkstra(NodeID from, PathVector &paths);
 
+	template<class Tannotation, class Tedge_iterator>
+	void FlatDijkstra(NodeID from, PathVector &paths);
+
+	uint EdgeCapacity(const Edge &edge) const;
+	uint EdgeDistance(NodeID from, NodeID to, const Edge &edge);
+
+	/**
+	 * Check if an edge has capacity left, as seen by Dijkstra().
+	 * @param edge Edge to be checked.
+	 * @return If the flow on the edge is below its usable capacity.
+	 */
+	inline bool HasFreeCapacity(const Edge &edge) const
+	{
+		return static_cast<int>(this->EdgeCapacity(edge) - edge.Flow()) > 0;
+	}
+
 	uint PushFlow(Node &node, NodeID to, Path *path, uint accuracy, uint max_saturation);
 
 	void CleanupPaths(NodeID source, PathVector &paths);
+	void DeletePaths(PathVector &paths);
 
 	LinkGraphJob &job;   ///< Job we're working with.
 	uint max_saturation; ///< Maximum saturation for edges.
+	bool flat_dijkstra;  ///< Use FlatDijkstra() instead of Dijkstra().
 };
 
 /**
@@ -45,15 +65,21 @@ protected:
  *   time it will take.
  * - You can increase the recalculation interval to allow for longer running
  *   times without creating lags.
+ * On large components the shortest paths of several sources are searched in
+ * parallel. The result is the same as with a serial search.
  */
 class MCF1stPass : public MultiCommodityFlow {
 private:
+	bool saturation_changed;     ///< If an edge ran out of capacity since the last call to Dijkstra().
+	std::vector<bool> path_free; ///< Scratch buffer for PushFlowTracked().
+
+	uint PushFlowTracked(Node &node, NodeID to, Path *path, uint accuracy, uint max_saturation);
 	bool EliminateCycles();
 	bool EliminateCycles(PathVector &path, NodeID origin_id, NodeID next_id);
 	void EliminateCycle(PathVector &path, Path *cycle_begin, uint flow);
 	uint FindCycleFlow(const PathVector &path, const Path *cycle_begin);
 public:
-	MCF1stPass(LinkGraphJob &job);
+	MCF1stPass(LinkGraphJob &job, bool flat_dijkstra);
 };
 
 /**
@@ -65,7 +91,7 @@ public:
  */
 class MCF2ndPass : public MultiCommodityFlow {
 public:
-	MCF2ndPass(LinkGraphJob &job);
+	MCF2ndPass(LinkGraphJob &job, bool flat_dijkstra);
 };
 
 /**
@@ -80,7 +106,7 @@ public:
 	 * Run the calculation.
 	 * @param graph Component to be calculated.
 	 */
-	void Run(LinkGraphJob &job) const override { Tpass pass(job); }
+	void Run(LinkGraphJob &job) const override { Tpass pass(job, job.UseFlatDijkstra()); }
 };
 
 #endif /* MCF_H */
@@ -14,6 +14,8 @@
 #include "error_func.h"
 #include "string_func.h"
 #include "pathfinder/water_regions.h"
+#include "vehicle_func.h"
+#include "station_func.h"
 #include "citymania/cm_highlight.hpp"
 
 #include "safeguards.h"
@@ -66,6 +68,8 @@ extern "C" _CRTIMP void __cdecl _assert(void *, void *, unsigned);
 	Tile::extended_tiles = CallocT<Tile::TileExtended>(Map::size);
 
 	AllocateWaterRegions();
+	AllocateVehicleTileHash();
+	AllocateAcceptanceChunks();
 	citymania::AllocateZoningMap(Map::size);
 }
 
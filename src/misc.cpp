@@ -32,6 +32,8 @@
 #include "town_kdtree.h"
 #include "viewport_kdtree.h"
 #include "newgrf_profiling.h"
+#include "screenshot.h"
+#include "pathfinder/yapf/yapf_cache.h"
 #include "3rdparty/monocypher/monocypher.h"
 
 #include "safeguards.h"
@@ -129,7 +131,10 @@ void InitializeGame(uint size_x, uint size_y, bool reset_date, bool reset_settin
 
 	RebuildStationKdtree();
 	RebuildTownKdtree();
+	RebuildTownGrowthSchedule();
 	RebuildViewportKdtree();
+	ResetTilePyramid();
+	YapfNotifyTrackLayoutChange(INVALID_TILE, INVALID_TRACK);
 
 	ResetPersistentNewGRFData();
 
@@ -5319,6 +5319,8 @@ static void NewSpriteGroup(ByteReader *buf)
 				}
 			}
 
+			group->Compile();
+
 			break;
 		}
 
@@ -8865,6 +8867,7 @@ void ResetNewGRFData()
 	_grf_id_overrides.clear();
 
 	InitializeSoundPool();
+	ClearSpriteGroupResolveCache();
 	_spritegroup_pool.CleanPool();
 }
 
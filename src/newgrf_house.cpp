@@ -414,6 +414,21 @@ static uint32_t GetDistanceFromNearbyHouse(uint8_t parameter, TileIndex tile, Ho
 	return UINT_MAX;
 }
 
+/* virtual */ bool HouseScopeResolver::IsCacheableVariable(byte variable) const
+{
+	switch (variable) {
+		/* Cheap reads of the house, its tile, the town and nearby tiles. Not the
+		 * station acceptance (0x64), which also depends on a register, nor the
+		 * distance search (0x65). */
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+		case 0x60: case 0x61: case 0x62: case 0x63: case 0x66: case 0x67:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 uint16_t GetHouseCallback(CallbackID callback, uint32_t param1, uint32_t param2, HouseID house_id, Town *town, TileIndex tile,
 		bool not_yet_constructed, uint8_t initial_random_bits, CargoTypes watched_cargo_triggers)
 {
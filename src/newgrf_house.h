@@ -44,6 +44,7 @@ struct HouseScopeResolver : public ScopeResolver {
 
 	uint32_t GetRandomBits() const override;
 	uint32_t GetVariable(byte variable, [[maybe_unused]] uint32_t parameter, bool *available) const override;
+	bool IsCacheableVariable(byte variable) const override;
 	uint32_t GetTriggers() const override;
 };
 
@@ -99,6 +99,18 @@ uint32_t GetRelativePosition(TileIndex tile, TileIndex ind_tile)
 	return UINT_MAX;
 }
 
+/* virtual */ bool IndustryTileScopeResolver::IsCacheableVariable(byte variable) const
+{
+	/* Everything but the town zone (0x42), which searches for the closest town. */
+	switch (variable) {
+		case 0x40: case 0x41: case 0x43: case 0x44: case 0x60: case 0x61: case 0x62:
+			return true;
+
+		default:
+			return false;
+	}
+}
+
 /* virtual */ uint32_t IndustryTileScopeResolver::GetRandomBits() const
 {
 	assert(this->industry != nullptr && IsValidTile(this->tile));
@@ -12,6 +12,9 @@
 #include "string_func.h"
 #include "console_func.h"
 #include "spritecache.h"
+#include "industry.h"
+#include "newgrf_industrytiles.h"
+#include "settings_type.h"
 #include "3rdparty/fmt/chrono.h"
 #include "timer/timer.h"
 #include "timer/timer_game_tick.h"
@@ -27,7 +30,7 @@ std::vector<NewGRFProfiler> _newgrf_profilers;
  * @param grffile   The GRF file to collect profiling data on
  * @param end_date  Game date to end profiling on
  */
-NewGRFProfiler::NewGRFProfiler(const GRFFile *grffile) : grffile{ grffile }, active{ false }, cur_call{}
+NewGRFProfiler::NewGRFProfiler(const GRFFile *grffile) : grffile{ grffile }, active{ false }, cur_call{}, cache_lookups{ 0 }, cache_hits{ 0 }
 {
 }
 
@@ -103,6 +106,9 @@ uint32_t NewGRFProfiler::Finish()
 
 	std::string filename = this->GetOutputFilename();
 	IConsolePrint(CC_DEBUG, "Finished profile of NewGRF [{:08X}], writing {} events to '{}'.", BSWAP32(this->grffile->grfid), this->calls.size(), filename);
+	if (this->cache_lookups > 0) {
+		IConsolePrint(CC_DEBUG, "Resolution cache answered {} of {} lookups ({}%).", this->cache_hits, this->cache_lookups, this->cache_hits * 100ULL / this->cache_lookups);
+	}
 
 	FILE *f = FioFOpenFile(filename, "wt", Subdirectory::NO_DIRECTORY);
 	FileCloser fcloser(f);
@@ -123,6 +129,8 @@ void NewGRFProfiler::Abort()
 {
 	this->active = false;
 	this->calls.clear();
+	this->cache_lookups = 0;
+	this->cache_hits = 0;
 }
 
 /**
@@ -177,3 +185,46 @@ static TimeoutTimer<TimerGameTick> _profiling_finish_timeout(0, []()
 {
 	_profiling_finish_timeout.Abort();
 }
+
+/**
+ * Measure the resolution throughput of the industry tile sprites on the map.
+ * The resolution cache is turned off while measuring, so the resolutions
+ * themselves are timed.
+ * @param iterations Number of times to resolve the sprites of every industry tile.
+ */
+/* static */ void NewGRFProfiler::Benchmark(uint iterations)
+{
+	using namespace std::chrono;
+
+	std::vector<std::pair<TileIndex, Industry *>> tiles;
+	for (Industry *ind : Industry::Iterate()) {
+		for (TileIndex tile : ind->location) {
+			if (!ind->TileBelongsToIndustry(tile)) continue;
+			if (GetIndustryTileSpec(GetIndustryGfx(tile))->grf_prop.spritegroup[0] == nullptr) continue;
+			tiles.emplace_back(tile, ind);
+		}
+	}
+
+	if (tiles.empty()) {
+		IConsolePrint(CC_ERROR, "No NewGRF industry tiles on the map, nothing to benchmark.");
+		return;
+	}
+
+	bool resolve_cache = _settings_client.gui.newgrf_resolve_cache;
+	_settings_client.gui.newgrf_resolve_cache = false;
+
+	auto start = high_resolution_clock::now();
+	for (uint i = 0; i < iterations; i++) {
+		for (const auto &[tile, ind] : tiles) {
+			IndustryTileResolverObject object(GetIndustryGfx(tile), tile, ind);
+			object.Resolve();
+		}
+	}
+	int64_t elapsed_us = std::max<int64_t>(duration_cast<microseconds>(high_resolution_clock::now() - start).count(), 1);
+
+	_settings_client.gui.newgrf_resolve_cache = resolve_cache;
+
+	uint64_t resolutions = (uint64_t)tiles.size() * iterations;
+	IConsolePrint(CC_DEBUG, "Resolved {} industry tiles {} times.", tiles.size(), iterations);
+	IConsolePrint(CC_DEBUG, "{} microseconds, {} resolutions per second.", elapsed_us, resolutions * 1000000 / elapsed_us);
+}
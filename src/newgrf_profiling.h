@@ -36,6 +36,7 @@ struct NewGRFProfiler {
 	static void StartTimer(uint64_t ticks);
 	static void AbortTimer();
 	static uint32_t FinishAll();
+	static void Benchmark(uint iterations);
 
 	/** Measurement of a single sprite group resolution */
 	struct Call {
@@ -54,6 +55,8 @@ struct NewGRFProfiler {
 	uint64_t start_tick;       ///< Tick number this profiler was started on
 	Call cur_call;           ///< Data for current call in progress
 	std::vector<Call> calls; ///< All calls collected so far
+	uint32_t cache_lookups;  ///< Resolutions looked up in the resolution cache
+	uint32_t cache_hits;     ///< Resolutions answered by the resolution cache
 };
 
 extern std::vector<NewGRFProfiler> _newgrf_profilers;
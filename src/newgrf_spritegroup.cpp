@@ -11,8 +11,12 @@
 #include "debug.h"
 #include "newgrf_spritegroup.h"
 #include "newgrf_profiling.h"
+#include "settings_type.h"
 #include "core/pool_func.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "safeguards.h"
 
 SpriteGroupPool _spritegroup_pool("SpriteGroup");
@@ -21,6 +25,219 @@ INSTANTIATE_POOL_METHODS(SpriteGroup)
 TemporaryStorageArray<int32_t, 0x110> _temp_store;
 
 
+/** Maximum number of scope variables a cached resolution may depend on. */
+static const uint RESOLVE_CACHE_MAX_INPUTS = 8;
+/** Number of cached resolutions at which the cache is flushed. */
+static const size_t RESOLVE_CACHE_MAX_ENTRIES = 1 << 16;
+
+/** Scope variable read by a sprite group chain, i.e. one of the inputs its result depends on. */
+struct ResolveCacheInput {
+	VarSpriteGroupScope scope; ///< Scope the variable is read from.
+	byte relative;             ///< Relative scope parameter, as used by randomised groups.
+	byte variable;             ///< Variable to read, 0x5F for the random bits and triggers.
+	uint32_t parameter;        ///< Parameter of 60+x variables.
+
+	bool operator==(const ResolveCacheInput &other) const = default;
+};
+
+/** Inputs of a top-level sprite group chain, if its result only depends on those. */
+struct ResolveCacheAnalysis {
+	bool cacheable = true;                 ///< Whether results of the chain may be cached at all.
+	std::vector<ResolveCacheInput> inputs; ///< Scope variables the result depends on.
+};
+
+/** Everything a cacheable resolution depends on. */
+struct ResolveCacheKey {
+	const SpriteGroup *group;  ///< Top-level sprite group.
+	CallbackID callback;       ///< Callback being resolved.
+	uint32_t callback_param1;  ///< First callback parameter.
+	uint32_t callback_param2;  ///< Second callback parameter.
+	uint32_t last_value;       ///< Initial value of variable 0x1C.
+	uint8_t unavailable;       ///< Bitmask of inputs that are not available for the scope.
+	std::array<uint32_t, RESOLVE_CACHE_MAX_INPUTS> values; ///< Values of the inputs of the analysis.
+
+	bool operator==(const ResolveCacheKey &other) const = default;
+};
+
+/** Hash function for #ResolveCacheKey. */
+struct ResolveCacheKeyHash {
+	size_t operator()(const ResolveCacheKey &key) const
+	{
+		size_t hash = std::hash<const SpriteGroup *>{}(key.group);
+		auto combine = [&hash](uint32_t value) { hash ^= value + 0x9E3779B9 + (hash << 6) + (hash >> 2); };
+		combine(key.callback);
+		combine(key.callback_param1);
+		combine(key.callback_param2);
+		combine(key.last_value);
+		combine(key.unavailable);
+		for (uint32_t value : key.values) combine(value);
+		return hash;
+	}
+};
+
+/** Cached outcome of a resolution. */
+struct ResolveCacheEntry {
+	const SpriteGroup *result;  ///< Resolved sprite group.
+	uint32_t calculated_result; ///< Callback result, if \c result is the calculated result group.
+	uint32_t last_value;        ///< Value of variable 0x1C after the resolution.
+};
+
+static std::unordered_map<const SpriteGroup *, ResolveCacheAnalysis> _resolve_cache_analysis; ///< Inputs of the top-level sprite groups seen so far.
+static std::unordered_map<ResolveCacheKey, ResolveCacheEntry, ResolveCacheKeyHash> _resolve_cache; ///< Cached resolutions.
+
+/**
+ * Get the group returned for deterministic groups turning their value into a callback result.
+ * @return The shared calculated result group.
+ */
+static CallbackResultSpriteGroup &GetCalculatedResultGroup()
+{
+	static CallbackResultSpriteGroup nvarzero(0, true);
+	return nvarzero;
+}
+
+/**
+ * Clear all cached resolutions, e.g. because the sprite groups are freed.
+ */
+void ClearSpriteGroupResolveCache()
+{
+	_resolve_cache_analysis.clear();
+	_resolve_cache.clear();
+}
+
+/**
+ * Add an input to the analysis of a sprite group chain.
+ * @param analysis Analysis to add the input to.
+ * @param input The scope variable that is read.
+ * @return False if the chain depends on too many inputs to be cached.
+ */
+static bool AddResolveCacheInput(ResolveCacheAnalysis &analysis, const ResolveCacheInput &input)
+{
+	if (std::find(analysis.inputs.begin(), analysis.inputs.end(), input) != analysis.inputs.end()) return true;
+	if (analysis.inputs.size() == RESOLVE_CACHE_MAX_INPUTS) return false;
+
+	analysis.inputs.push_back(input);
+	return true;
+}
+
+/**
+ * Collect the inputs of a sprite group chain.
+ * A chain is only cacheable if it is a pure function of its inputs: it may not
+ * use the temporary or persistent storage, global variables or real sprite
+ * groups, and the scopes must declare all variables it reads cacheable.
+ * @param group Sprite group to analyse, including all groups it refers to.
+ * @param object Resolver object the chain is resolved for.
+ * @param analysis Analysis to add the inputs to.
+ * @param visited Groups that have already been analysed.
+ * @return True if the chain is cacheable.
+ */
+static bool AnalyseResolveCacheInputs(const SpriteGroup *group, ResolverObject &object, ResolveCacheAnalysis &analysis, std::unordered_set<const SpriteGroup *> &visited)
+{
+	if (group == nullptr || !visited.insert(group).second) return true;
+
+	switch (group->type) {
+		case SGT_REAL: return false;
+
+		case SGT_DETERMINISTIC: {
+			const DeterministicSpriteGroup *dsg = static_cast<const DeterministicSpriteGroup *>(group);
+			for (const auto &adjust : dsg->adjusts) {
+				if (adjust.operation == DSGA_OP_STO || adjust.operation == DSGA_OP_STOP) return false;
+
+				switch (adjust.variable) {
+					/* Part of every key or constant for the game. */
+					case 0x0C: case 0x10: case 0x18: case 0x1C: case 0x7F: break;
+
+					case 0x5F:
+						if (!AddResolveCacheInput(analysis, {dsg->var_scope, 0, 0x5F, 0})) return false;
+						break;
+
+					case 0x7E:
+						if (!AnalyseResolveCacheInputs(adjust.subroutine, object, analysis, visited)) return false;
+						break;
+
+					default:
+						/* Global variables, indirect access and temporary storage. */
+						if (adjust.variable < 0x40 || adjust.variable == 0x7B || adjust.variable == 0x7D) return false;
+						if (!object.GetScope(dsg->var_scope)->IsCacheableVariable(adjust.variable)) return false;
+						if (!AddResolveCacheInput(analysis, {dsg->var_scope, 0, adjust.variable, adjust.parameter})) return false;
+						break;
+				}
+			}
+
+			for (const auto &range : dsg->ranges) {
+				if (!AnalyseResolveCacheInputs(range.group, object, analysis, visited)) return false;
+			}
+			return AnalyseResolveCacheInputs(dsg->default_group, object, analysis, visited) &&
+					AnalyseResolveCacheInputs(dsg->error_group, object, analysis, visited);
+		}
+
+		case SGT_RANDOMIZED: {
+			const RandomizedSpriteGroup *rsg = static_cast<const RandomizedSpriteGroup *>(group);
+			if (!AddResolveCacheInput(analysis, {rsg->var_scope, rsg->count, 0x5F, 0})) return false;
+			for (const SpriteGroup *sub : rsg->groups) {
+				if (!AnalyseResolveCacheInputs(sub, object, analysis, visited)) return false;
+			}
+			return true;
+		}
+
+		default: return true;
+	}
+}
+
+/**
+ * Resolve a top-level sprite group, reusing the result of an earlier
+ * resolution with the same inputs if the chain allows it.
+ * @param group the group to resolve for
+ * @param object information needed to resolve the group
+ * @param profiler profiler collecting the cache statistics, if any
+ * @return the resolved group
+ */
+/* static */ const SpriteGroup *SpriteGroup::ResolveCached(const SpriteGroup *group, ResolverObject &object, NewGRFProfiler *profiler)
+{
+	/* Random triggers change the resolver state, not just the result. */
+	if (object.callback == CBID_RANDOM_TRIGGER) return group->Resolve(object);
+
+	auto it = _resolve_cache_analysis.find(group);
+	if (it == _resolve_cache_analysis.end()) {
+		ResolveCacheAnalysis analysis;
+		std::unordered_set<const SpriteGroup *> visited;
+		analysis.cacheable = AnalyseResolveCacheInputs(group, object, analysis, visited);
+		if (!analysis.cacheable) analysis.inputs.clear();
+		it = _resolve_cache_analysis.emplace(group, std::move(analysis)).first;
+	}
+	const ResolveCacheAnalysis &analysis = it->second;
+	if (!analysis.cacheable) return group->Resolve(object);
+
+	ResolveCacheKey key{group, object.callback, object.callback_param1, object.callback_param2, object.last_value, 0, {}};
+	for (uint i = 0; i < analysis.inputs.size(); i++) {
+		const ResolveCacheInput &input = analysis.inputs[i];
+		ScopeResolver *scope = object.GetScope(input.scope, input.relative);
+		if (input.variable == 0x5F) {
+			key.values[i] = (scope->GetRandomBits() << 8) | scope->GetTriggers();
+		} else {
+			bool available = true;
+			key.values[i] = scope->GetVariable(input.variable, input.parameter, &available);
+			if (!available) SetBit(key.unavailable, i);
+		}
+	}
+
+	CallbackResultSpriteGroup &calculated = GetCalculatedResultGroup();
+	if (profiler != nullptr) profiler->cache_lookups++;
+
+	auto entry = _resolve_cache.find(key);
+	if (entry != _resolve_cache.end()) {
+		if (profiler != nullptr) profiler->cache_hits++;
+		object.last_value = entry->second.last_value;
+		if (entry->second.result == &calculated) calculated.result = entry->second.calculated_result;
+		return entry->second.result;
+	}
+
+	const SpriteGroup *result = group->Resolve(object);
+	if (_resolve_cache.size() >= RESOLVE_CACHE_MAX_ENTRIES) _resolve_cache.clear();
+	uint32_t calculated_result = (result == &calculated) ? calculated.result : 0;
+	_resolve_cache.emplace(key, ResolveCacheEntry{result, calculated_result, object.last_value});
+	return result;
+}
+
 /**
  * ResolverObject (re)entry point.
  * This cannot be made a call to a virtual function because virtual functions
@@ -39,12 +256,14 @@ TemporaryStorageArray<int32_t, 0x110> _temp_store;
 	auto profiler = std::find_if(_newgrf_profilers.begin(), _newgrf_profilers.end(), [&](const NewGRFProfiler &pr) { return pr.grffile == grf; });
 
 	if (profiler == _newgrf_profilers.end() || !profiler->active) {
-		if (top_level) _temp_store.ClearChanges();
-		return group->Resolve(object);
+		if (!top_level) return group->Resolve(object);
+
+		_temp_store.ClearChanges();
+		return _settings_client.gui.newgrf_resolve_cache ? ResolveCached(group, object, nullptr) : group->Resolve(object);
 	} else if (top_level) {
 		profiler->BeginResolve(object);
 		_temp_store.ClearChanges();
-		const SpriteGroup *result = group->Resolve(object);
+		const SpriteGroup *result = _settings_client.gui.newgrf_resolve_cache ? ResolveCached(group, object, &*profiler) : group->Resolve(object);
 		profiler->EndResolve(result);
 		return result;
 	} else {
@@ -110,6 +329,18 @@ static inline uint32_t GetVariable(const ResolverObject &object, ScopeResolver *
 	return UINT_MAX;
 }
 
+/**
+ * Check whether a variable only depends on the state the scope resolves
+ * for, so the result of a sprite group chain reading it may be cached.
+ * Default implementation has no cacheable variables.
+ * @param variable Variable to check.
+ * @return True if the variable can be part of a cached resolution.
+ */
+/* virtual */ bool ScopeResolver::IsCacheableVariable([[maybe_unused]] byte variable) const
+{
+	return false;
+}
+
 /**
  * Store a value into the persistent storage area (PSA). Default implementation does nothing (for newgrf classes without storage).
  */
@@ -140,7 +371,7 @@ static inline uint32_t GetVariable(const ResolverObject &object, ScopeResolver *
 /* Evaluate an adjustment for a variable of the given size.
  * U is the unsigned type and S is the signed type to use. */
 template <typename U, typename S>
-static U EvalAdjustT(const DeterministicSpriteGroupAdjust &adjust, ScopeResolver *scope, U last_value, uint32_t value)
+static U EvalAdjustT(const DeterministicSpriteGroupInstruction &adjust, ScopeResolver *scope, U last_value, uint32_t value)
 {
 	value >>= adjust.shift_num;
 	value  &= adjust.and_mask;
@@ -180,79 +411,136 @@ static U EvalAdjustT(const DeterministicSpriteGroupAdjust &adjust, ScopeResolver
 }
 
 
-static bool RangeHighComparator(const DeterministicSpriteGroupRange &range, uint32_t value)
+/**
+ * Compile the adjustments into a program with the source of each value
+ * decoded, and the ranges into a table covering all values.
+ * To be called once all adjustments and ranges are read.
+ */
+void DeterministicSpriteGroup::Compile()
 {
-	return range.high < value;
+	this->program.clear();
+	for (const auto &adjust : this->adjusts) {
+		DeterministicSpriteGroupInstruction &insn = this->program.emplace_back();
+		insn.operation = adjust.operation;
+		insn.type = adjust.type;
+		insn.variable = adjust.variable;
+		insn.shift_num = adjust.shift_num;
+		insn.parameter = adjust.parameter;
+		insn.and_mask = adjust.and_mask;
+		insn.add_val = adjust.add_val;
+		insn.divmod_val = adjust.divmod_val;
+		insn.subroutine = nullptr;
+
+		switch (adjust.variable) {
+			case 0x0C: insn.source = DSGS_CALLBACK; break;
+			case 0x10: insn.source = DSGS_CALLBACK_PARAM1; break;
+			case 0x18: insn.source = DSGS_CALLBACK_PARAM2; break;
+			case 0x1C: insn.source = DSGS_LAST_VALUE; break;
+			case 0x5F: insn.source = DSGS_RANDOM; break;
+			case 0x7B: insn.source = DSGS_INDIRECT; insn.variable = adjust.parameter; break;
+			case 0x7D: insn.source = DSGS_TEMP_STORE; break;
+			case 0x7E: insn.source = DSGS_SUBROUTINE; insn.subroutine = adjust.subroutine; break;
+			case 0x7F: insn.source = DSGS_GRF_PARAM; break;
+			default:   insn.source = adjust.variable < 0x40 ? DSGS_GLOBAL : DSGS_SCOPE; break;
+		}
+	}
+
+	/* The ranges are sorted and do not overlap; fill the gaps with the default group. */
+	this->range_bounds.assign(1, 0);
+	this->range_groups.assign(1, this->default_group);
+	for (const auto &range : this->ranges) {
+		if (range.low == this->range_bounds.back()) {
+			this->range_groups.back() = range.group;
+		} else {
+			this->range_bounds.push_back(range.low);
+			this->range_groups.push_back(range.group);
+		}
+		if (range.high != UINT32_MAX) {
+			this->range_bounds.push_back(range.high + 1);
+			this->range_groups.push_back(this->default_group);
+		}
+	}
 }
 
-const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+/**
+ * Run the compiled adjustments.
+ * @tparam U Unsigned type of the group size.
+ * @tparam S Signed type of the group size.
+ * @param object Information needed to resolve the group.
+ * @param scope Scope of the group.
+ * @param[out] available Set to false if a variable is not available.
+ * @return Result of the last adjustment.
+ */
+template <typename U, typename S>
+uint32_t DeterministicSpriteGroup::RunProgram(ResolverObject &object, ScopeResolver *scope, bool *available) const
 {
 	uint32_t last_value = 0;
-	uint32_t value = 0;
-
-	ScopeResolver *scope = object.GetScope(this->var_scope);
 
-	for (const auto &adjust : this->adjusts) {
-		/* Try to get the variable. We shall assume it is available, unless told otherwise. */
-		bool available = true;
-		if (adjust.variable == 0x7E) {
-			const SpriteGroup *subgroup = SpriteGroup::Resolve(adjust.subroutine, object, false);
-			if (subgroup == nullptr) {
-				value = CALLBACK_FAILED;
-			} else {
-				value = subgroup->GetCallbackResult();
+	for (const auto &insn : this->program) {
+		uint32_t value;
+		switch (insn.source) {
+			case DSGS_CALLBACK:        value = object.callback; break;
+			case DSGS_CALLBACK_PARAM1: value = object.callback_param1; break;
+			case DSGS_CALLBACK_PARAM2: value = object.callback_param2; break;
+			case DSGS_LAST_VALUE:      value = object.last_value; break;
+			case DSGS_RANDOM:          value = (scope->GetRandomBits() << 8) | scope->GetTriggers(); break;
+			case DSGS_TEMP_STORE:      value = _temp_store.GetValue(insn.parameter); break;
+			case DSGS_GRF_PARAM:       value = object.grffile == nullptr ? 0 : object.grffile->GetParam(insn.parameter); break;
+
+			case DSGS_SUBROUTINE: {
+				/* Note: 'last_value' and 'reseed' are shared between the main chain and the procedure */
+				const SpriteGroup *subgroup = SpriteGroup::Resolve(insn.subroutine, object, false);
+				value = subgroup == nullptr ? CALLBACK_FAILED : subgroup->GetCallbackResult();
+				break;
 			}
 
-			/* Note: 'last_value' and 'reseed' are shared between the main chain and the procedure */
-		} else if (adjust.variable == 0x7B) {
-			value = GetVariable(object, scope, adjust.parameter, last_value, &available);
-		} else {
-			value = GetVariable(object, scope, adjust.variable, adjust.parameter, &available);
+			case DSGS_INDIRECT: value = GetVariable(object, scope, insn.variable, last_value, available); break;
+			case DSGS_GLOBAL:   value = GetVariable(object, scope, insn.variable, insn.parameter, available); break;
+			case DSGS_SCOPE:    value = scope->GetVariable(insn.variable, insn.parameter, available); break;
+			default: NOT_REACHED();
 		}
 
-		if (!available) {
-			/* Unsupported variable: skip further processing and return either
-			 * the group from the first range or the default group. */
-			return SpriteGroup::Resolve(this->error_group, object, false);
-		}
+		if (!*available) return 0;
 
-		switch (this->size) {
-			case DSG_SIZE_BYTE:  value = EvalAdjustT<uint8_t,  int8_t> (adjust, scope, last_value, value); break;
-			case DSG_SIZE_WORD:  value = EvalAdjustT<uint16_t, int16_t>(adjust, scope, last_value, value); break;
-			case DSG_SIZE_DWORD: value = EvalAdjustT<uint32_t, int32_t>(adjust, scope, last_value, value); break;
-			default: NOT_REACHED();
-		}
-		last_value = value;
+		last_value = EvalAdjustT<U, S>(insn, scope, last_value, value);
+	}
+
+	return last_value;
+}
+
+const SpriteGroup *DeterministicSpriteGroup::Resolve(ResolverObject &object) const
+{
+	ScopeResolver *scope = object.GetScope(this->var_scope);
+
+	bool available = true;
+	uint32_t value;
+	switch (this->size) {
+		case DSG_SIZE_BYTE:  value = this->RunProgram<uint8_t,  int8_t> (object, scope, &available); break;
+		case DSG_SIZE_WORD:  value = this->RunProgram<uint16_t, int16_t>(object, scope, &available); break;
+		case DSG_SIZE_DWORD: value = this->RunProgram<uint32_t, int32_t>(object, scope, &available); break;
+		default: NOT_REACHED();
 	}
 
-	object.last_value = last_value;
+	if (!available) {
+		/* Unsupported variable: skip further processing and return either
+		 * the group from the first range or the default group. */
+		return SpriteGroup::Resolve(this->error_group, object, false);
+	}
+
+	object.last_value = value;
 
 	if (this->calculated_result) {
 		/* nvar == 0 is a special case -- we turn our value into a callback result */
 		if (value != CALLBACK_FAILED) value = GB(value, 0, 15);
-		static CallbackResultSpriteGroup nvarzero(0, true);
+		CallbackResultSpriteGroup &nvarzero = GetCalculatedResultGroup();
 		nvarzero.result = value;
 		return &nvarzero;
 	}
 
-	if (this->ranges.size() > 4) {
-		const auto &lower = std::lower_bound(this->ranges.begin(), this->ranges.end(), value, RangeHighComparator);
-		if (lower != this->ranges.end() && lower->low <= value) {
-			assert(lower->low <= value && value <= lower->high);
-			return SpriteGroup::Resolve(lower->group, object, false);
-		}
-	} else {
-		for (const auto &range : this->ranges) {
-			if (range.low <= value && value <= range.high) {
-				return SpriteGroup::Resolve(range.group, object, false);
-			}
-		}
-	}
-
-	return SpriteGroup::Resolve(this->default_group, object, false);
+	size_t index = std::upper_bound(this->range_bounds.begin(), this->range_bounds.end(), value) - this->range_bounds.begin() - 1;
+	return SpriteGroup::Resolve(this->range_groups[index], object, false);
 }
 
-
 const SpriteGroup *RandomizedSpriteGroup::Resolve(ResolverObject &object) const
 {
 	ScopeResolver *scope = object.GetScope(this->var_scope, this->count);
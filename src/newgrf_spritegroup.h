@@ -46,6 +46,7 @@ enum SpriteGroupType {
 struct SpriteGroup;
 typedef uint32_t SpriteGroupID;
 struct ResolverObject;
+struct ScopeResolver;
 
 /* SPRITE_WIDTH is 24. ECS has roughly 30 sprite groups per real sprite.
  * Adding an 'extra' margin would be assuming 64 sprite groups per real
@@ -60,6 +61,8 @@ protected:
 	/** Base sprite group resolver */
 	virtual const SpriteGroup *Resolve([[maybe_unused]] ResolverObject &object) const { return this; };
 
+	static const SpriteGroup *ResolveCached(const SpriteGroup *group, ResolverObject &object, struct NewGRFProfiler *profiler);
+
 public:
 	virtual ~SpriteGroup() = default;
 
@@ -163,6 +166,35 @@ struct DeterministicSpriteGroupRange {
 	uint32_t high;
 };
 
+/** Where a compiled adjustment takes its value from, decoded from the variable number at load time. */
+enum DeterministicSpriteGroupSource : uint8_t {
+	DSGS_CALLBACK,        ///< Callback number (0x0C).
+	DSGS_CALLBACK_PARAM1, ///< First callback parameter (0x10).
+	DSGS_CALLBACK_PARAM2, ///< Second callback parameter (0x18).
+	DSGS_LAST_VALUE,      ///< Result of the previous deterministic group (0x1C).
+	DSGS_RANDOM,          ///< Random bits and triggers of the scope (0x5F).
+	DSGS_TEMP_STORE,      ///< Temporary storage register (0x7D).
+	DSGS_GRF_PARAM,       ///< GRF parameter (0x7F).
+	DSGS_SUBROUTINE,      ///< Callback result of a procedure (0x7E).
+	DSGS_INDIRECT,        ///< Variable with the previous result as parameter (0x7B).
+	DSGS_GLOBAL,          ///< Global variable, or a scope variable below 0x40.
+	DSGS_SCOPE,           ///< Variable of the scope.
+};
+
+/** Adjustment of a compiled deterministic sprite group. */
+struct DeterministicSpriteGroupInstruction {
+	DeterministicSpriteGroupSource source;
+	DeterministicSpriteGroupAdjustOperation operation;
+	DeterministicSpriteGroupAdjustType type;
+	byte variable;  ///< Variable to read, for #DSGS_INDIRECT the variable given by the parameter.
+	byte shift_num;
+	uint32_t parameter;
+	uint32_t and_mask;
+	uint32_t add_val;
+	uint32_t divmod_val;
+	const SpriteGroup *subroutine;
+};
+
 
 struct DeterministicSpriteGroup : SpriteGroup {
 	DeterministicSpriteGroup() : SpriteGroup(SGT_DETERMINISTIC) {}
@@ -178,8 +210,18 @@ struct DeterministicSpriteGroup : SpriteGroup {
 
 	const SpriteGroup *error_group; // was first range, before sorting ranges
 
+	std::vector<DeterministicSpriteGroupInstruction> program; ///< Adjustments with decoded value sources.
+	std::vector<uint32_t> range_bounds;                       ///< Lowest value of each consecutive part of the value range, starting at 0.
+	std::vector<const SpriteGroup *> range_groups;            ///< Group for each part of #range_bounds, including the default group.
+
+	void Compile();
+
 protected:
 	const SpriteGroup *Resolve(ResolverObject &object) const override;
+
+private:
+	template <typename U, typename S>
+	uint32_t RunProgram(ResolverObject &object, ScopeResolver *scope, bool *available) const;
 };
 
 enum RandomizedSpriteGroupCompareMode {
@@ -295,6 +337,7 @@ struct ScopeResolver {
 	virtual uint32_t GetTriggers() const;
 
 	virtual uint32_t GetVariable(byte variable, [[maybe_unused]] uint32_t parameter, bool *available) const;
+	virtual bool IsCacheableVariable(byte variable) const;
 	virtual void StorePSA(uint reg, int32_t value);
 };
 
@@ -405,4 +448,6 @@ struct ResolverObject {
 	virtual uint32_t GetDebugID() const { return 0; }
 };
 
+void ClearSpriteGroupResolveCache();
+
 #endif /* NEWGRF_SPRITEGROUP_H */
@@ -131,6 +131,7 @@ void BuildObject(ObjectType type, TileIndex tile, CompanyID owner, Town *town, u
 		if (remove) RemoveDockingTile(t);
 		MarkTileDirtyByTile(t);
 	}
+	InvalidateAcceptanceChunks(ta);
 
 	Object::IncTypeCount(type);
 	if (spec->flags & OBJECT_FLAG_ANIMATION) TriggerObjectAnimation(o, OAT_BUILT, spec);
@@ -169,9 +170,12 @@ void UpdateCompanyHQ(TileIndex tile, uint score)
 	if (score >= 520) val++;
 	if (score >= 720) val++;
 
+	if (GetCompanyHQSize(tile) >= val) return;
+
 	while (GetCompanyHQSize(tile) < val) {
 		IncreaseCompanyHQSize(tile);
 	}
+	InvalidateAcceptanceChunks(Object::GetByTile(tile)->location);
 }
 
 /**
@@ -519,6 +523,7 @@ static void ReallyClearObjectTile(Object *o)
 
 		MakeWaterKeepingClass(tile_cur, GetTileOwner(tile_cur));
 	}
+	InvalidateAcceptanceChunks(o->location);
 	delete o;
 }
 
@@ -955,4 +960,6 @@ extern const TileTypeProcs _tile_type_object_procs = {
 	nullptr,                        // vehicle_enter_tile_proc
 	GetFoundation_Object,        // get_foundation_proc
 	TerraformTile_Object,        // terraform_tile_proc
+	nullptr,                     // tile_loop_plan_proc
+	nullptr,                     // tile_loop_apply_proc
 };
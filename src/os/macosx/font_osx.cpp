@@ -11,7 +11,6 @@
 #include "../../debug.h"
 #include "font_osx.h"
 #include "../../core/math_func.hpp"
-#include "../../blitter/factory.hpp"
 #include "../../error_func.h"
 #include "../../fileio_func.h"
 #include "../../fontdetection.h"
@@ -290,7 +289,7 @@ const Sprite *CoreTextFontCache::InternalGetGlyph(GlyphID key, bool use_aa)
 	}
 
 	GlyphEntry new_glyph;
-	new_glyph.sprite = BlitterFactory::GetCurrentBlitter()->Encode(spritecollection, SimpleSpriteAlloc);
+	new_glyph.sprite = this->atlas.Encode(spritecollection);
 	new_glyph.width = (byte)std::round(CTFontGetAdvancesForGlyphs(this->font.get(), kCTFontOrientationDefault, &glyph, nullptr, 1));
 	this->SetGlyphPtr(key, &new_glyph);
 
@@ -10,9 +10,109 @@
 #ifndef NODELIST_HPP
 #define NODELIST_HPP
 
-#include "../../misc/array.hpp"
 #include "../../misc/hashtable.hpp"
 #include "../../misc/binaryheap.hpp"
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Block arena holding the node data of one path search.
+ *  Nodes never move once created, so the hash tables and the priority queue
+ *  can keep pointers to them. Blocks are handed back to a per-thread spare
+ *  list when the search ends, so consecutive searches of the same pathfinder
+ *  type reuse the memory instead of allocating it again.
+ * @tparam Titem_ Type of the stored nodes.
+ */
+template <class Titem_>
+class CNodeArenaT {
+	static constexpr size_t BLOCK_ITEMS = 1024; ///< Number of nodes in one block.
+	static constexpr size_t MAX_SPARE_BLOCKS = 64; ///< Maximum number of blocks kept per thread between searches.
+
+	/** Uninitialised storage for one node. */
+	struct alignas(Titem_) Storage {
+		std::byte data[sizeof(Titem_)];
+	};
+	using Block = std::unique_ptr<Storage[]>;
+
+	std::vector<Block> m_blocks; ///< Blocks in use by this arena.
+	size_t m_count = 0; ///< Number of constructed nodes.
+
+	/** Blocks released by finished searches on this thread. */
+	static std::vector<Block> &SpareBlocks()
+	{
+		static thread_local std::vector<Block> spare;
+		return spare;
+	}
+
+public:
+	CNodeArenaT() = default;
+	CNodeArenaT(const CNodeArenaT &) = delete;
+	CNodeArenaT &operator=(const CNodeArenaT &) = delete;
+
+	~CNodeArenaT()
+	{
+		this->Clear();
+		std::vector<Block> &spare = SpareBlocks();
+		for (Block &block : this->m_blocks) {
+			if (spare.size() >= MAX_SPARE_BLOCKS) break;
+			spare.push_back(std::move(block));
+		}
+	}
+
+	/** Destroy all nodes, but keep the blocks for reuse. */
+	void Clear()
+	{
+		if constexpr (!std::is_trivially_destructible_v<Titem_>) {
+			for (size_t i = 0; i < this->m_count; i++) (*this)[i].~Titem_();
+		}
+		this->m_count = 0;
+	}
+
+	/** Construct a new node at the end of the arena. */
+	inline Titem_ *AppendC()
+	{
+		size_t block = this->m_count / BLOCK_ITEMS;
+		if (block == this->m_blocks.size()) {
+			std::vector<Block> &spare = SpareBlocks();
+			if (spare.empty()) {
+				this->m_blocks.emplace_back(new Storage[BLOCK_ITEMS]);
+			} else {
+				this->m_blocks.push_back(std::move(spare.back()));
+				spare.pop_back();
+			}
+		}
+		Titem_ *item = new (&this->m_blocks[block][this->m_count % BLOCK_ITEMS]) Titem_();
+		this->m_count++;
+		return item;
+	}
+
+	/** Number of constructed nodes. */
+	inline size_t Length() const
+	{
+		return this->m_count;
+	}
+
+	inline Titem_ &operator[](size_t idx)
+	{
+		return *reinterpret_cast<Titem_ *>(&this->m_blocks[idx / BLOCK_ITEMS][idx % BLOCK_ITEMS]);
+	}
+
+	inline const Titem_ &operator[](size_t idx) const
+	{
+		return *reinterpret_cast<const Titem_ *>(&this->m_blocks[idx / BLOCK_ITEMS][idx % BLOCK_ITEMS]);
+	}
+
+	/** Helper for creating output of this array. */
+	template <typename D> void Dump(D &dmp) const
+	{
+		dmp.WriteValue("num_blocks", static_cast<int>(this->m_blocks.size()));
+		dmp.WriteValue("num_items", static_cast<int>(this->m_count));
+		for (size_t i = 0; i < this->m_count; i++) {
+			dmp.WriteStructT(fmt::format("item[{}]", i), &(*this)[i]);
+		}
+	}
+};
 
 /**
  * Hash table based node list multi-container class.
@@ -24,7 +124,7 @@ class CNodeList_HashTableT {
 public:
 	typedef Titem_ Titem;                                        ///< Make #Titem_ visible from outside of class.
 	typedef typename Titem_::Key Key;                            ///< Make Titem_::Key a property of this class.
-	typedef SmallArray<Titem_, 65536, 256> CItemArray;           ///< Type that we will use as item container.
+	typedef CNodeArenaT<Titem_> CItemArray;                      ///< Type that we will use as item container.
 	typedef CHashTableT<Titem_, Thash_bits_open_  > COpenList;   ///< How pointers to open nodes will be stored.
 	typedef CHashTableT<Titem_, Thash_bits_closed_> CClosedList; ///< How pointers to closed nodes will be stored.
 	typedef CBinaryHeapT<Titem_> CPriorityQueue;                 ///< How the priority queue will be managed.
@@ -11,6 +11,7 @@
 #define YAPF_COSTCACHE_HPP
 
 #include "../../timer/timer_game_calendar.h"
+#include <unordered_map>
 
 /**
  * CYapfSegmentCostCacheNoneT - the formal only yapf cost cache provider that implements
@@ -80,6 +81,14 @@ public:
 		return false;
 	}
 
+	/**
+	 * Called by YAPF when the cost of a segment has been calculated.
+	 *  Local segments are not shared, so there is nothing to invalidate later.
+	 */
+	inline void PfNodeCacheRegisterTiles(Node &, const std::vector<TileIndex> &)
+	{
+	}
+
 	/**
 	 * Called by YAPF to flush the cached segment cost data back into cache storage.
 	 *  Current cache implementation doesn't use that.
@@ -99,12 +108,25 @@ public:
  */
 struct CSegmentCostCacheBase
 {
-	static int   s_rail_change_counter;
+	static int      s_rail_change_counter; ///< incremented when the whole cache has to be flushed
+	static uint64_t s_hits;                ///< number of segments served from the cache
+	static uint64_t s_misses;              ///< number of segments that had to be (re)calculated
+	static uint64_t s_invalidated;         ///< number of segments dropped by local invalidation
 
-	static void NotifyTrackLayoutChange(TileIndex, Track)
-	{
-		s_rail_change_counter++;
-	}
+	CSegmentCostCacheBase();
+	virtual ~CSegmentCostCacheBase();
+
+	/**
+	 * Drop all cached segments that pass the given tile.
+	 * @param tile The changed tile.
+	 * @return Number of segments invalidated.
+	 */
+	virtual uint InvalidateTile(TileIndex tile) = 0;
+
+	static void NotifyTrackLayoutChange(TileIndex tile, Track track);
+
+private:
+	static std::vector<CSegmentCostCacheBase *> s_caches; ///< all segment caches, one per rail YAPF type
 };
 
 
@@ -117,6 +139,12 @@ struct CSegmentCostCacheBase
  *  of the segment (origin tile and exit-dir from this tile).
  *  Different CYapfCachedCostT types can share the same type of CSegmentCostCacheT.
  *  Look at CYapfRailSegment (yapf_node_rail.hpp) for the segment example
+ *
+ *  Besides the hash-map the cache keeps a per-tile index of the segments passing
+ *  each tile, so that a track change only drops the segments around it instead of
+ *  the whole cache. Invalidated segments are reset in place and recalculated when
+ *  they are fetched the next time; index entries of segments that have been reset
+ *  since are recognised by their generation and skipped.
  */
 template <class Tsegment>
 struct CSegmentCostCacheT : public CSegmentCostCacheBase {
@@ -126,8 +154,15 @@ struct CSegmentCostCacheT : public CSegmentCostCacheBase {
 	typedef SmallArray<Tsegment> Heap;
 	typedef typename Tsegment::Key Key;    ///< key to hash table
 
+	/** Reference from the tile index to a segment. */
+	struct TileRef {
+		Tsegment *segment;   ///< the segment passing the tile
+		uint32_t generation; ///< generation of the segment when it was registered
+	};
+
 	HashTable    m_map;
 	Heap         m_heap;
+	std::unordered_map<uint32_t, std::vector<TileRef>> m_tile_index; ///< segments per tile they pass
 
 	inline CSegmentCostCacheT() {}
 
@@ -136,6 +171,7 @@ struct CSegmentCostCacheT : public CSegmentCostCacheBase {
 	{
 		m_map.Clear();
 		m_heap.Clear();
+		m_tile_index.clear();
 	}
 
 	inline Tsegment &Get(Key &key, bool *found)
@@ -146,10 +182,48 @@ struct CSegmentCostCacheT : public CSegmentCostCacheBase {
 			item = new (m_heap.Append()) Tsegment(key);
 			m_map.Push(*item);
 		} else {
-			*found = true;
+			*found = item->IsValid();
+		}
+		if (*found) {
+			s_hits++;
+		} else {
+			s_misses++;
 		}
 		return *item;
 	}
+
+	/**
+	 * Remember the tiles a freshly calculated segment passes.
+	 * @param segment The segment.
+	 * @param tiles The tiles of the segment.
+	 */
+	void RegisterTiles(Tsegment &segment, const std::vector<TileIndex> &tiles)
+	{
+		for (TileIndex tile : tiles) {
+			std::vector<TileRef> &refs = m_tile_index[tile.base()];
+			/* Drop references to segments that have been recalculated since. */
+			refs.erase(std::remove_if(refs.begin(), refs.end(), [](const TileRef &ref) {
+				return ref.generation != ref.segment->m_generation;
+			}), refs.end());
+			refs.push_back({ &segment, segment.m_generation });
+		}
+	}
+
+	uint InvalidateTile(TileIndex tile) override
+	{
+		auto it = m_tile_index.find(tile.base());
+		if (it == m_tile_index.end()) return 0;
+
+		uint count = 0;
+		for (const TileRef &ref : it->second) {
+			if (ref.generation != ref.segment->m_generation) continue;
+			ref.segment->Invalidate();
+			count++;
+		}
+		m_tile_index.erase(it);
+		s_invalidated += count;
+		return count;
+	}
 };
 
 /**
@@ -169,9 +243,18 @@ public:
 	typedef CSegmentCostCacheT<CachedData> Cache;
 
 protected:
-	Cache &m_global_cache;
+	/* The global cache is only looked up when it is actually used, so pathfinders
+	 * with a disabled cache never touch it and can run on other threads. */
+	Cache *m_global_cache;
 
-	inline CYapfSegmentCostCacheGlobalT() : m_global_cache(stGetGlobalCache()) {};
+	inline CYapfSegmentCostCacheGlobalT() : m_global_cache(nullptr) {};
+
+	/** Get the global cache, flushing it first if the track layout changed completely. */
+	inline Cache &GlobalCache()
+	{
+		if (m_global_cache == nullptr) m_global_cache = &stGetGlobalCache();
+		return *m_global_cache;
+	}
 
 	/** to access inherited path finder */
 	inline Tpf &Yapf()
@@ -204,11 +287,21 @@ public:
 		}
 		CacheKey key(n.GetKey());
 		bool found;
-		CachedData &item = m_global_cache.Get(key, &found);
+		CachedData &item = GlobalCache().Get(key, &found);
 		Yapf().ConnectNodeToCachedData(n, item);
 		return found;
 	}
 
+	/**
+	 * Called by YAPF when the cost of a segment has been calculated, so the
+	 *  cache knows which tiles the segment depends on.
+	 */
+	inline void PfNodeCacheRegisterTiles(Node &n, const std::vector<TileIndex> &tiles)
+	{
+		if (!Yapf().CanUseGlobalCache(n)) return;
+		GlobalCache().RegisterTiles(*n.m_segment, tiles);
+	}
+
 	/**
 	 * Called by YAPF to flush the cached segment cost data back into cache storage.
 	 *  Current cache implementation doesn't use that.
@@ -56,6 +56,7 @@ protected:
 	int m_max_cost;
 	bool m_disable_cache;
 	std::vector<int> m_sig_look_ahead_costs;
+	std::vector<TileIndex> m_segment_tiles; ///< tiles of the segment being calculated, see PfNodeCacheRegisterTiles
 
 public:
 	bool          m_stopped_on_first_two_way_signal;
@@ -323,6 +324,8 @@ public:
 
 		TrackFollower tf_local(v, Yapf().GetCompatibleRailTypes());
 
+		m_segment_tiles.clear();
+
 		if (!has_parent) {
 			/* We will jump to the middle of the cost calculator assuming that segment cache is not used. */
 			assert(!is_cached_segment);
@@ -369,6 +372,12 @@ public:
 
 no_entry_cost: // jump here at the beginning if the node has no parent (it is the first node)
 
+			/* Remember the tiles of the segment, including skipped ones, for cache invalidation. */
+			m_segment_tiles.push_back(cur.tile);
+			for (int i = 1; i <= tf->m_tiles_skipped; i++) {
+				m_segment_tiles.push_back(TILE_ADD(cur.tile, -i * TileOffsByDiagDir(tf->m_exitdir)));
+			}
+
 			/* All other tile costs will be calculated here. */
 			segment_cost += Yapf().OneTileCost(cur.tile, cur.td);
 
@@ -569,6 +578,7 @@ no_entry_cost: // jump here at the beginning if the node has no parent (it is th
 			segment.m_end_segment_reason = end_segment_reason & ESRB_CACHED_MASK;
 			/* Save end of segment back to the node. */
 			n.SetLastTileTrackdir(cur.tile, cur.td);
+			Yapf().PfNodeCacheRegisterTiles(n, m_segment_tiles);
 		}
 
 		/* Do we have an excuse why not to continue pathfinding in this direction? */
@@ -609,13 +619,18 @@ no_entry_cost: // jump here at the beginning if the node has no parent (it is th
 		return true;
 	}
 
-	inline bool CanUseGlobalCache(Node &n) const
+	/** Is the segment of the node beyond the signal look-ahead, i.e. independent of signal states? */
+	inline bool IsBeyondLookAhead(Node &n) const
 	{
-		return !m_disable_cache
-			&& (n.m_parent != nullptr)
+		return (n.m_parent != nullptr)
 			&& (n.m_parent->m_num_signals_passed >= m_sig_look_ahead_costs.size());
 	}
 
+	inline bool CanUseGlobalCache(Node &n) const
+	{
+		return !m_disable_cache && IsBeyondLookAhead(n);
+	}
+
 	inline void ConnectNodeToCachedData(Node &n, CachedData &ci)
 	{
 		n.m_segment = &ci;
@@ -119,6 +119,7 @@ protected:
 	TrackdirBits m_destTrackdirs;
 	StationID    m_dest_station_id;
 	bool         m_any_depot;
+	std::shared_ptr<const RailGraphDistances> m_graph_distances; ///< Junction graph distances to the destination, if enabled.
 
 	/** to access inherited path finder */
 	Tpf &Yapf()
@@ -160,6 +161,10 @@ public:
 				m_destTrackdirs = TrackStatusToTrackdirBits(GetTileTrackStatus(v->dest_tile, TRANSPORT_RAIL, 0));
 				break;
 		}
+		m_graph_distances = nullptr;
+		if (_settings_game.pf.yapf.rail_junction_graph && !m_any_depot) {
+			m_graph_distances = GetRailGraphDistances(v->owner, m_dest_station_id, m_destTile, m_destTrackdirs);
+		}
 		CYapfDestinationRailBase::SetDestination(v);
 	}
 
@@ -210,6 +215,19 @@ public:
 		int dxy = abs(dx - dy);
 		int d = dmin * YAPF_TILE_CORNER_LENGTH + (dxy - 1) * (YAPF_TILE_LENGTH / 2);
 		n.m_estimate = n.m_cost + d;
+		if (m_graph_distances != nullptr) {
+			/* The track distance from the junction graph is never shorter than the direct one. */
+			int32_t graph_d = m_graph_distances->GetDistance(tile, n.GetLastTrackdir());
+			if (graph_d == RailGraphDistances::UNREACHABLE) {
+				/* Keep the direct distance, so the best intermediate node still heads the right way. */
+				n.m_estimate += YAPF_RAIL_GRAPH_UNREACHABLE_COST;
+			} else if (graph_d != RailGraphDistances::UNKNOWN) {
+				n.m_estimate = n.m_cost + std::max<int>(d, std::min<int32_t>(graph_d, YAPF_RAIL_GRAPH_UNREACHABLE_COST - 1));
+			}
+			/* Nodes don't all get the same kind of estimate, e.g. the graph may not know a state.
+			 * Never estimate a node cheaper than its parent, so the estimate stays consistent along the path. */
+			n.m_estimate = std::max(n.m_estimate, n.m_parent->m_estimate);
+		}
 		assert(n.m_estimate >= n.m_parent->m_estimate);
 		return true;
 	}
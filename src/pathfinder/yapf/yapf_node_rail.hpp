@@ -70,6 +70,7 @@ struct CYapfRailSegment
 	Trackdir               m_last_signal_td;
 	EndSegmentReasonBits   m_end_segment_reason;
 	CYapfRailSegment      *m_hash_next;
+	uint32_t               m_generation; ///< incremented every time the segment is invalidated
 
 	inline CYapfRailSegment(const CYapfRailSegmentKey &key)
 		: m_key(key)
@@ -80,8 +81,27 @@ struct CYapfRailSegment
 		, m_last_signal_td(INVALID_TRACKDIR)
 		, m_end_segment_reason(ESRB_NONE)
 		, m_hash_next(nullptr)
+		, m_generation(0)
 	{}
 
+	/** Does the segment hold a calculated cost? */
+	inline bool IsValid() const
+	{
+		return m_cost >= 0;
+	}
+
+	/** Forget the calculated cost, e.g. because the track layout of the segment changed. */
+	inline void Invalidate()
+	{
+		m_last_tile = INVALID_TILE;
+		m_last_td = INVALID_TRACKDIR;
+		m_cost = -1;
+		m_last_signal_tile = INVALID_TILE;
+		m_last_signal_td = INVALID_TRACKDIR;
+		m_end_segment_reason = ESRB_NONE;
+		m_generation++;
+	}
+
 	inline const Key &GetKey() const
 	{
 		return m_key;
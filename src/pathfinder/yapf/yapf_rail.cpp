@@ -13,9 +13,11 @@
 #include "yapf_cache.h"
 #include "yapf_node_rail.hpp"
 #include "yapf_costrail.hpp"
+#include "yapf_rail_graph.h"
 #include "yapf_destrail.hpp"
 #include "../../viewport_func.h"
 #include "../../newgrf_station.h"
+#include "../../thread.h"
 
 #include "../../safeguards.h"
 
@@ -34,6 +36,33 @@ template <typename Tpf> void DumpState(Tpf &pf1, Tpf &pf2)
 	fclose(f2);
 }
 
+/**
+ * Result of a path search made ahead of the vehicle ticks for a train that is
+ * going to retry its path reservation, see YapfTrainPrefetchPaths().
+ * Besides the chosen track it holds the tiles of the path to reserve, so the
+ * reservation can be made later without the pathfinder's node tree.
+ */
+struct YapfPrefetchedPath {
+	VehicleID veh = INVALID_VEHICLE;              ///< The train the path was searched for.
+	PBSTileInfo origin;                           ///< End of the train's reservation the search started at.
+	Order order;                                  ///< Current order of the train at the time of the search.
+	TileIndex order_dest_tile = INVALID_TILE;     ///< Destination tile of the train at the time of the search.
+	bool used = false;                            ///< Whether the result has been consumed already.
+
+	bool has_path = false;                        ///< Whether the search returned a best node at all.
+	bool path_found = false;                      ///< Whether the path was found or only guessed.
+	bool stopped_on_first_two_way_signal = false; ///< Whether the search stopped on the first two-way signal.
+	Trackdir next_trackdir = INVALID_TRACKDIR;    ///< The best trackdir to take first.
+	TileIndex final_tile = INVALID_TILE;          ///< Last tile of the best path.
+
+	TileIndex res_origin = INVALID_TILE;          ///< Tile the reservation originates from.
+	TileIndex res_dest = INVALID_TILE;            ///< The reservation target tile.
+	Trackdir res_dest_td = INVALID_TRACKDIR;      ///< The reservation target trackdir.
+	std::vector<std::pair<TileIndex, Trackdir>> res_tiles; ///< Tiles of the nodes from the reservation target back to the origin.
+	std::vector<size_t> res_node_ends;            ///< End of each node's tiles in #res_tiles.
+	size_t res_cached_nodes = 0;                  ///< Number of nodes, starting at the target, whose segments are in the global cache.
+};
+
 template <class Types>
 class CYapfReserveTrack
 {
@@ -56,6 +85,8 @@ private:
 	TileIndex m_res_fail_tile;    ///< The tile where the reservation failed
 	Trackdir  m_res_fail_td;      ///< The trackdir where the reservation failed
 	TileIndex m_origin_tile;      ///< Tile our reservation will originate from
+	std::vector<TileIndex> m_reserved_tiles; ///< Reserved tiles of globally cached segments
+	YapfPrefetchedPath *m_record_path = nullptr; ///< Path to record the reservation tiles into
 
 	bool FindSafePositionProc(TileIndex tile, Trackdir td)
 	{
@@ -67,6 +98,20 @@ private:
 		return true;
 	}
 
+	/** Record a tile of the path for a later reservation. */
+	bool RecordSingleTrack(TileIndex tile, Trackdir td)
+	{
+		m_record_path->res_tiles.emplace_back(tile, td);
+		return true;
+	}
+
+	/** Remember a reserved tile for segment cache invalidation. */
+	bool CollectReservedTile(TileIndex tile, Trackdir)
+	{
+		m_reserved_tiles.push_back(tile);
+		return true;
+	}
+
 	/** Reserve a railway platform. Tile contains the failed tile on abort. */
 	bool ReserveRailStationPlatform(TileIndex &tile, DiagDirection dir)
 	{
@@ -178,7 +223,95 @@ public:
 		if (target != nullptr) target->okay = true;
 
 		if (Yapf().CanUseGlobalCache(*m_res_node)) {
-			YapfNotifyTrackLayoutChange(INVALID_TILE, INVALID_TRACK);
+			/* The reservation changed tiles of globally cached segments; drop just the segments around them. */
+			m_reserved_tiles.clear();
+			for (Node *node = m_res_node; node->m_parent != nullptr && Yapf().CanUseGlobalCache(*node); node = node->m_parent) {
+				node->IterateTiles(Yapf().GetVehicle(), Yapf(), *this, &CYapfReserveTrack<Types>::CollectReservedTile);
+			}
+			for (TileIndex tile : m_reserved_tiles) {
+				CSegmentCostCacheBase::NotifyTrackLayoutChange(tile, INVALID_TRACK);
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Store the path till the reservation target, so TryReservePrefetchedPath() can reserve it later.
+	 * @param path The path to store into.
+	 * @param origin Tile the reservation will originate from.
+	 */
+	void RecordReservation(YapfPrefetchedPath &path, TileIndex origin)
+	{
+		path.res_origin = origin;
+		path.res_dest = m_res_dest;
+		path.res_dest_td = m_res_dest_td;
+		m_record_path = &path;
+
+		bool cached = true;
+		for (Node *node = m_res_node; node->m_parent != nullptr; node = node->m_parent) {
+			node->IterateTiles(Yapf().GetVehicle(), Yapf(), *this, &CYapfReserveTrack<Types>::RecordSingleTrack);
+			path.res_node_ends.push_back(path.res_tiles.size());
+			cached &= Yapf().IsBeyondLookAhead(*node);
+			if (cached) path.res_cached_nodes++;
+		}
+		m_record_path = nullptr;
+	}
+
+	/**
+	 * Try to reserve a path stored by RecordReservation().
+	 * This does exactly what TryReservePath() does with the node tree.
+	 * @param v The train to reserve for.
+	 * @param path The stored path.
+	 * @param[out] target The reservation target.
+	 * @return True if the path could be reserved.
+	 */
+	bool TryReservePrefetchedPath(const Train *v, const YapfPrefetchedPath &path, PBSTileInfo *target)
+	{
+		m_res_fail_tile = INVALID_TILE;
+		m_origin_tile = path.res_origin;
+		m_res_dest = path.res_dest;
+		m_res_dest_td = path.res_dest_td;
+
+		if (target != nullptr) {
+			target->tile = m_res_dest;
+			target->trackdir = m_res_dest_td;
+			target->okay = false;
+		}
+
+		/* Don't bother if the target is reserved. */
+		if (!IsWaitingPositionFree(v, m_res_dest, m_res_dest_td)) return false;
+
+		size_t begin = 0;
+		for (size_t node = 0; node < path.res_node_ends.size(); node++) {
+			for (size_t i = begin; i < path.res_node_ends[node]; i++) {
+				if (!this->ReserveSingleTrack(path.res_tiles[i].first, path.res_tiles[i].second)) break;
+			}
+			if (m_res_fail_tile != INVALID_TILE) {
+				/* Reservation failed, undo. */
+				TileIndex stop_tile = m_res_fail_tile;
+				size_t fail_begin = 0;
+				for (size_t fail_node = 0; fail_node <= node; fail_node++) {
+					/* If this is the node that failed, stop at the failed tile. */
+					m_res_fail_tile = fail_node == node ? stop_tile : INVALID_TILE;
+					for (size_t i = fail_begin; i < path.res_node_ends[fail_node]; i++) {
+						if (!this->UnreserveSingleTrack(path.res_tiles[i].first, path.res_tiles[i].second)) break;
+					}
+					fail_begin = path.res_node_ends[fail_node];
+				}
+
+				return false;
+			}
+			begin = path.res_node_ends[node];
+		}
+
+		if (target != nullptr) target->okay = true;
+
+		if (path.res_cached_nodes > 0) {
+			/* Same as in TryReservePath(): drop the globally cached segments around the reserved tiles. */
+			for (size_t i = 0; i < path.res_node_ends[path.res_cached_nodes - 1]; i++) {
+				CSegmentCostCacheBase::NotifyTrackLayoutChange(path.res_tiles[i].first, INVALID_TRACK);
+			}
 		}
 
 		return true;
@@ -417,6 +550,68 @@ public:
 		return result1;
 	}
 
+	static void stPrefetchRailTrack(const Train *v, YapfPrefetchedPath *path)
+	{
+		/* This runs on worker threads, so stay away from the shared segment cache. */
+		Tpf pf;
+		pf.DisableCache(true);
+		pf.PrefetchRailTrack(v, *path);
+	}
+
+	static Trackdir stApplyPrefetchedRailTrack(const Train *v, const YapfPrefetchedPath &path, bool &path_found, bool reserve_track, PBSTileInfo *target, TileIndex *dest)
+	{
+		Tpf pf;
+		return pf.ApplyPrefetchedRailTrack(v, path, path_found, reserve_track, target, dest);
+	}
+
+	/**
+	 * Search the path of a train from a given origin without reserving anything.
+	 * The search is the one ChooseRailTrack() does, the result is stored in \a path.
+	 */
+	inline void PrefetchRailTrack(const Train *v, YapfPrefetchedPath &path)
+	{
+		Yapf().SetOrigin(path.origin.tile, path.origin.trackdir, INVALID_TILE, INVALID_TRACKDIR, 1, true);
+		Yapf().SetDestination(v);
+
+		path.path_found = Yapf().FindPath(v);
+		path.stopped_on_first_two_way_signal = Yapf().m_stopped_on_first_two_way_signal;
+
+		Node *pNode = Yapf().GetBestNode();
+		if (pNode == nullptr) return;
+
+		this->SetReservationTarget(pNode, pNode->GetLastTile(), pNode->GetLastTrackdir());
+
+		Node *pPrev = nullptr;
+		while (pNode->m_parent != nullptr) {
+			pPrev = pNode;
+			pNode = pNode->m_parent;
+
+			this->FindSafePositionOnNode(pPrev);
+		}
+
+		path.has_path = true;
+		path.next_trackdir = pPrev->GetTrackdir();
+		path.final_tile = Yapf().GetBestNode()->GetLastTile();
+		this->RecordReservation(path, pNode->GetLastTile());
+	}
+
+	/** Finish what ChooseRailTrack() does after the search using a prefetched path. */
+	inline Trackdir ApplyPrefetchedRailTrack(const Train *v, const YapfPrefetchedPath &path, bool &path_found, bool reserve_track, PBSTileInfo *target, TileIndex *dest)
+	{
+		if (target != nullptr) target->tile = INVALID_TILE;
+		if (dest != nullptr) *dest = INVALID_TILE;
+
+		path_found = path.path_found;
+		if (path.has_path && reserve_track && path_found) {
+			if (dest != nullptr) *dest = path.final_tile;
+			this->TryReservePrefetchedPath(v, path, target);
+		}
+
+		/* Treat the path as found if stopped on the first two way signal(s). */
+		path_found |= path.stopped_on_first_two_way_signal;
+		return path.next_trackdir;
+	}
+
 	inline Trackdir ChooseRailTrack(const Train *v, TileIndex, DiagDirection, TrackBits, bool &path_found, bool reserve_track, PBSTileInfo *target, TileIndex *dest)
 	{
 		if (target != nullptr) target->tile = INVALID_TILE;
@@ -532,8 +727,82 @@ struct CYapfAnySafeTileRail1 : CYapfT<CYapfRail_TypesT<CYapfAnySafeTileRail1, CF
 struct CYapfAnySafeTileRail2 : CYapfT<CYapfRail_TypesT<CYapfAnySafeTileRail2, CFollowTrackFreeRailNo90, CRailNodeListTrackDir, CYapfDestinationAnySafeTileRailT , CYapfFollowAnySafeTileRailT> > {};
 
 
+/** Paths searched ahead of the current vehicle ticks, sorted by vehicle index. */
+static std::vector<YapfPrefetchedPath> _prefetched_paths;
+
+/**
+ * Search the paths of a batch of trains in parallel.
+ * All searches see the map as it is at the time of this call, and nothing is
+ * reserved. When one of the trains then asks for its path during its tick, the
+ * stored result is used instead of a new search and the reservation is made
+ * at that time. As trains tick in order of their index, reservations are made
+ * serially in vehicle index order, so the outcome is the same on all clients.
+ * @param requests The trains with the origin their search starts at, sorted by vehicle index.
+ */
+void YapfTrainPrefetchPaths(const std::vector<std::pair<const Train *, PBSTileInfo>> &requests)
+{
+	/* Don't bother with threads for a handful of searches. */
+	static const size_t MIN_SEARCHES_PER_THREAD = 4;
+
+	_prefetched_paths.clear();
+	_prefetched_paths.resize(requests.size());
+	for (size_t i = 0; i < requests.size(); i++) {
+		YapfPrefetchedPath &path = _prefetched_paths[i];
+		const Train *v = requests[i].first;
+		path.veh = v->index;
+		path.origin = requests[i].second;
+		path.order = v->current_order;
+		path.order_dest_tile = v->dest_tile;
+	}
+
+	typedef void (*PfnPrefetchRailTrack)(const Train*, YapfPrefetchedPath*);
+	PfnPrefetchRailTrack pfnPrefetchRailTrack = _settings_game.pf.forbid_90_deg ? &CYapfRail2::stPrefetchRailTrack : &CYapfRail1::stPrefetchRailTrack;
+
+	RailGraphBeginSearchBatch();
+	ParallelFor(requests.size(), MIN_SEARCHES_PER_THREAD, [&](size_t i) {
+		pfnPrefetchRailTrack(requests[i].first, &_prefetched_paths[i]);
+	});
+	RailGraphEndSearchBatch();
+}
+
+/** Forget the paths of the last batch; they are only valid during the vehicle ticks they were searched for. */
+void YapfTrainClearPrefetchedPaths()
+{
+	_prefetched_paths.clear();
+}
+
+/**
+ * Get the prefetched path of a train, if it is still usable.
+ * A path is usable once, and only if the train still starts at the same origin with the same order.
+ * @param v The train.
+ * @return The path, or nullptr if no usable path has been prefetched.
+ */
+static const YapfPrefetchedPath *GetPrefetchedPath(const Train *v)
+{
+	auto it = std::lower_bound(_prefetched_paths.begin(), _prefetched_paths.end(), v->index, [](const YapfPrefetchedPath &path, VehicleID index) {
+		return path.veh < index;
+	});
+	if (it == _prefetched_paths.end() || it->veh != v->index || it->used) return nullptr;
+	it->used = true;
+
+	PBSTileInfo origin = FollowTrainReservation(v);
+	if (origin.tile != it->origin.tile || origin.trackdir != it->origin.trackdir) return nullptr;
+	if (!v->current_order.Equals(it->order) || v->current_order.GetDestination() != it->order.GetDestination() || v->dest_tile != it->order_dest_tile) return nullptr;
+	return &*it;
+}
+
 Track YapfTrainChooseTrack(const Train *v, TileIndex tile, DiagDirection enterdir, TrackBits tracks, bool &path_found, bool reserve_track, PBSTileInfo *target, TileIndex *dest)
 {
+	if (reserve_track && !_prefetched_paths.empty()) {
+		const YapfPrefetchedPath *path = GetPrefetchedPath(v);
+		if (path != nullptr) {
+			typedef Trackdir (*PfnApplyPrefetchedRailTrack)(const Train*, const YapfPrefetchedPath&, bool&, bool, PBSTileInfo*, TileIndex*);
+			PfnApplyPrefetchedRailTrack pfnApply = _settings_game.pf.forbid_90_deg ? &CYapfRail2::stApplyPrefetchedRailTrack : &CYapfRail1::stApplyPrefetchedRailTrack;
+			Trackdir td_ret = pfnApply(v, *path, path_found, reserve_track, target, dest);
+			return (td_ret != INVALID_TRACKDIR) ? TrackdirToTrack(td_ret) : FindFirstTrack(tracks);
+		}
+	}
+
 	/* default is YAPF type 2 */
 	typedef Trackdir (*PfnChooseRailTrack)(const Train*, TileIndex, DiagDirection, TrackBits, bool&, bool, PBSTileInfo*, TileIndex*);
 	PfnChooseRailTrack pfnChooseRailTrack = &CYapfRail1::stChooseRailTrack;
@@ -638,10 +907,53 @@ bool YapfTrainFindNearestSafeTile(const Train *v, TileIndex tile, Trackdir td, b
 	return pfnFindNearestSafeTile(v, tile, td, override_railtype);
 }
 
-/** if any track changes, this counter is incremented - that will invalidate segment cost cache */
+/** if the whole track layout has to be considered changed, this counter is incremented - that will flush segment cost cache */
 int CSegmentCostCacheBase::s_rail_change_counter = 0;
+uint64_t CSegmentCostCacheBase::s_hits = 0;
+uint64_t CSegmentCostCacheBase::s_misses = 0;
+uint64_t CSegmentCostCacheBase::s_invalidated = 0;
+std::vector<CSegmentCostCacheBase *> CSegmentCostCacheBase::s_caches;
+
+CSegmentCostCacheBase::CSegmentCostCacheBase()
+{
+	s_caches.push_back(this);
+}
+
+CSegmentCostCacheBase::~CSegmentCostCacheBase()
+{
+	s_caches.erase(std::find(s_caches.begin(), s_caches.end(), this));
+}
+
+/**
+ * Invalidate the cached segments affected by a track change.
+ * A change of a tile can alter the segments passing the tile itself, but also the
+ * segments ending next to it (a new junction, signal or dead end), so the segments
+ * passing the neighbouring tiles are dropped too.
+ * @param tile The changed tile, or INVALID_TILE to flush the complete cache.
+ */
+void CSegmentCostCacheBase::NotifyTrackLayoutChange(TileIndex tile, Track)
+{
+	if (tile == INVALID_TILE) {
+		s_rail_change_counter++;
+		return;
+	}
+
+	uint count = 0;
+	for (CSegmentCostCacheBase *cache : s_caches) {
+		count += cache->InvalidateTile(tile);
+		for (DiagDirection dir = DIAGDIR_BEGIN; dir < DIAGDIR_END; dir++) {
+			TileIndex neighbour = AddTileIndexDiffCWrap(tile, TileIndexDiffCByDiagDir(dir));
+			if (neighbour != INVALID_TILE) count += cache->InvalidateTile(neighbour);
+		}
+	}
+
+	uint64_t lookups = s_hits + s_misses;
+	Debug(yapf, 3, "Segment cache: {} segments invalidated around 0x{:X}, hit rate {:.1f}% ({} hits, {} misses, {} invalidated)",
+		count, tile.base(), lookups == 0 ? 0.0 : 100.0 * s_hits / lookups, s_hits, s_misses, s_invalidated);
+}
 
 void YapfNotifyTrackLayoutChange(TileIndex tile, Track track)
 {
 	CSegmentCostCacheBase::NotifyTrackLayoutChange(tile, track);
+	RailGraphNotifyTrackLayoutChange(tile);
 }
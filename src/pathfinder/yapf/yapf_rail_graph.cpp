@@ -0,0 +1,583 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_rail_graph.cpp Junction graph of the rail network, used to guide long distance rail path searches. */
+
+#include "../../stdafx.h"
+#include "../../debug.h"
+#include "../../base_station_base.h"
+#include "../../rail.h"
+#include "../../tunnelbridge_map.h"
+#include "../follow_track.hpp"
+#include "../pathfinder_type.h"
+#include "yapf_rail_graph.h"
+
+#include <array>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+
+#include "../../safeguards.h"
+
+/** Guards the graphs; path searches can run on several threads at once. */
+static std::mutex _rail_graph_mutex;
+/** Whether a batch of parallel searches is running; the graphs must not change meanwhile. */
+static bool _rail_graph_search_batch = false;
+
+/**
+ * Junction graph of the rail network of one company.
+ *  Nodes are the states (tile and trackdir) of a train just before it makes a
+ *  choice: junctions, dead ends, stations, waypoints and depots. Edges are the
+ *  plain tracks between them, weighted by their length in YAPF cost units.
+ *  The states on those plain tracks are indexed as well, so any state can be
+ *  mapped to the junction it leads to.
+ *
+ *  The graph is built once per company and then kept up to date by re-walking
+ *  only the edges around changed tiles. After every change it is equal to a
+ *  graph built from scratch, which keeps the distances derived from it the
+ *  same on all clients.
+ */
+class RailJunctionGraph {
+	friend void RailGraphBeginSearchBatch();
+
+	/** Plain track leading from one node to the next. */
+	struct Edge {
+		uint32_t to;  ///< Node the track leads to.
+		int32_t cost; ///< Length of the track, including the tile of the target node.
+	};
+
+	/** Reference from a plain track state to the node its track leads to. */
+	struct ChainRef {
+		uint32_t end;  ///< Node the track leads to.
+		int32_t cost;  ///< Remaining length of the track.
+		uint32_t refs; ///< Number of edges passing this state; tracks merge, so there can be more than one.
+	};
+
+	/** Junction node. */
+	struct Node {
+		uint32_t state = 0;           ///< Packed tile and trackdir.
+		bool alive = false;           ///< Whether the slot is in use.
+		std::vector<Edge> edges;      ///< Outgoing edges.
+		std::vector<uint32_t> chain;  ///< Plain track states passed by the outgoing edges.
+		std::vector<TileIndex> tiles; ///< Tiles passed by the outgoing edges, including the target nodes.
+	};
+
+	static constexpr size_t MAX_DISTANCE_TABLES = 64;  ///< Number of destinations to keep distances for.
+	static constexpr size_t MAX_PENDING_CHANGES = 4096; ///< Number of queued changes after which rebuilding is cheaper.
+
+	Owner owner;          ///< Company owning the rail network.
+	RailTypes railtypes;  ///< All rail types in use; compatibility is ignored.
+	uint32_t version = 0; ///< Incremented whenever the graph changes.
+	bool rebuild = true;  ///< Whether the graph must be built from scratch.
+
+	std::vector<Node> nodes;                                  ///< All nodes, indexed by node ID.
+	std::vector<uint32_t> free_nodes;                         ///< Unused node IDs.
+	std::unordered_map<uint32_t, uint32_t> node_index;        ///< Node ID by packed state.
+	std::unordered_map<uint32_t, ChainRef> chain_index;       ///< Plain track states by packed state.
+	std::unordered_map<uint32_t, std::vector<uint32_t>> tile_sources; ///< Nodes whose outgoing edges pass a tile.
+	std::vector<TileIndex> pending;                           ///< Changed tiles not yet processed.
+
+	std::vector<uint32_t> reverse_first; ///< Index of the first incoming edge per node.
+	std::vector<Edge> reverse_edges;     ///< Incoming edges, with Edge::to being the source node.
+	uint32_t reverse_version = UINT32_MAX; ///< Graph version #reverse_edges was built for.
+	std::unordered_map<uint64_t, std::shared_ptr<const RailGraphDistances>> tables; ///< Cached distances per destination.
+
+	static inline uint32_t PackState(TileIndex tile, Trackdir td)
+	{
+		return (tile.base() << 4) | td;
+	}
+
+	static inline TileIndex StateTile(uint32_t state)
+	{
+		return TileIndex{state >> 4};
+	}
+
+	static inline Trackdir StateTrackdir(uint32_t state)
+	{
+		return (Trackdir)(state & 0xF);
+	}
+
+	/** Minimum YAPF cost of entering a tile, see CYapfCostRailT::OneTileCost(). */
+	static inline int32_t StepCost(Trackdir td, int tiles_skipped)
+	{
+		return (IsDiagonalTrackdir(td) ? YAPF_TILE_LENGTH : YAPF_TILE_CORNER_LENGTH) + tiles_skipped * YAPF_TILE_LENGTH;
+	}
+
+	static inline int32_t AddCost(int32_t a, int32_t b)
+	{
+		return static_cast<int32_t>(std::min<int64_t>(static_cast<int64_t>(a) + b, RailGraphDistances::UNREACHABLE - 1));
+	}
+
+	/**
+	 * Check whether a state is a plain track state, i.e. not a node.
+	 * @param ft Follower; holds the only successor when the state is plain track.
+	 * @return True iff the state has exactly one successor and is no possible destination.
+	 */
+	static bool FollowPlainTrack(CFollowTrackRail &ft, TileIndex tile, Trackdir td)
+	{
+		if (HasStationTileRail(tile) || IsRailDepotTile(tile)) return false;
+		if (!ft.Follow(tile, td)) return false;
+		return KillFirstBit(ft.m_new_td_bits) == TRACKDIR_BIT_NONE;
+	}
+
+	uint32_t AddNode(uint32_t state)
+	{
+		uint32_t id;
+		if (this->free_nodes.empty()) {
+			id = static_cast<uint32_t>(this->nodes.size());
+			this->nodes.emplace_back();
+		} else {
+			id = this->free_nodes.back();
+			this->free_nodes.pop_back();
+		}
+		Node &node = this->nodes[id];
+		node.state = state;
+		node.alive = true;
+		this->node_index[state] = id;
+		return id;
+	}
+
+	/** Forget the outgoing edges of a node. */
+	void ClearEdges(uint32_t id)
+	{
+		Node &node = this->nodes[id];
+		for (uint32_t state : node.chain) {
+			auto it = this->chain_index.find(state);
+			if (--it->second.refs == 0) this->chain_index.erase(it);
+		}
+		for (TileIndex tile : node.tiles) {
+			auto it = this->tile_sources.find(tile.base());
+			std::vector<uint32_t> &sources = it->second;
+			sources.erase(std::find(sources.begin(), sources.end(), id));
+			if (sources.empty()) this->tile_sources.erase(it);
+		}
+		node.edges.clear();
+		node.chain.clear();
+		node.tiles.clear();
+	}
+
+	void RemoveNode(uint32_t id)
+	{
+		this->ClearEdges(id);
+		Node &node = this->nodes[id];
+		this->node_index.erase(node.state);
+		node.alive = false;
+		this->free_nodes.push_back(id);
+	}
+
+	/**
+	 * Add the nodes on a tile that are not known yet.
+	 * @param added Receives the IDs of the new nodes.
+	 */
+	void ScanTile(TileIndex tile, std::vector<uint32_t> &added)
+	{
+		if (!IsTileType(tile, MP_RAILWAY) && !IsTileType(tile, MP_STATION) && !IsTileType(tile, MP_ROAD) && !IsTileType(tile, MP_TUNNELBRIDGE)) return;
+
+		TrackdirBits trackdirs = TrackStatusToTrackdirBits(GetTileTrackStatus(tile, TRANSPORT_RAIL, 0));
+		if (trackdirs == TRACKDIR_BIT_NONE || GetTileOwner(tile) != this->owner) return;
+
+		CFollowTrackRail ft(this->owner, this->railtypes);
+		while (trackdirs != TRACKDIR_BIT_NONE) {
+			Trackdir td = RemoveFirstTrackdir(&trackdirs);
+			if (FollowPlainTrack(ft, tile, td)) continue;
+			uint32_t state = PackState(tile, td);
+			if (this->node_index.count(state) == 0) added.push_back(this->AddNode(state));
+		}
+	}
+
+	/**
+	 * (Re)build the outgoing edges of a node by walking the tracks leaving it.
+	 * @param queue Receives nodes found on the way that were not known yet.
+	 */
+	void Expand(uint32_t id, std::vector<uint32_t> &queue)
+	{
+		this->ClearEdges(id);
+
+		CFollowTrackRail ft(this->owner, this->railtypes);
+		uint32_t node_state = this->nodes[id].state;
+		if (!ft.Follow(StateTile(node_state), StateTrackdir(node_state))) return;
+
+		TileIndex first_tile = ft.m_new_tile;
+		TrackdirBits first_trackdirs = ft.m_new_td_bits;
+		int first_skipped = ft.m_tiles_skipped;
+
+		std::vector<Edge> edges;
+		std::vector<TileIndex> tiles;
+		std::vector<std::pair<uint32_t, int32_t>> walked;
+		std::vector<uint32_t> chain;
+
+		while (first_trackdirs != TRACKDIR_BIT_NONE) {
+			TileIndex tile = first_tile;
+			Trackdir td = RemoveFirstTrackdir(&first_trackdirs);
+			int32_t cost = StepCost(td, first_skipped);
+
+			/* Brent's cycle detection, for loops without any junction. */
+			uint32_t tortoise = PackState(tile, td);
+			uint32_t power = 1;
+			uint32_t steps = 0;
+			bool loop = false;
+
+			walked.clear();
+			for (;;) {
+				tiles.push_back(tile);
+				if (!FollowPlainTrack(ft, tile, td)) break;
+				walked.emplace_back(PackState(tile, td), cost);
+
+				tile = ft.m_new_tile;
+				td = FindFirstTrackdir(ft.m_new_td_bits);
+				cost = AddCost(cost, StepCost(td, ft.m_tiles_skipped));
+
+				uint32_t state = PackState(tile, td);
+				if (state == tortoise) {
+					loop = true;
+					break;
+				}
+				if (++steps == power) {
+					tortoise = state;
+					power *= 2;
+					steps = 0;
+				}
+			}
+			if (loop) continue;
+
+			uint32_t end_state = PackState(tile, td);
+			auto end = this->node_index.find(end_state);
+			uint32_t end_id;
+			if (end == this->node_index.end()) {
+				end_id = this->AddNode(end_state);
+				queue.push_back(end_id);
+			} else {
+				end_id = end->second;
+			}
+
+			edges.push_back({end_id, cost});
+			for (const auto &[state, state_cost] : walked) {
+				auto it = this->chain_index.try_emplace(state, ChainRef{end_id, cost - state_cost, 0}).first;
+				it->second.refs++;
+				chain.push_back(state);
+			}
+		}
+
+		std::sort(tiles.begin(), tiles.end());
+		tiles.erase(std::unique(tiles.begin(), tiles.end()), tiles.end());
+		for (TileIndex tile : tiles) this->tile_sources[tile.base()].push_back(id);
+
+		Node &node = this->nodes[id];
+		node.edges = std::move(edges);
+		node.tiles = std::move(tiles);
+		node.chain = std::move(chain);
+	}
+
+	void ExpandAll(std::vector<uint32_t> &queue)
+	{
+		while (!queue.empty()) {
+			uint32_t id = queue.back();
+			queue.pop_back();
+			if (this->nodes[id].alive) this->Expand(id, queue);
+		}
+	}
+
+	void Build()
+	{
+		this->nodes.clear();
+		this->free_nodes.clear();
+		this->node_index.clear();
+		this->chain_index.clear();
+		this->tile_sources.clear();
+		this->pending.clear();
+
+		std::vector<uint32_t> queue;
+		for (TileIndex tile = 0; tile < Map::Size(); tile++) this->ScanTile(tile, queue);
+		this->ExpandAll(queue);
+
+		this->rebuild = false;
+		this->version++;
+		Debug(yapf, 3, "Rail junction graph of company {} built: {} junctions, {} plain track states", this->owner, this->node_index.size(), this->chain_index.size());
+	}
+
+	/** Bring the graph up to date with the queued changes. */
+	void Update()
+	{
+		if (this->rebuild) {
+			/* Other searches of the batch may only be reading a graph that has been built before. */
+			assert(!_rail_graph_search_batch || this->version == 0);
+			this->Build();
+			this->tables.clear();
+			return;
+		}
+		if (this->pending.empty()) return;
+		assert(!_rail_graph_search_batch);
+
+		/* A change can turn the states of the neighbouring tiles into junctions or dead ends. */
+		std::vector<TileIndex> area;
+		for (TileIndex tile : this->pending) {
+			area.push_back(tile);
+			for (DiagDirection dir = DIAGDIR_BEGIN; dir < DIAGDIR_END; dir++) {
+				TileIndex neighbour = AddTileIndexDiffCWrap(tile, TileIndexDiffCByDiagDir(dir));
+				if (neighbour != INVALID_TILE) area.push_back(neighbour);
+			}
+		}
+		this->pending.clear();
+		std::sort(area.begin(), area.end());
+		area.erase(std::unique(area.begin(), area.end()), area.end());
+
+		/* Nodes whose edges pass the area must walk them again. */
+		std::vector<uint32_t> queue;
+		for (TileIndex tile : area) {
+			auto it = this->tile_sources.find(tile.base());
+			if (it != this->tile_sources.end()) queue.insert(queue.end(), it->second.begin(), it->second.end());
+		}
+
+		for (TileIndex tile : area) {
+			for (Trackdir td = TRACKDIR_BEGIN; td < TRACKDIR_END; td++) {
+				if (!IsValidTrackdir(td)) continue;
+				auto it = this->node_index.find(PackState(tile, td));
+				if (it != this->node_index.end()) this->RemoveNode(it->second);
+			}
+		}
+		for (TileIndex tile : area) this->ScanTile(tile, queue);
+
+		std::sort(queue.begin(), queue.end());
+		queue.erase(std::unique(queue.begin(), queue.end()), queue.end());
+		this->ExpandAll(queue);
+
+		this->version++;
+		this->tables.clear();
+		Debug(yapf, 4, "Rail junction graph of company {} updated around {} tiles: {} junctions", this->owner, area.size(), this->node_index.size());
+	}
+
+	void BuildReverseEdges()
+	{
+		if (this->reverse_version == this->version) return;
+
+		this->reverse_first.assign(this->nodes.size() + 1, 0);
+		for (const Node &node : this->nodes) {
+			for (const Edge &edge : node.edges) this->reverse_first[edge.to + 1]++;
+		}
+		for (size_t i = 1; i < this->reverse_first.size(); i++) this->reverse_first[i] += this->reverse_first[i - 1];
+
+		this->reverse_edges.resize(this->reverse_first.back());
+		std::vector<uint32_t> fill(this->reverse_first.begin(), this->reverse_first.end() - 1);
+		for (uint32_t id = 0; id < this->nodes.size(); id++) {
+			for (const Edge &edge : this->nodes[id].edges) this->reverse_edges[fill[edge.to]++] = {id, edge.cost};
+		}
+		this->reverse_version = this->version;
+	}
+
+public:
+	RailJunctionGraph(Owner owner) : owner(owner), railtypes(RAILTYPES_NONE)
+	{
+		for (RailType rt = RAILTYPE_BEGIN; rt != RAILTYPE_END; rt++) {
+			if (GetRailTypeInfo(rt)->label != 0) SetBit(this->railtypes, rt);
+		}
+	}
+
+	void QueueChange(TileIndex tile)
+	{
+		if (this->rebuild) return;
+		if (this->pending.size() >= MAX_PENDING_CHANGES) {
+			this->rebuild = true;
+			this->pending.clear();
+			return;
+		}
+		this->pending.push_back(tile);
+	}
+
+	/**
+	 * Get the distances of all states to a destination.
+	 * @param key Unique key of the destination.
+	 * @param get_seeds Function filling the states that are the destination.
+	 * @return The distances, or nullptr if the destination is not part of the graph.
+	 */
+	template <typename F>
+	std::shared_ptr<const RailGraphDistances> GetDistances(uint64_t key, F get_seeds)
+	{
+		this->Update();
+
+		auto cached = this->tables.find(key);
+		if (cached != this->tables.end()) return cached->second;
+
+		std::vector<uint32_t> seeds;
+		get_seeds(seeds);
+
+		this->BuildReverseEdges();
+		auto table = std::make_shared<RailGraphDistances>();
+		table->graph = this;
+		table->dist.assign(this->nodes.size(), RailGraphDistances::UNREACHABLE);
+
+		using QueueItem = std::pair<int32_t, uint32_t>;
+		std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+		for (uint32_t state : seeds) {
+			auto it = this->node_index.find(state);
+			if (it == this->node_index.end()) continue;
+			table->dist[it->second] = 0;
+			queue.emplace(0, it->second);
+		}
+
+		std::shared_ptr<const RailGraphDistances> result;
+		if (!queue.empty()) {
+			/* Dijkstra over the reversed edges, starting at the destination. */
+			while (!queue.empty()) {
+				auto [dist, id] = queue.top();
+				queue.pop();
+				if (dist > table->dist[id]) continue;
+				for (uint32_t i = this->reverse_first[id]; i < this->reverse_first[id + 1]; i++) {
+					const Edge &edge = this->reverse_edges[i];
+					int32_t new_dist = AddCost(dist, edge.cost);
+					if (new_dist < table->dist[edge.to]) {
+						table->dist[edge.to] = new_dist;
+						queue.emplace(new_dist, edge.to);
+					}
+				}
+			}
+			result = std::move(table);
+		}
+
+		if (this->tables.size() >= MAX_DISTANCE_TABLES) this->tables.clear();
+		this->tables.emplace(key, result);
+		return result;
+	}
+
+	/**
+	 * Look up the distance of a state.
+	 * @param table Distances of this graph.
+	 * @return The distance, RailGraphDistances::UNREACHABLE or RailGraphDistances::UNKNOWN.
+	 */
+	int32_t Lookup(const RailGraphDistances &table, TileIndex tile, Trackdir td) const
+	{
+		int32_t cost = 0;
+		uint32_t state = PackState(tile, td);
+
+		auto chain = this->chain_index.find(state);
+		if (chain != this->chain_index.end()) {
+			cost = chain->second.cost;
+			state = this->nodes[chain->second.end].state;
+		} else if (this->node_index.count(state) == 0) {
+			/* Plain track no junction leads to, e.g. the end of a branch. Follow it to the next junction. */
+			CFollowTrackRail ft(this->owner, this->railtypes);
+			uint32_t tortoise = state;
+			uint32_t power = 1;
+			uint32_t steps = 0;
+			while (FollowPlainTrack(ft, tile, td)) {
+				tile = ft.m_new_tile;
+				td = FindFirstTrackdir(ft.m_new_td_bits);
+				cost = AddCost(cost, StepCost(td, ft.m_tiles_skipped));
+				state = PackState(tile, td);
+				if (state == tortoise) return RailGraphDistances::UNREACHABLE;
+				if (++steps == power) {
+					tortoise = state;
+					power *= 2;
+					steps = 0;
+				}
+			}
+		}
+
+		auto node = this->node_index.find(state);
+		if (node == this->node_index.end() || node->second >= table.dist.size()) return RailGraphDistances::UNKNOWN;
+		int32_t dist = table.dist[node->second];
+		return dist == RailGraphDistances::UNREACHABLE ? dist : AddCost(dist, cost);
+	}
+};
+
+/** Junction graph per company, created on first use. */
+static std::array<std::unique_ptr<RailJunctionGraph>, MAX_COMPANIES> _rail_graphs;
+
+/**
+ * Get the static distance from a state to the destination.
+ * @param tile Tile of the state.
+ * @param td Trackdir of the train about to leave \a tile.
+ * @return The distance in YAPF cost units, #UNREACHABLE or #UNKNOWN.
+ */
+int32_t RailGraphDistances::GetDistance(TileIndex tile, Trackdir td) const
+{
+	return this->graph->Lookup(*this, tile, td);
+}
+
+/**
+ * Get the distances of the rail network of a company to a destination.
+ * @param owner Owner of the rail network.
+ * @param station Destination station or waypoint, or INVALID_STATION.
+ * @param tile Destination tile, if \a station is INVALID_STATION.
+ * @param trackdirs Trackdirs on \a tile that are the destination.
+ * @return The distances, or nullptr if they are not available.
+ */
+std::shared_ptr<const RailGraphDistances> GetRailGraphDistances(Owner owner, StationID station, TileIndex tile, TrackdirBits trackdirs)
+{
+	if (owner >= MAX_COMPANIES) return nullptr;
+
+	uint64_t key;
+	if (station != INVALID_STATION) {
+		if (!BaseStation::IsValidID(station)) return nullptr;
+		key = (1ULL << 63) | station;
+	} else {
+		if (tile >= Map::Size() || trackdirs == TRACKDIR_BIT_NONE) return nullptr;
+		key = (static_cast<uint64_t>(trackdirs) << 32) | tile.base();
+	}
+
+	std::lock_guard<std::mutex> lock(_rail_graph_mutex);
+	std::unique_ptr<RailJunctionGraph> &graph = _rail_graphs[owner];
+	if (graph == nullptr) graph = std::make_unique<RailJunctionGraph>(owner);
+
+	return graph->GetDistances(key, [&](std::vector<uint32_t> &seeds) {
+		if (station != INVALID_STATION) {
+			const BaseStation *st = BaseStation::Get(station);
+			for (TileIndex t : st->train_station) {
+				if (!st->TileBelongsToRailStation(t)) continue;
+				Trackdir td = TrackToTrackdir(GetRailStationTrack(t));
+				seeds.push_back((t.base() << 4) | td);
+				seeds.push_back((t.base() << 4) | ReverseTrackdir(td));
+			}
+		} else {
+			for (TrackdirBits bits = trackdirs; bits != TRACKDIR_BIT_NONE;) {
+				seeds.push_back((tile.base() << 4) | RemoveFirstTrackdir(&bits));
+			}
+		}
+	});
+}
+
+/**
+ * Queue a track layout change for the junction graphs.
+ * @param tile The changed tile, or INVALID_TILE to drop all graphs.
+ */
+void RailGraphNotifyTrackLayoutChange(TileIndex tile)
+{
+	std::lock_guard<std::mutex> lock(_rail_graph_mutex);
+	assert(!_rail_graph_search_batch);
+	for (std::unique_ptr<RailJunctionGraph> &graph : _rail_graphs) {
+		if (graph == nullptr) continue;
+		if (tile == INVALID_TILE) {
+			graph.reset();
+		} else {
+			graph->QueueChange(tile);
+			/* Only one head of a new tunnel or bridge is reported, but both change. */
+			if (IsTileType(tile, MP_TUNNELBRIDGE)) graph->QueueChange(GetOtherTunnelBridgeEnd(tile));
+		}
+	}
+}
+
+/**
+ * Start a batch of path searches running on several threads.
+ * Distance lookups read the graphs without locking, so all queued changes are
+ * applied now, and the graphs stay as they are until the batch ends.
+ */
+void RailGraphBeginSearchBatch()
+{
+	std::lock_guard<std::mutex> lock(_rail_graph_mutex);
+	assert(!_rail_graph_search_batch);
+	for (std::unique_ptr<RailJunctionGraph> &graph : _rail_graphs) {
+		if (graph != nullptr) graph->Update();
+	}
+	_rail_graph_search_batch = true;
+}
+
+/** End a batch of path searches started by RailGraphBeginSearchBatch(). */
+void RailGraphEndSearchBatch()
+{
+	std::lock_guard<std::mutex> lock(_rail_graph_mutex);
+	assert(_rail_graph_search_batch);
+	_rail_graph_search_batch = false;
+}
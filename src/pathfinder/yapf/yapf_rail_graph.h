@@ -0,0 +1,53 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_rail_graph.h Junction graph of the rail network, used to guide long distance rail path searches. */
+
+#ifndef YAPF_RAIL_GRAPH_H
+#define YAPF_RAIL_GRAPH_H
+
+#include "../../stdafx.h"
+#include "../../tile_type.h"
+#include "../../track_type.h"
+#include "../../company_type.h"
+#include "../../station_type.h"
+
+class RailJunctionGraph;
+
+/** Estimate added for states the junction graph does not connect to the destination. */
+static const int YAPF_RAIL_GRAPH_UNREACHABLE_COST = 1 << 30;
+
+/**
+ * Static distances from the states of one rail network to one destination.
+ *  The distance of a state (tile and trackdir of a train about to leave the tile)
+ *  is the length of the shortest track connection to the destination, ignoring
+ *  signals, reservations, rail types and all penalties. That makes it a lower
+ *  bound of the YAPF cost, so it can be used as an A* estimate.
+ *  Instances are immutable, but looking up a distance reads the junction graph
+ *  they belong to. The graphs don't change between RailGraphBeginSearchBatch()
+ *  and RailGraphEndSearchBatch(), so only searches within such a batch may use
+ *  them on several threads at once.
+ */
+class RailGraphDistances {
+	friend class RailJunctionGraph;
+
+	const RailJunctionGraph *graph; ///< Graph the distances belong to.
+	std::vector<int32_t> dist;      ///< Distance per graph node.
+
+public:
+	static constexpr int32_t UNREACHABLE = INT32_MAX; ///< Distance of states not connected to the destination.
+	static constexpr int32_t UNKNOWN = -1;            ///< Distance of states the graph knows nothing about.
+
+	int32_t GetDistance(TileIndex tile, Trackdir td) const;
+};
+
+std::shared_ptr<const RailGraphDistances> GetRailGraphDistances(Owner owner, StationID station, TileIndex tile, TrackdirBits trackdirs);
+void RailGraphNotifyTrackLayoutChange(TileIndex tile);
+void RailGraphBeginSearchBatch();
+void RailGraphEndSearchBatch();
+
+#endif /* YAPF_RAIL_GRAPH_H */
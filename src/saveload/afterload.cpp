@@ -26,6 +26,7 @@
 #include "../roadveh_cmd.h"
 #include "../train.h"
 #include "../station_base.h"
+#include "../station_func.h"
 #include "../waypoint_base.h"
 #include "../roadstop_base.h"
 #include "../tunnelbridge_map.h"
@@ -3340,6 +3341,7 @@ bool AfterLoadGame()
 	AfterLoadLabelMaps();
 	AfterLoadCompanyStats();
 	AfterLoadStoryBook();
+	RebuildTownGrowthSchedule();
 
 	_gamelog.PrintDebug(1);
 
@@ -3400,6 +3402,8 @@ void ReloadNewGRFData()
 	AfterLoadCompanyStats();
 	/* Check and update house and town values */
 	UpdateHousesAndTowns();
+	/* House and industry specs may have changed what is accepted */
+	InvalidateAllAcceptanceChunks();
 	/* Delete news referring to no longer existing entities */
 	DeleteInvalidEngineNews();
 	/* Update livery selection windows */
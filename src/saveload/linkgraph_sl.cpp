@@ -19,6 +19,8 @@
 #include "../settings_internal.h"
 #include "../settings_table.h"
 
+#include "../citymania/cm_saveload.hpp"
+
 #include "../safeguards.h"
 
 typedef LinkGraph::BaseNode Node;
@@ -38,6 +40,7 @@ public:
 		SLE_CONDVAR(Edge, last_restricted_update,   SLE_INT32, SLV_187, SL_MAX_VERSION),
 		    SLE_VAR(Edge, dest_node,                SLE_UINT16),
 		SLE_CONDVARNAME(Edge, dest_node, "next_edge", SLE_UINT16, SL_MIN_VERSION, SLV_LINKGRAPH_EDGES),
+		CM_SLE_VAR("__cm_last_job_capacity", Edge, last_job_capacity, SLE_UINT32),
 	};
 	inline const static SaveLoadCompatTable compat_description = _linkgraph_edge_sl_compat;
 
@@ -101,6 +104,7 @@ public:
 		    SLE_VAR(Node, demand,      SLE_UINT32),
 		    SLE_VAR(Node, station,     SLE_UINT16),
 		    SLE_VAR(Node, last_update, SLE_INT32),
+		CM_SLE_VAR("__cm_last_job_supply", Node, last_job_supply, SLE_UINT32),
 		SLEG_STRUCTLIST("edges", SlLinkgraphEdge),
 	};
 	inline const static SaveLoadCompatTable compat_description = _linkgraph_node_sl_compat;
@@ -139,6 +143,7 @@ SaveLoadTable GetLinkGraphDesc()
 		 SLE_VAR(LinkGraph, last_compression, SLE_INT32),
 		SLEG_CONDVAR("num_nodes", _num_nodes, SLE_UINT16, SL_MIN_VERSION, SLV_SAVELOAD_LIST_LENGTH),
 		 SLE_VAR(LinkGraph, cargo,            SLE_UINT8),
+		CM_SLE_VAR("__cm_structure_changed", LinkGraph, structure_changed, SLE_BOOL),
 		SLEG_STRUCTLIST("nodes", SlLinkgraphNode),
 	};
 	return link_graph_desc;
@@ -184,6 +189,7 @@ SaveLoadTable GetLinkGraphJobDesc()
 	static const SaveLoad job_desc[] = {
 		SLE_VAR(LinkGraphJob, join_date,        SLE_INT32),
 		SLE_VAR(LinkGraphJob, link_graph.index, SLE_UINT16),
+		CM_SLE_VECTOR("__cm_incremental_sources", LinkGraphJob, incremental_sources, SLE_UINT16),
 		SLEG_STRUCT("linkgraph", SlLinkgraphJobProxy),
 	};
 
@@ -290,6 +290,8 @@ static const SaveLoad _town_desc[] = {
 	CM_SLE_VAR("__cm_hr_total",      Town, cm.hr_total,      SLE_UINT32),
 	CM_SLE_VAR("__cm_hr_this_month", Town, cm.hr_this_month, SLE_UINT16),
 	CM_SLE_VAR("__cm_hr_last_month", Town, cm.hr_last_month, SLE_UINT16),
+	CM_SLE_VECTOR("__cm_growth_frontier", Town, growth_frontier, SLE_UINT32),
+	CM_SLE_VAR("__cm_growth_frontier_dirty", Town, growth_frontier_dirty, SLE_BOOL),
 	SLEG_CONDSTRUCTLIST("__cm_growth_tiles", citymania::SlTownGrowthTiles, SLV_TABLE_CHUNKS, SL_MAX_VERSION),
 	SLEG_CONDSTRUCTLIST("__cm_growth_tiles_last_month", citymania::SlTownGrowthTilesLastMonth, SLV_TABLE_CHUNKS, SL_MAX_VERSION),
 };
@@ -306,6 +308,7 @@ struct CITYChunkHandler : ChunkHandler {
 		SlTableHeader(_town_desc);
 
 		for (Town *t : Town::Iterate()) {
+			t->grow_counter = t->GetGrowCounter();
 			SlSetArrayIndex(t->index);
 			SlObject(t, _town_desc);
 		}
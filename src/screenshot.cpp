@@ -29,6 +29,9 @@
 #include "landscape.h"
 #include "video/video_driver.hpp"
 #include "smallmap_gui.h"
+#include "thread.h"
+
+#include <condition_variable>
 
 #include "table/strings.h"
 
@@ -36,6 +39,7 @@
 
 static const char * const SCREENSHOT_NAME = "screenshot"; ///< Default filename of a saved screenshot.
 static const char * const HEIGHTMAP_NAME  = "heightmap";  ///< Default filename of a saved heightmap.
+static const char * const TILES_NAME      = "tiles";      ///< Default directory name of an exported map tile pyramid.
 
 std::string _screenshot_format_name;  ///< Extension of the current screenshot format (corresponds with #_cur_screenshot_format).
 uint _num_screenshot_formats;         ///< Number of available screenshot formats.
@@ -71,8 +75,22 @@ typedef bool ScreenshotHandlerProc(const char *name, ScreenshotCallback *callb,
 struct ScreenshotFormat {
 	const char *extension;       ///< File extension.
 	ScreenshotHandlerProc *proc; ///< Function for writing the screenshot.
+	bool bottom_up;              ///< Whether \a proc requests the lines from the bottom of the image upwards.
 };
 
+/**
+ * Get the number of lines a screenshot writer requests from its callback at once.
+ * This aims for 64k of pixel data per call, and is shared by all writers so
+ * the lines can be rendered ahead of time by #ScreenshotStreamer.
+ * @param w           Width of the image in pixels.
+ * @param pixelformat Bits per pixel (bpp), either 8 or 32.
+ * @return Number of lines per callback invocation.
+ */
+static uint GetScreenshotLinesPerCall(uint w, int pixelformat)
+{
+	return Clamp(65536 / std::max<uint>(1, w * pixelformat / 8), 16, 128);
+}
+
 #define MKCOLOUR(x)         TO_LE32X(x)
 
 /*************************************************
@@ -179,7 +197,7 @@ static bool MakeBMPImage(const char *name, ScreenshotCallback *callb, void *user
 	}
 
 	/* Try to use 64k of memory, store between 16 and 128 lines */
-	uint maxlines = Clamp(65536 / (w * pixelformat / 8), 16, 128); // number of lines per iteration
+	uint maxlines = GetScreenshotLinesPerCall(w, pixelformat); // number of lines per iteration
 
 	uint8_t *buff = MallocT<uint8_t>(maxlines * w * pixelformat / 8); // buffer which is rendered to
 	uint8_t *line = CallocT<uint8_t>(bytewidth); // one line, stored to file
@@ -371,7 +389,7 @@ static bool MakePNGImage(const char *name, ScreenshotCallback *callb, void *user
 	}
 
 	/* use by default 64k temp memory */
-	maxlines = Clamp(65536 / w, 16, 128);
+	maxlines = GetScreenshotLinesPerCall(w, pixelformat);
 
 	/* now generate the bitmap bits */
 	void *buff = CallocT<uint8_t>(static_cast<size_t>(w) * maxlines * bpp); // by default generate 128 lines at a time.
@@ -478,7 +496,7 @@ static bool MakePCXImage(const char *name, ScreenshotCallback *callb, void *user
 	}
 
 	/* use by default 64k temp memory */
-	maxlines = Clamp(65536 / w, 16, 128);
+	maxlines = GetScreenshotLinesPerCall(w, pixelformat);
 
 	/* now generate the bitmap bits */
 	uint8_t *buff = CallocT<uint8_t>(static_cast<size_t>(w) * maxlines); // by default generate 128 lines at a time.
@@ -569,10 +587,10 @@ static bool MakePCXImage(const char *name, ScreenshotCallback *callb, void *user
 /** Available screenshot formats. */
 static const ScreenshotFormat _screenshot_formats[] = {
 #if defined(WITH_PNG)
-	{"png", &MakePNGImage},
+	{"png", &MakePNGImage, false},
 #endif
-	{"bmp", &MakeBMPImage},
-	{"pcx", &MakePCXImage},
+	{"bmp", &MakeBMPImage, true},
+	{"pcx", &MakePCXImage, false},
 };
 
 /** Get filename extension of current screenshot file format. */
@@ -659,6 +677,151 @@ static void LargeWorldCallback(void *userdata, void *buf, uint y, uint pitch, ui
 	_screen_disable_anim = old_disable_anim;
 }
 
+/**
+ * Pipeline for writing large screenshots.
+ * The lines are rendered in strips on the calling thread, while the screenshot
+ * writer encodes and writes the previously rendered strips on its own thread.
+ * At most #MAX_QUEUED_STRIPS strips are held in memory at any time.
+ */
+class ScreenshotStreamer {
+public:
+	/** Maximum number of rendered strips waiting for the writer thread. */
+	static const uint MAX_QUEUED_STRIPS = 4;
+
+	ScreenshotStreamer(ScreenshotCallback *callb, void *userdata, uint w, uint h, int pixelformat) :
+			callb(callb), userdata(userdata), w(w), h(h), pixelformat(pixelformat),
+			lines_per_strip(GetScreenshotLinesPerCall(w, pixelformat)) {}
+
+	bool Write(const ScreenshotFormat *sf, const char *name, const Colour *palette, const ScreenshotProgressCallback &progress);
+
+private:
+	/** A rendered part of the image. */
+	struct Strip {
+		uint y;                          ///< First line of the strip.
+		uint n;                          ///< Number of lines in the strip.
+		std::unique_ptr<uint8_t[]> buf;  ///< Rendered pixels, \c w pixels per line.
+	};
+
+	ScreenshotCallback *callb; ///< Callback rendering the lines.
+	void *userdata;            ///< User data, passed on to \a callb.
+	uint w;                    ///< Width of the image in pixels.
+	uint h;                    ///< Height of the image in pixels.
+	int pixelformat;           ///< Bits per pixel (bpp), either 8 or 32.
+	uint lines_per_strip;      ///< Number of lines per strip, matching the requests of the writer.
+
+	const ScreenshotFormat *sf = nullptr; ///< The format to write the screenshot in.
+	std::string name;                     ///< Filename, including extension.
+	const Colour *palette = nullptr;      ///< %Colour palette (for 8bpp images).
+
+	std::mutex lock;                              ///< Lock protecting the members below.
+	std::condition_variable cv;                   ///< Signalled when a strip is queued or released, or the writer finished.
+	std::deque<Strip> queue;                      ///< Rendered strips in the order the writer requests them.
+	std::vector<std::unique_ptr<uint8_t[]>> pool; ///< Buffers of strips the writer is done with.
+	bool writer_done = false;                     ///< Whether the writer stopped, successfully or not.
+	bool writer_result = false;                   ///< Result of the writer once \c writer_done is set.
+
+	size_t StripSize() const { return static_cast<size_t>(this->w) * this->lines_per_strip * (this->pixelformat / 8); }
+
+	static void StreamCallback(void *userdata, void *buf, uint y, uint pitch, uint n);
+	static void RunWriter(ScreenshotStreamer *self);
+};
+
+/**
+ * Screenshot callback of the writer thread, handing out the next rendered strip.
+ * @see ScreenshotCallback
+ */
+/* static */ void ScreenshotStreamer::StreamCallback(void *userdata, void *buf, uint y, uint pitch, uint n)
+{
+	ScreenshotStreamer *self = static_cast<ScreenshotStreamer *>(userdata);
+	uint bpp = self->pixelformat / 8;
+
+	std::unique_lock<std::mutex> lock(self->lock);
+	self->cv.wait(lock, [self] { return !self->queue.empty(); });
+
+	Strip strip = std::move(self->queue.front());
+	self->queue.pop_front();
+	lock.unlock();
+
+	/* All writers request lines in chunks of GetScreenshotLinesPerCall(), so strips map one-to-one onto requests. */
+	assert(strip.y == y && strip.n == n);
+	for (uint i = 0; i < n; i++) {
+		memcpy(static_cast<uint8_t *>(buf) + static_cast<size_t>(i) * pitch * bpp, strip.buf.get() + static_cast<size_t>(i) * self->w * bpp, static_cast<size_t>(self->w) * bpp);
+	}
+
+	lock.lock();
+	self->pool.push_back(std::move(strip.buf));
+	self->cv.notify_all();
+}
+
+/**
+ * Body of the writer thread.
+ * @param self The streamer to write.
+ */
+/* static */ void ScreenshotStreamer::RunWriter(ScreenshotStreamer *self)
+{
+	bool result = self->sf->proc(self->name.c_str(), &ScreenshotStreamer::StreamCallback, self, self->w, self->h, self->pixelformat, self->palette);
+
+	std::lock_guard<std::mutex> lock(self->lock);
+	self->writer_result = result;
+	self->writer_done = true;
+	self->cv.notify_all();
+}
+
+/**
+ * Render and write the screenshot.
+ * @param sf       The format to write the screenshot in.
+ * @param name     Filename, including extension.
+ * @param palette  %Colour palette (for 8bpp images).
+ * @param progress Optional callback informed after each rendered strip.
+ * @return File was written successfully.
+ */
+bool ScreenshotStreamer::Write(const ScreenshotFormat *sf, const char *name, const Colour *palette, const ScreenshotProgressCallback &progress)
+{
+	this->sf = sf;
+	this->name = name;
+	this->palette = palette;
+
+	std::thread writer;
+	if (!StartNewThread(&writer, "ottd:screenshot", &ScreenshotStreamer::RunWriter, this)) {
+		/* No threads; write it the old-fashioned way. */
+		if (!sf->proc(name, this->callb, this->userdata, this->w, this->h, this->pixelformat, palette)) return false;
+		if (progress) progress(this->h, this->h);
+		return true;
+	}
+
+	uint rendered = 0;
+	while (rendered != this->h) {
+		std::unique_ptr<uint8_t[]> buf;
+		{
+			std::unique_lock<std::mutex> lock(this->lock);
+			this->cv.wait(lock, [this] { return this->writer_done || this->queue.size() < MAX_QUEUED_STRIPS; });
+			if (this->writer_done) break;
+			if (!this->pool.empty()) {
+				buf = std::move(this->pool.back());
+				this->pool.pop_back();
+			}
+		}
+		if (buf == nullptr) buf = std::make_unique<uint8_t[]>(this->StripSize());
+
+		/* Produce the strips in the same order as the writer is going to request them. */
+		uint n = std::min(this->h - rendered, this->lines_per_strip);
+		uint y = sf->bottom_up ? this->h - rendered - n : rendered;
+		this->callb(this->userdata, buf.get(), y, this->w, n);
+		rendered += n;
+
+		{
+			std::lock_guard<std::mutex> lock(this->lock);
+			this->queue.push_back({y, n, std::move(buf)});
+			this->cv.notify_all();
+		}
+
+		if (progress) progress(rendered, this->h);
+	}
+
+	writer.join();
+	return this->writer_result;
+}
+
 /**
  * Construct a pathname for a screenshot file.
  * @param default_fn Default filename.
@@ -800,14 +963,162 @@ void SetupScreenshotViewport(ScreenshotType t, Viewport *vp, uint32_t width, uin
  * @param height the height of the screenshot of, or 0 for current viewport height.
  * @return true on success
  */
-static bool MakeLargeWorldScreenshot(ScreenshotType t, uint32_t width = 0, uint32_t height = 0)
+static bool MakeLargeWorldScreenshot(ScreenshotType t, uint32_t width = 0, uint32_t height = 0, const ScreenshotProgressCallback &progress = {})
 {
 	Viewport vp;
 	SetupScreenshotViewport(t, &vp, width, height);
 
 	const ScreenshotFormat *sf = _screenshot_formats + _cur_screenshot_format;
-	return sf->proc(MakeScreenshotName(SCREENSHOT_NAME, sf->extension), LargeWorldCallback, &vp, vp.width, vp.height,
-			BlitterFactory::GetCurrentBlitter()->GetScreenDepth(), _cur_palette.palette);
+	ScreenshotStreamer streamer(LargeWorldCallback, &vp, vp.width, vp.height, BlitterFactory::GetCurrentBlitter()->GetScreenDepth());
+	return streamer.Write(sf, MakeScreenshotName(SCREENSHOT_NAME, sf->extension), _cur_palette.palette, progress);
+}
+
+/** Width and height of a tile of the map tile pyramid, in pixels. */
+static const uint TILE_PYRAMID_TILE_SIZE = 256;
+
+/** Layout of the exported map tile pyramid and the changes to the map since its last export. */
+struct TilePyramidState {
+	bool active = false;         ///< Whether the pyramid has been exported, i.e. whether changes are being tracked.
+	Point origin;                ///< Virtual coordinates of the top left corner of tile (0, 0) at all levels.
+	ZoomLevel min_zoom;          ///< Most zoomed in level of the pyramid.
+	ZoomLevel max_zoom;          ///< Most zoomed out level of the pyramid.
+	uint columns;                ///< Number of tiles per row at the most zoomed in level.
+	uint rows;                   ///< Number of tiles per column at the most zoomed in level.
+	std::vector<bool> dirty;     ///< Whether something changed below a tile of the most zoomed in level.
+};
+
+static TilePyramidState _tile_pyramid; ///< The state of the map tile pyramid export.
+
+/** Forget about the previously exported map tile pyramid, e.g. because another game is loaded. */
+void ResetTilePyramid()
+{
+	_tile_pyramid = {};
+}
+
+/**
+ * Mark the tiles of the map tile pyramid covering an area as changed, so they are rendered on the next export.
+ * @param left Left edge of the area, in virtual coordinates.
+ * @param top Top edge of the area, in virtual coordinates.
+ * @param right Right edge of the area, in virtual coordinates.
+ * @param bottom Bottom edge of the area, in virtual coordinates.
+ */
+void MarkTilePyramidDirty(int left, int top, int right, int bottom)
+{
+	TilePyramidState &state = _tile_pyramid;
+	if (!state.active) return;
+
+	int size = ScaleByZoom(TILE_PYRAMID_TILE_SIZE, state.min_zoom);
+	int x1 = Clamp((left - state.origin.x) / size, 0, (int)state.columns - 1);
+	int x2 = Clamp((right - state.origin.x) / size, 0, (int)state.columns - 1);
+	int y1 = Clamp((top - state.origin.y) / size, 0, (int)state.rows - 1);
+	int y2 = Clamp((bottom - state.origin.y) / size, 0, (int)state.rows - 1);
+
+	for (int y = y1; y <= y2; y++) {
+		for (int x = x1; x <= x2; x++) {
+			state.dirty[y * state.columns + x] = true;
+		}
+	}
+}
+
+/**
+ * Export the map as a z/x/y pyramid of #TILE_PYRAMID_TILE_SIZE pixel tiles for web map viewers.
+ * Level \c z of the pyramid is rendered at the viewport zoom level \c max_zoom - \c z, so level 0
+ * is the most zoomed out one. Only tiles below which the map changed since the previous export,
+ * as signalled via #MarkTilePyramidDirty, are rendered again; the first export renders all of them.
+ * @param dir Name of the directory in the screenshot directory to write the tiles to.
+ * @return True iff all tiles were written successfully.
+ */
+static bool MakeTilePyramid(const std::string &dir)
+{
+	const ScreenshotFormat *sf = _screenshot_formats + _cur_screenshot_format;
+	ZoomLevel min_zoom = std::max(ZOOM_LVL_WORLD_SCREENSHOT, _settings_client.gui.zoom_min);
+	ZoomLevel max_zoom = std::max(min_zoom, _settings_client.gui.zoom_max);
+
+	/* Unlike the world screenshot, do not depend on the current landscape, so tiles stay at the same place between exports. */
+	Point origin;
+	origin.x = RemapCoords(Map::MaxX() * TILE_SIZE, 0, 0).x;
+	origin.y = RemapCoords(0, 0, _settings_game.construction.map_height_limit * TILE_HEIGHT + 150).y;
+	int width = RemapCoords(0, Map::MaxY() * TILE_SIZE, 0).x - origin.x + 1;
+	int height = RemapCoords(Map::MaxX() * TILE_SIZE, Map::MaxY() * TILE_SIZE, 0).y - origin.y + 1;
+
+	uint columns = CeilDiv(width, ScaleByZoom(TILE_PYRAMID_TILE_SIZE, min_zoom));
+	uint rows = CeilDiv(height, ScaleByZoom(TILE_PYRAMID_TILE_SIZE, min_zoom));
+
+	TilePyramidState &state = _tile_pyramid;
+	if (!state.active || state.origin.x != origin.x || state.origin.y != origin.y || state.min_zoom != min_zoom || state.max_zoom != max_zoom || state.columns != columns || state.rows != rows) {
+		/* Nothing to compare against; render everything. */
+		state.origin = origin;
+		state.min_zoom = min_zoom;
+		state.max_zoom = max_zoom;
+		state.columns = columns;
+		state.rows = rows;
+		state.dirty.assign(static_cast<size_t>(columns) * rows, true);
+	}
+
+	/* Start tracking the changes for the next export. */
+	std::vector<bool> dirty = std::move(state.dirty);
+	state.dirty.assign(dirty.size(), false);
+	state.active = true;
+
+	const std::string base = fmt::format("{}{}{}", FiosGetScreenshotDir(), dir, PATHSEP);
+	int depth = BlitterFactory::GetCurrentBlitter()->GetScreenDepth();
+	uint rendered = 0;
+
+	for (ZoomLevel zoom = min_zoom;; zoom++) {
+		uint z = max_zoom - zoom;
+		int size = ScaleByZoom(TILE_PYRAMID_TILE_SIZE, zoom);
+
+		for (uint x = 0; x < columns; x++) {
+			bool created = false;
+			for (uint y = 0; y < rows; y++) {
+				if (!dirty[y * columns + x]) continue;
+
+				if (!created) {
+					FioCreateDirectory(fmt::format("{}{}{}{}", base, z, PATHSEP, x));
+					created = true;
+				}
+
+				Viewport vp;
+				vp.zoom = zoom;
+				vp.virtual_left = origin.x + x * size;
+				vp.virtual_top = origin.y + y * size;
+				vp.virtual_width = size;
+				vp.virtual_height = size;
+				vp.left = 0;
+				vp.top = 0;
+				vp.width = TILE_PYRAMID_TILE_SIZE;
+				vp.height = TILE_PYRAMID_TILE_SIZE;
+				vp.overlay = nullptr;
+				UpdateViewportSizeZoom(&vp);
+
+				std::string name = fmt::format("{}{}{}{}{}{}.{}", base, z, PATHSEP, x, PATHSEP, y, sf->extension);
+				if (!sf->proc(name.c_str(), LargeWorldCallback, &vp, vp.width, vp.height, depth, _cur_palette.palette)) {
+					/* We do not know what made it to disk; start over on the next export. */
+					ResetTilePyramid();
+					return false;
+				}
+				rendered++;
+			}
+		}
+
+		if (zoom == max_zoom) break;
+
+		/* A tile of the next level covers 2x2 tiles of this one. */
+		uint next_columns = CeilDiv(columns, 2);
+		uint next_rows = CeilDiv(rows, 2);
+		std::vector<bool> next_dirty(static_cast<size_t>(next_columns) * next_rows, false);
+		for (uint y = 0; y < rows; y++) {
+			for (uint x = 0; x < columns; x++) {
+				if (dirty[y * columns + x]) next_dirty[(y / 2) * next_columns + x / 2] = true;
+			}
+		}
+		dirty = std::move(next_dirty);
+		columns = next_columns;
+		rows = next_rows;
+	}
+
+	Debug(misc, 1, "Map tile pyramid export rendered {} tiles", rendered);
+	return true;
 }
 
 /**
@@ -901,9 +1212,10 @@ void MakeScreenshotWithConfirm(ScreenshotType t)
  * @param name the name to give to the screenshot.
  * @param width the width of the screenshot of, or 0 for current viewport width (only works for SC_ZOOMEDIN and SC_DEFAULTZOOM).
  * @param height the height of the screenshot of, or 0 for current viewport height (only works for SC_ZOOMEDIN and SC_DEFAULTZOOM).
+ * @param progress optional callback informed about the rendering progress (only used for SC_ZOOMEDIN, SC_DEFAULTZOOM and SC_WORLD).
  * @return true iff the screenshot was made successfully
  */
-static bool RealMakeScreenshot(ScreenshotType t, std::string name, uint32_t width, uint32_t height)
+static bool RealMakeScreenshot(ScreenshotType t, std::string name, uint32_t width, uint32_t height, const ScreenshotProgressCallback &progress)
 {
 	if (t == SC_VIEWPORT) {
 		/* First draw the dirty parts of the screen and only then change the name
@@ -930,11 +1242,11 @@ static bool RealMakeScreenshot(ScreenshotType t, std::string name, uint32_t widt
 
 		case SC_ZOOMEDIN:
 		case SC_DEFAULTZOOM:
-			ret = MakeLargeWorldScreenshot(t, width, height);
+			ret = MakeLargeWorldScreenshot(t, width, height, progress);
 			break;
 
 		case SC_WORLD:
-			ret = MakeLargeWorldScreenshot(t);
+			ret = MakeLargeWorldScreenshot(t, 0, 0, progress);
 			break;
 
 		case SC_HEIGHTMAP: {
@@ -947,6 +1259,10 @@ static bool RealMakeScreenshot(ScreenshotType t, std::string name, uint32_t widt
 			ret = MakeMinimapWorldScreenshot();
 			break;
 
+		case SC_TILES:
+			ret = MakeTilePyramid(_screenshot_name.empty() ? TILES_NAME : _screenshot_name);
+			break;
+
 		default:
 			NOT_REACHED();
 	}
@@ -974,20 +1290,21 @@ static bool RealMakeScreenshot(ScreenshotType t, std::string name, uint32_t widt
  * @param name the name to give to the screenshot.
  * @param width the width of the screenshot of, or 0 for current viewport width (only works for SC_ZOOMEDIN and SC_DEFAULTZOOM).
  * @param height the height of the screenshot of, or 0 for current viewport height (only works for SC_ZOOMEDIN and SC_DEFAULTZOOM).
+ * @param progress optional callback informed about the rendering progress (only used for SC_ZOOMEDIN, SC_DEFAULTZOOM and SC_WORLD).
  * @return true iff the screenshot was successfully made.
  * @see MakeScreenshotWithConfirm
  */
-bool MakeScreenshot(ScreenshotType t, std::string name, uint32_t width, uint32_t height)
+bool MakeScreenshot(ScreenshotType t, std::string name, uint32_t width, uint32_t height, ScreenshotProgressCallback progress)
 {
 	if (t == SC_CRASHLOG) {
 		/* Video buffer might or might not be locked. */
 		VideoDriver::VideoBufferLocker lock;
 
-		return RealMakeScreenshot(t, name, width, height);
+		return RealMakeScreenshot(t, name, width, height, progress);
 	}
 
 	VideoDriver::GetInstance()->QueueOnMainThread([=] { // Capture by value to not break scope.
-		RealMakeScreenshot(t, name, width, height);
+		RealMakeScreenshot(t, name, width, height, progress);
 	});
 
 	return true;
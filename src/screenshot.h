@@ -23,13 +23,23 @@ enum ScreenshotType {
 	SC_WORLD,       ///< World screenshot.
 	SC_HEIGHTMAP,   ///< Heightmap of the world.
 	SC_MINIMAP,     ///< Minimap screenshot.
+	SC_TILES,       ///< Pyramid of map tiles for web map viewers.
 };
 
+/**
+ * Callback informed about the progress of rendering a large screenshot.
+ * @param done  Number of lines rendered so far.
+ * @param total Total number of lines of the screenshot.
+ */
+typedef std::function<void(uint done, uint total)> ScreenshotProgressCallback;
+
 void SetupScreenshotViewport(ScreenshotType t, struct Viewport *vp, uint32_t width = 0, uint32_t height = 0);
 bool MakeHeightmapScreenshot(const char *filename);
 void MakeScreenshotWithConfirm(ScreenshotType t);
-bool MakeScreenshot(ScreenshotType t, std::string name, uint32_t width = 0, uint32_t height = 0);
+bool MakeScreenshot(ScreenshotType t, std::string name, uint32_t width = 0, uint32_t height = 0, ScreenshotProgressCallback progress = {});
 bool MakeMinimapWorldScreenshot();
+void MarkTilePyramidDirty(int left, int top, int right, int bottom);
+void ResetTilePyramid();
 
 extern std::string _screenshot_format_name;
 extern uint _num_screenshot_formats;
@@ -161,6 +161,7 @@ struct GUISettings {
 	ZoomLevel sprite_zoom_min;               ///< maximum zoom level at which higher-resolution alternative sprites will be used (if available) instead of scaling a lower resolution sprite
 	uint32_t autosave_interval;              ///< how often should we do autosaves?
 	bool   threaded_saves;                   ///< should we do threaded saves?
+	bool   newgrf_resolve_cache;             ///< reuse the results of NewGRF sprite group chains that only depend on cacheable variables
 	bool   keep_all_autosave;                ///< name the autosave in a different way
 	bool   autosave_on_exit;                 ///< save an autosave when you quit the game, but do not ask "Do you really want to quit?"
 	bool   autosave_on_network_disconnect;   ///< save an autosave when you get disconnected from a network game with an error?
@@ -509,6 +510,8 @@ struct YAPFSettings {
 	uint32_t rail_pbs_station_penalty;         ///< penalty for crossing a reserved station tile
 	uint32_t rail_pbs_signal_back_penalty;     ///< penalty for passing a pbs signal from the backside
 	uint32_t rail_doubleslip_penalty;          ///< penalty for passing a double slip switch
+	bool   rail_batched_pathfinding;         ///< search the paths of stuck trains in one parallel batch at the start of the vehicle ticks
+	bool   rail_junction_graph;              ///< guide train path searches by the track distances of a precomputed junction graph
 
 	uint32_t rail_longer_platform_penalty;           ///< penalty for longer  station platform than train
 	uint32_t rail_longer_platform_per_tile_penalty;  ///< penalty for longer  station platform than train (per tile)
@@ -592,6 +595,7 @@ struct EconomySettings {
 	TownLayout town_layout;                  ///< select town layout, @see TownLayout
 	TownCargoGenMode town_cargogen_mode;     ///< algorithm for generating cargo from houses, @see TownCargoGenMode
 	bool   allow_town_roads;                 ///< towns are allowed to build roads (always allowed when generating world / in SE)
+	bool   town_growth_frontier;             ///< towns grow from a cached set of road tiles next to free land instead of a random walk from their centre
 	TownFounding found_town;                 ///< town founding.
 	bool   station_noise_level;              ///< build new airports when the town noise level is still within accepted limits
 	uint16_t town_noise_population[4];         ///< population to base decision on noise evaluation (@see town_council_tolerance)
@@ -142,6 +142,20 @@ bool SpriteExists(SpriteID id)
 	return !(GetSpriteCache(id)->file_pos == 0 && GetSpriteCache(id)->file == nullptr);
 }
 
+/**
+ * Check whether a sprite is currently loaded in the sprite cache, i.e.
+ * whether GetRawSprite() would return it without reading or allocating.
+ * @param id The sprite to look at.
+ * @param type The type the sprite is going to be requested as.
+ * @return True iff the sprite can be fetched without touching the cache layout.
+ */
+bool IsSpriteInCache(SpriteID id, SpriteType type)
+{
+	if (!SpriteExists(id)) return false;
+	const SpriteCache *sc = GetSpriteCache(id);
+	return sc->type == type && sc->ptr != nullptr;
+}
+
 /**
  * Get the sprite type of a given sprite.
  * @param sprite The sprite to look at.
@@ -19,6 +19,7 @@
 #include "vehiclelist.h"
 #include "town.h"
 #include "core/pool_func.hpp"
+#include "core/container_func.hpp"
 #include "station_base.h"
 #include "station_kdtree.h"
 #include "roadstop_base.h"
@@ -461,6 +462,64 @@ bool Station::CatchmentCoversTown(TownID t) const
 	return false;
 }
 
+/**
+ * Get the index of a tile in Station::catchment_counts, which uses the layout of the catchment bitmap.
+ * @param area Area of the catchment bitmap.
+ * @param tile Tile within the area.
+ * @return Index of the tile.
+ */
+static inline uint CatchmentCountIndex(const TileArea &area, TileIndex tile)
+{
+	return (TileY(tile) - TileY(area.tile)) * area.w + (TileX(tile) - TileX(area.tile));
+}
+
+/**
+ * Find the station tiles contributing to the catchment area of a station.
+ * @param st Station to look at.
+ * @return The station tiles with their catchment radius, sorted by tile.
+ */
+static CatchmentSourceList GetCatchmentSources(const Station *st)
+{
+	CatchmentSourceList sources;
+
+	TileArea ta(TileXY(st->rect.left, st->rect.top), TileXY(st->rect.right, st->rect.bottom));
+	for (TileIndex tile : ta) {
+		if (!IsTileType(tile, MP_STATION) || GetStationIndex(tile) != st->index) continue;
+
+		uint r = GetTileCatchmentRadius(tile, st);
+		if (r == CA_NONE) continue;
+
+		sources.emplace_back(tile, r);
+	}
+
+	return sources;
+}
+
+/**
+ * Add or remove the coverage of a single station tile to the catchment area of a station.
+ * @param st Station to change.
+ * @param tile Station tile.
+ * @param radius Catchment radius of the station tile.
+ * @param add True to add the coverage, false to remove it.
+ * @param changed If not nullptr, tiles entering or leaving the catchment area are appended to it.
+ */
+static void ChangeCatchmentCoverage(Station *st, TileIndex tile, uint radius, bool add, std::vector<TileIndex> *changed)
+{
+	TileArea ta = TileArea(tile, 1, 1).Expand(radius);
+	for (TileIndex tile2 : ta) {
+		uint16_t &count = st->catchment_counts[CatchmentCountIndex(st->catchment_tiles, tile2)];
+		if (add) {
+			if (count++ != 0) continue;
+			st->catchment_tiles.SetTile(tile2);
+		} else {
+			assert(count != 0);
+			if (--count != 0) continue;
+			st->catchment_tiles.ClrTile(tile2);
+		}
+		if (changed != nullptr) changed->push_back(tile2);
+	}
+}
+
 /**
  * Recompute tiles covered in our catchment area.
  * This will additionally recompute nearby towns and industries.
@@ -468,7 +527,10 @@ bool Station::CatchmentCoversTown(TownID t) const
  */
 void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 {
+	this->cached_acceptance_generation = 0;
 	this->industries_near.clear();
+	this->catchment_counts.clear();
+	this->catchment_sources.clear();
 	if (!no_clear_nearby_lists) this->RemoveFromAllNearbyLists();
 
 	if (this->rect.IsEmpty()) {
@@ -495,18 +557,13 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 	}
 
 	this->catchment_tiles.Initialize(GetCatchmentRect());
+	this->catchment_counts.assign(this->catchment_tiles.w * this->catchment_tiles.h, 0);
+	this->catchment_xy = this->xy;
 
-	/* Loop finding all station tiles */
-	TileArea ta(TileXY(this->rect.left, this->rect.top), TileXY(this->rect.right, this->rect.bottom));
-	for (TileIndex tile : ta) {
-		if (!IsTileType(tile, MP_STATION) || GetStationIndex(tile) != this->index) continue;
-
-		uint r = GetTileCatchmentRadius(tile, this);
-		if (r == CA_NONE) continue;
-
-		/* This tile sub-loop doesn't need to test any tiles, they are simply added to the catchment set. */
-		TileArea ta2 = TileArea(tile, 1, 1).Expand(r);
-		for (TileIndex tile2 : ta2) this->catchment_tiles.SetTile(tile2);
+	/* Count the coverage of all station tiles. */
+	this->catchment_sources = GetCatchmentSources(this);
+	for (const auto &[tile, r] : this->catchment_sources) {
+		ChangeCatchmentCoverage(this, tile, r, true, nullptr);
 	}
 
 	/* Search catchment tiles for towns and industries */
@@ -530,6 +587,133 @@ void Station::RecomputeCatchment(bool no_clear_nearby_lists)
 	}
 }
 
+static uint _catchment_batch_depth = 0;              ///< Number of active StationCatchmentBatch scopes.
+static std::vector<StationID> _catchment_batch_stations; ///< Stations waiting for a catchment update at the end of the batch.
+
+StationCatchmentBatch::StationCatchmentBatch()
+{
+	_catchment_batch_depth++;
+}
+
+StationCatchmentBatch::~StationCatchmentBatch()
+{
+	if (--_catchment_batch_depth > 0) return;
+
+	std::vector<StationID> stations = std::move(_catchment_batch_stations);
+	_catchment_batch_stations.clear();
+	for (StationID id : stations) {
+		Station *st = Station::GetIfValid(id);
+		if (st != nullptr) st->UpdateCatchment();
+	}
+}
+
+/**
+ * Update tiles covered in our catchment area after station tiles have been added, removed or changed.
+ * Only the coverage of the station tiles that changed since the last update is added or removed,
+ * and only towns and industries on tiles entering or leaving the catchment area are looked at.
+ * The result is the same as that of RecomputeCatchment, which is used instead whenever
+ * the cached coverage can not be reused.
+ */
+void Station::UpdateCatchment()
+{
+	if (_catchment_batch_depth > 0) {
+		include(_catchment_batch_stations, this->index);
+		return;
+	}
+
+	/* Distances of industries depend on the station location, and neutral stations have a catchment of their own. */
+	if (this->rect.IsEmpty() || this->catchment_counts.empty() || this->xy != this->catchment_xy ||
+			(!_settings_game.station.serve_neutral_industries && this->industry != nullptr)) {
+		this->RecomputeCatchment();
+		return;
+	}
+
+	this->cached_acceptance_generation = 0;
+
+	/* Make room for the catchment of new station tiles outside of the area covered so far. */
+	Rect r = this->GetCatchmentRect();
+	TileArea area = this->catchment_tiles;
+	area.Add(TileXY(r.left, r.top));
+	area.Add(TileXY(r.right, r.bottom));
+	if (area.w != this->catchment_tiles.w || area.h != this->catchment_tiles.h) {
+		BitmapTileArea tiles(area);
+		std::vector<uint16_t> counts(area.w * area.h, 0);
+		BitmapTileIterator it(this->catchment_tiles);
+		for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
+			counts[CatchmentCountIndex(area, tile)] = this->catchment_counts[CatchmentCountIndex(this->catchment_tiles, tile)];
+			tiles.SetTile(tile);
+		}
+		this->catchment_tiles = std::move(tiles);
+		this->catchment_counts = std::move(counts);
+	}
+
+	/* Both source lists are sorted by tile, so walk them side by side and apply the differences. */
+	CatchmentSourceList sources = GetCatchmentSources(this);
+	std::vector<TileIndex> changed;
+	auto old_it = this->catchment_sources.begin();
+	auto new_it = sources.begin();
+	while (old_it != this->catchment_sources.end() || new_it != sources.end()) {
+		if (new_it == sources.end() || (old_it != this->catchment_sources.end() && old_it->first < new_it->first)) {
+			ChangeCatchmentCoverage(this, old_it->first, old_it->second, false, &changed);
+			++old_it;
+		} else if (old_it == this->catchment_sources.end() || new_it->first < old_it->first) {
+			ChangeCatchmentCoverage(this, new_it->first, new_it->second, true, &changed);
+			++new_it;
+		} else {
+			if (old_it->second != new_it->second) {
+				ChangeCatchmentCoverage(this, old_it->first, old_it->second, false, &changed);
+				ChangeCatchmentCoverage(this, new_it->first, new_it->second, true, &changed);
+			}
+			++old_it;
+			++new_it;
+		}
+	}
+	this->catchment_sources = std::move(sources);
+
+	/* A tile may have left and entered again, so only look at whether it is covered now. */
+	std::vector<Town *> towns;
+	std::vector<Industry *> industries;
+	for (TileIndex tile : changed) {
+		bool covered = this->catchment_tiles.HasTile(tile);
+		if (IsTileType(tile, MP_HOUSE)) {
+			Town *t = Town::GetByTile(tile);
+			if (covered) {
+				t->stations_near.insert(this);
+			} else {
+				include(towns, t);
+			}
+		}
+		if (IsTileType(tile, MP_INDUSTRY)) {
+			Industry *i = Industry::GetByTile(tile);
+
+			/* Ignore industry if it has a neutral station. It already can't be this station. */
+			if (!_settings_game.station.serve_neutral_industries && i->neutral_station != nullptr) continue;
+
+			include(industries, i);
+		}
+	}
+
+	for (Town *t : towns) {
+		if (t->stations_near.count(this) != 0 && !this->CatchmentCoversTown(t->index)) t->stations_near.erase(this);
+	}
+
+	for (Industry *i : industries) {
+		/* The distance is measured to the closest covered tile, so measure the whole industry again. */
+		this->RemoveIndustryToDeliver(i);
+		bool covered = false;
+		for (TileIndex tile : i->location) {
+			if (!this->TileIsInCatchment(tile) || !IsTileType(tile, MP_INDUSTRY) || GetIndustryIndex(tile) != i->index) continue;
+			covered = true;
+			this->AddIndustryToDeliver(i, tile);
+		}
+		if (covered) {
+			i->stations_near.insert(this);
+		} else {
+			i->stations_near.erase(this);
+		}
+	}
+}
+
 /**
  * Recomputes catchment of all stations.
  * This will additionally recompute nearby stations for all towns and industries.
@@ -438,6 +438,9 @@ struct IndustryCompare {
 
 typedef std::set<IndustryListEntry, IndustryCompare> IndustryList;
 
+/** Station tiles contributing to a catchment area, with their catchment radius, sorted by tile. */
+typedef std::vector<std::pair<TileIndex, uint>> CatchmentSourceList;
+
 /** Station data structure */
 struct Station final : SpecializedStation<Station, false> {
 public:
@@ -460,6 +463,9 @@ public:
 	IndustryType indtype;   ///< Industry type to get the name from
 
 	BitmapTileArea catchment_tiles; ///< NOSAVE: Set of individual tiles covered by catchment area
+	std::vector<uint16_t> catchment_counts; ///< NOSAVE: Number of station tiles covering each tile of #catchment_tiles, in the same layout
+	CatchmentSourceList catchment_sources;  ///< NOSAVE: Station tiles counted in #catchment_counts
+	TileIndex catchment_xy = INVALID_TILE;  ///< NOSAVE: Station location the distances in #industries_near were measured from
 
 	StationHadVehicleOfType had_vehicle_of_type;
 
@@ -470,6 +476,8 @@ public:
 	std::list<Vehicle *> loading_vehicles;
 	GoodsEntry goods[NUM_CARGO];  ///< Goods at this station
 	CargoTypes always_accepted;       ///< Bitmask of always accepted cargo types (by houses, HQs, industry tiles when industry doesn't accept cargo)
+	CargoArray cached_acceptance;     ///< NOSAVE: Acceptance of the catchment when it was last computed, see UpdateStationAcceptance()
+	uint64_t cached_acceptance_generation = 0; ///< NOSAVE: Acceptance generation #cached_acceptance is valid for, or 0 if it has to be recomputed
 
 	IndustryList industries_near; ///< Cached list of industries near the station that can accept cargo, @see DeliverGoodsToIndustry()
 	Industry *industry;           ///< NOSAVE: Associated industry for neutral stations. (Rebuilt on load from Industry->st)
@@ -490,6 +498,7 @@ public:
 	uint GetPlatformLength(TileIndex tile, DiagDirection dir) const override;
 	uint GetPlatformLength(TileIndex tile) const override;
 	void RecomputeCatchment(bool no_clear_nearby_lists = false);
+	void UpdateCatchment();
 	static void RecomputeCatchmentForAll();
 
 	uint GetCatchmentRadius() const;
@@ -556,6 +565,16 @@ public:
 
 void RebuildStationKdtree();
 
+/**
+ * Scope within which catchment updates of stations are collected and applied once at its end,
+ * so a command changing many tiles of a station updates its catchment only once.
+ * Catchments of the affected stations are out of date until the scope ends.
+ */
+struct StationCatchmentBatch {
+	StationCatchmentBatch();
+	~StationCatchmentBatch();
+};
+
 /**
  * Call a function on all stations that have any part of the requested area within their catchment.
  * @tparam Func The type of funcion to call
@@ -597,19 +597,108 @@ CargoArray GetAcceptanceAroundTiles(TileIndex center_tile, int w, int h, int rad
 	return acceptance;
 }
 
+/** Number of bits of the size of an acceptance chunk along each axis, 4 = 16 x 16 tiles. */
+static const uint ACCEPTANCE_CHUNK_BITS = 4;
+
+static std::vector<uint64_t> _acceptance_chunk_generation; ///< Generation of the last acceptance change of each chunk.
+static uint64_t _acceptance_generation = 0;                ///< Generation of the last acceptance change anywhere.
+static uint64_t _acceptance_reset_generation = 0;          ///< Generation of the last acceptance change of all tiles.
+
+/**
+ * Size the acceptance chunks for the current map.
+ * Acceptance cached before is invalid afterwards.
+ */
+void AllocateAcceptanceChunks()
+{
+	_acceptance_chunk_generation.assign(static_cast<size_t>(Map::SizeX() >> ACCEPTANCE_CHUNK_BITS) * (Map::SizeY() >> ACCEPTANCE_CHUNK_BITS), 0);
+	InvalidateAllAcceptanceChunks();
+}
+
+/**
+ * Note that the acceptance of some tiles might have changed, e.g. because
+ * houses were built or removed. Stations with one of these tiles in their
+ * catchment recompute their acceptance the next time it is updated.
+ * @param area The tiles that changed.
+ */
+void InvalidateAcceptanceChunks(const TileArea &area)
+{
+	if (area.w == 0 || area.h == 0) return;
+
+	uint64_t generation = ++_acceptance_generation;
+	uint chunks_x = Map::SizeX() >> ACCEPTANCE_CHUNK_BITS;
+	for (uint y = TileY(area.tile) >> ACCEPTANCE_CHUNK_BITS; y <= (TileY(area.tile) + area.h - 1) >> ACCEPTANCE_CHUNK_BITS; y++) {
+		for (uint x = TileX(area.tile) >> ACCEPTANCE_CHUNK_BITS; x <= (TileX(area.tile) + area.w - 1) >> ACCEPTANCE_CHUNK_BITS; x++) {
+			_acceptance_chunk_generation[y * chunks_x + x] = generation;
+		}
+	}
+}
+
+/** Note that the acceptance of all tiles might have changed, e.g. because NewGRFs were reloaded. */
+void InvalidateAllAcceptanceChunks()
+{
+	_acceptance_reset_generation = ++_acceptance_generation;
+}
+
+/**
+ * Check whether the acceptance of an area might have changed since a given generation.
+ * @param area The area to check.
+ * @param generation The generation the acceptance was known at.
+ * @return True if any of the acceptance chunks of the area changed since then.
+ */
+static bool HasAcceptanceChanged(const TileArea &area, uint64_t generation)
+{
+	if (generation < _acceptance_reset_generation) return true;
+	if (area.w == 0 || area.h == 0) return false;
+
+	uint chunks_x = Map::SizeX() >> ACCEPTANCE_CHUNK_BITS;
+	for (uint y = TileY(area.tile) >> ACCEPTANCE_CHUNK_BITS; y <= (TileY(area.tile) + area.h - 1) >> ACCEPTANCE_CHUNK_BITS; y++) {
+		for (uint x = TileX(area.tile) >> ACCEPTANCE_CHUNK_BITS; x <= (TileX(area.tile) + area.w - 1) >> ACCEPTANCE_CHUNK_BITS; x++) {
+			if (_acceptance_chunk_generation[y * chunks_x + x] > generation) return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Check whether the acceptance of a tile only depends on the map, so it can
+ * only change when the tile itself changes. Houses with acceptance callbacks
+ * and industries depend on other state, and the acceptance of stations
+ * that cover them is always recomputed.
+ * @param tile The tile to check.
+ * @return True iff the acceptance of the tile is static.
+ */
+static bool HasStaticAcceptance(TileIndex tile)
+{
+	switch (GetTileType(tile)) {
+		case MP_HOUSE: {
+			const HouseSpec *hs = HouseSpec::Get(GetHouseType(tile));
+			return !HasBit(hs->callback_mask, CBM_HOUSE_ACCEPT_CARGO) && !HasBit(hs->callback_mask, CBM_HOUSE_CARGO_ACCEPTANCE);
+		}
+
+		case MP_INDUSTRY:
+			return false;
+
+		default:
+			return true;
+	}
+}
+
 /**
  * Get the acceptance of cargoes around the station in.
  * @param st Station to get acceptance of.
  * @param always_accepted bitmask of cargo accepted by houses and headquarters; can be nullptr
+ * @param[out] is_static Whether the acceptance of all tiles only depends on the map; can be nullptr
  */
-static CargoArray GetAcceptanceAroundStation(const Station *st, CargoTypes *always_accepted)
+static CargoArray GetAcceptanceAroundStation(const Station *st, CargoTypes *always_accepted, bool *is_static = nullptr)
 {
 	CargoArray acceptance{};
 	if (always_accepted != nullptr) *always_accepted = 0;
+	if (is_static != nullptr) *is_static = true;
 
 	BitmapTileIterator it(st->catchment_tiles);
 	for (TileIndex tile = it; tile != INVALID_TILE; tile = ++it) {
 		AddAcceptedCargo(tile, acceptance, always_accepted);
+		if (is_static != nullptr && *is_static) *is_static = HasStaticAcceptance(tile);
 	}
 
 	return acceptance;
@@ -625,10 +714,18 @@ void UpdateStationAcceptance(Station *st, bool show_msg)
 	/* old accepted goods types */
 	CargoTypes old_acc = GetAcceptanceMask(st);
 
-	/* And retrieve the acceptance. */
+	/* And retrieve the acceptance. When no tile in the catchment changed since
+	 * the last time, and all of them have static acceptance, reuse that. */
 	CargoArray acceptance{};
-	if (!st->rect.IsEmpty()) {
-		acceptance = GetAcceptanceAroundStation(st, &st->always_accepted);
+	if (st->rect.IsEmpty()) {
+		st->cached_acceptance_generation = 0;
+	} else if (st->cached_acceptance_generation != 0 && !HasAcceptanceChanged(st->catchment_tiles, st->cached_acceptance_generation)) {
+		acceptance = st->cached_acceptance;
+	} else {
+		bool is_static;
+		acceptance = GetAcceptanceAroundStation(st, &st->always_accepted, &is_static);
+		st->cached_acceptance = acceptance;
+		st->cached_acceptance_generation = is_static ? _acceptance_generation : 0;
 	}
 
 	/* Adjust in case our station only accepts fewer kinds of goods */
@@ -754,7 +851,7 @@ void Station::AfterStationTileSetChange(bool adding, StationType type)
 	DirtyCompanyInfrastructureWindows(this->owner);
 
 	if (adding) {
-		this->RecomputeCatchment();
+		this->UpdateCatchment();
 		MarkCatchmentTilesDirty();
 		InvalidateWindowData(WC_STATION_LIST, this->owner, 0);
 	} else {
@@ -782,7 +879,7 @@ void Station::AfterStationTileSetChange(bool adding, StationType type)
 		InvalidateWindowData(WC_SELECT_STATION, 0, 0);
 	} else {
 		DeleteStationIfEmpty(this);
-		this->RecomputeCatchment();
+		this->UpdateCatchment();
 	}
 
 	citymania::OnStationTileSetChange(this, adding, type);
@@ -1737,7 +1834,7 @@ CommandCost CmdRemoveFromRailStation(DoCommandFlag flags, TileIndex start, TileI
 		if (st->train_station.tile == INVALID_TILE) SetWindowWidgetDirty(WC_STATION_VIEW, st->index, WID_SV_TRAINS);
 		st->MarkTilesDirty(false);
 		MarkCatchmentTilesDirty();
-		st->RecomputeCatchment();
+		st->UpdateCatchment();
 	}
 
 	/* Now apply the rail cost to the number that we deleted */
@@ -1818,7 +1915,7 @@ static CommandCost RemoveRailStation(TileIndex tile, DoCommandFlag flags)
 	Station *st = Station::GetByTile(tile);
 	CommandCost cost = RemoveRailStation(st, flags, _price[PR_CLEAR_STATION_RAIL]);
 
-	if (flags & DC_EXEC) st->RecomputeCatchment();
+	if (flags & DC_EXEC) st->UpdateCatchment();
 
 	return cost;
 }
@@ -2236,6 +2333,9 @@ CommandCost CmdRemoveRoadStop(DoCommandFlag flags, TileIndex tile, uint8_t width
 	CommandCost last_error(STR_ERROR_THERE_IS_NO_STATION);
 	bool had_success = false;
 
+	/* Update the catchment of each station once after all stops are removed. */
+	StationCatchmentBatch catchment_batch;
+
 	for (TileIndex cur_tile : roadstop_area) {
 		/* Make sure the specified tile is a road stop of the correct type */
 		if (!IsTileType(cur_tile, MP_STATION) || !IsRoadStop(cur_tile) || GetRoadStopType(cur_tile) != stop_type) continue;
@@ -3634,6 +3734,60 @@ static void TruncateCargo(const CargoSpec *cs, GoodsEntry *ge, uint amount = UIN
 	}
 }
 
+/** Inputs and results of the rating formula for the cargos of a station, one array per field. */
+struct StationRatingInputs {
+	uint count;                                   ///< Number of rated cargos.
+	std::array<CargoID, NUM_CARGO> cargo;         ///< Cargo of each entry.
+	std::array<bool, NUM_CARGO> truncate;         ///< The cargo lost its rating and all its waiting cargo is removed.
+	std::array<int32_t, NUM_CARGO> base;          ///< Rating from the cheat or the NewGRF callback, otherwise 0.
+	std::array<int32_t, NUM_CARGO> use_formula;   ///< 1 if the speed, waiting time and waiting cargo ratings apply, otherwise 0.
+	std::array<int32_t, NUM_CARGO> last_speed;    ///< Speed of the last vehicle that picked up the cargo.
+	std::array<int32_t, NUM_CARGO> waittime;      ///< Time since the last pickup, shortened for ships.
+	std::array<uint32_t, NUM_CARGO> max_waiting;  ///< Maximum waiting cargo since the last rating update.
+	std::array<int32_t, NUM_CARGO> age;           ///< Age of the last vehicle that picked up the cargo.
+	std::array<int32_t, NUM_CARGO> old_rating;    ///< Rating before this update.
+	std::array<int32_t, NUM_CARGO> rating;        ///< Rating after this update.
+	std::array<uint, NUM_CARGO> waiting;          ///< Available waiting cargo.
+	std::array<uint, NUM_CARGO> num_dests;        ///< Number of next hops of the waiting cargo.
+};
+
+/**
+ * Compute the new ratings of all cargos of a station at once. The formula
+ * has no branches, so the compiler can use SIMD instructions for it.
+ * @param in The inputs; the ratings are written to it.
+ * @param statue_bonus Bonus for a company statue in the town.
+ */
+static void ComputeStationRatings(StationRatingInputs &in, int32_t statue_bonus)
+{
+	for (uint i = 0; i < in.count; i++) {
+		int32_t waittime = in.waittime[i];
+		uint32_t max_waiting = in.max_waiting[i];
+		int32_t age = in.age[i];
+
+		int32_t formula = (std::max(in.last_speed[i] - 85, 0) >> 2)
+				+ (waittime <= 21) * 25 + (waittime <= 12) * 25 + (waittime <= 6) * 45 + (waittime <= 3) * 35
+				- 90
+				+ (max_waiting <= 1500) * 55 + (max_waiting <= 1000) * 35 + (max_waiting <= 600) * 10 + (max_waiting <= 300) * 20 + (max_waiting <= 100) * 10;
+
+		int32_t rating = in.base[i] + formula * in.use_formula[i] + statue_bonus
+				+ (age < 3) * 10 + (age < 2) * 10 + (age < 1) * 13;
+
+		/* only modify rating in steps of -2, -1, 0, 1 or 2 */
+		int32_t old_rating = in.old_rating[i];
+		in.rating[i] = old_rating + std::clamp(std::clamp(rating, 0, 255) - old_rating, -2, 2);
+	}
+}
+
+/**
+ * Update the cargo ratings of a station.
+ * This is done in three passes over the cargos. The first collects the
+ * inputs of the rating formula, including the results of NewGRF callbacks.
+ * The second computes all ratings at once. The third, in cargo order, stores
+ * the ratings and removes waiting cargo; only this pass draws random numbers
+ * or truncates cargo, and the passes do not influence the other cargos of
+ * the station, so the result is the same as rating one cargo after another.
+ * @param st The station to update.
+ */
 static void UpdateStationRating(Station *st)
 {
 	bool waiting_changed = false;
@@ -3641,6 +3795,9 @@ static void UpdateStationRating(Station *st)
 	byte_inc_sat(&st->time_since_load);
 	byte_inc_sat(&st->time_since_unload);
 
+	static StationRatingInputs in;
+	in.count = 0;
+
 	for (const CargoSpec *cs : CargoSpec::Iterate()) {
 		GoodsEntry *ge = &st->goods[cs->Index()];
 		/* Slowly increase the rating back to its original level in the case we
@@ -3651,138 +3808,144 @@ static void UpdateStationRating(Station *st)
 		}
 
 		/* Only change the rating if we are moving this cargo */
-		if (ge->HasRating()) {
-			byte_inc_sat(&ge->time_since_pickup);
-			if (ge->time_since_pickup == 255 && _settings_game.order.selectgoods) {
-				ClrBit(ge->status, GoodsEntry::GES_RATING);
-				ge->last_speed = 0;
-				TruncateCargo(cs, ge);
-				waiting_changed = true;
-				continue;
-			}
+		if (!ge->HasRating()) continue;
+
+		uint i = in.count++;
+		in.cargo[i] = cs->Index();
+
+		byte_inc_sat(&ge->time_since_pickup);
+		in.truncate[i] = ge->time_since_pickup == 255 && _settings_game.order.selectgoods;
+		if (in.truncate[i]) {
+			ClrBit(ge->status, GoodsEntry::GES_RATING);
+			ge->last_speed = 0;
+			in.base[i] = 0;
+			in.use_formula[i] = 0;
+			in.last_speed[i] = 0;
+			in.waittime[i] = 0;
+			in.max_waiting[i] = 0;
+			in.age[i] = 0;
+			in.old_rating[i] = 0;
+			continue;
+		}
 
-			bool skip = false;
-			int rating = 0;
-			uint waiting = ge->cargo.AvailableCount();
-
-			/* num_dests is at least 1 if there is any cargo as
-			 * INVALID_STATION is also a destination.
-			 */
-			uint num_dests = (uint)ge->cargo.Packets()->MapSize();
-
-			/* Average amount of cargo per next hop, but prefer solitary stations
-			 * with only one or two next hops. They are allowed to have more
-			 * cargo waiting per next hop.
-			 * With manual cargo distribution waiting_avg = waiting / 2 as then
-			 * INVALID_STATION is the only destination.
-			 */
-			uint waiting_avg = waiting / (num_dests + 1);
-
-			if (_cheats.station_rating.value) {
-				ge->rating = rating = MAX_STATION_RATING;
-				skip = true;
-			} else if (HasBit(cs->callback_mask, CBM_CARGO_STATION_RATING_CALC)) {
-				/* Perform custom station rating. If it succeeds the speed, days in transit and
-				 * waiting cargo ratings must not be executed. */
-
-				/* NewGRFs expect last speed to be 0xFF when no vehicle has arrived yet. */
-				uint last_speed = ge->HasVehicleEverTriedLoading() ? ge->last_speed : 0xFF;
-
-				uint32_t var18 = ClampTo<uint8_t>(ge->time_since_pickup)
-					| (ClampTo<uint16_t>(ge->max_waiting_cargo) << 8)
-					| (ClampTo<uint8_t>(last_speed) << 24);
-				/* Convert to the 'old' vehicle types */
-				uint32_t var10 = (st->last_vehicle_type == VEH_INVALID) ? 0x0 : (st->last_vehicle_type + 0x10);
-				uint16_t callback = GetCargoCallback(CBID_CARGO_STATION_RATING_CALC, var10, var18, cs);
-				if (callback != CALLBACK_FAILED) {
-					skip = true;
-					rating = GB(callback, 0, 14);
-
-					/* Simulate a 15 bit signed value */
-					if (HasBit(callback, 14)) rating -= 0x4000;
-				}
-			}
+		in.base[i] = 0;
+		in.use_formula[i] = 1;
+		in.waiting[i] = ge->cargo.AvailableCount();
 
-			if (!skip) {
-				int b = ge->last_speed - 85;
-				if (b >= 0) rating += b >> 2;
-
-				byte waittime = ge->time_since_pickup;
-				if (st->last_vehicle_type == VEH_SHIP) waittime >>= 2;
-				if (waittime <= 21) rating += 25;
-				if (waittime <= 12) rating += 25;
-				if (waittime <= 6) rating += 45;
-				if (waittime <= 3) rating += 35;
-
-				rating -= 90;
-				if (ge->max_waiting_cargo <= 1500) rating += 55;
-				if (ge->max_waiting_cargo <= 1000) rating += 35;
-				if (ge->max_waiting_cargo <= 600) rating += 10;
-				if (ge->max_waiting_cargo <= 300) rating += 20;
-				if (ge->max_waiting_cargo <= 100) rating += 10;
+		/* num_dests is at least 1 if there is any cargo as
+		 * INVALID_STATION is also a destination.
+		 */
+		in.num_dests[i] = (uint)ge->cargo.Packets()->MapSize();
+
+		if (_cheats.station_rating.value) {
+			ge->rating = MAX_STATION_RATING;
+			in.base[i] = MAX_STATION_RATING;
+			in.use_formula[i] = 0;
+		} else if (HasBit(cs->callback_mask, CBM_CARGO_STATION_RATING_CALC)) {
+			/* Perform custom station rating. If it succeeds the speed, days in transit and
+			 * waiting cargo ratings must not be executed. */
+
+			/* NewGRFs expect last speed to be 0xFF when no vehicle has arrived yet. */
+			uint last_speed = ge->HasVehicleEverTriedLoading() ? ge->last_speed : 0xFF;
+
+			uint32_t var18 = ClampTo<uint8_t>(ge->time_since_pickup)
+				| (ClampTo<uint16_t>(ge->max_waiting_cargo) << 8)
+				| (ClampTo<uint8_t>(last_speed) << 24);
+			/* Convert to the 'old' vehicle types */
+			uint32_t var10 = (st->last_vehicle_type == VEH_INVALID) ? 0x0 : (st->last_vehicle_type + 0x10);
+			uint16_t callback = GetCargoCallback(CBID_CARGO_STATION_RATING_CALC, var10, var18, cs);
+			if (callback != CALLBACK_FAILED) {
+				in.base[i] = GB(callback, 0, 14);
+				in.use_formula[i] = 0;
+
+				/* Simulate a 15 bit signed value */
+				if (HasBit(callback, 14)) in.base[i] -= 0x4000;
 			}
+		}
 
-			if (Company::IsValidID(st->owner) && HasBit(st->town->statues, st->owner)) rating += 26;
-
-			byte age = ge->last_age;
-			if (age < 3) rating += 10;
-			if (age < 2) rating += 10;
-			if (age < 1) rating += 13;
+		byte waittime = ge->time_since_pickup;
+		if (st->last_vehicle_type == VEH_SHIP) waittime >>= 2;
 
-			{
-				int or_ = ge->rating; // old rating
+		in.last_speed[i] = ge->last_speed;
+		in.waittime[i] = waittime;
+		in.max_waiting[i] = ge->max_waiting_cargo;
+		in.age[i] = ge->last_age;
+		in.old_rating[i] = ge->rating;
+	}
 
-				/* only modify rating in steps of -2, -1, 0, 1 or 2 */
-				ge->rating = rating = or_ + Clamp(ClampTo<uint8_t>(rating) - or_, -2, 2);
+	int32_t statue_bonus = (Company::IsValidID(st->owner) && HasBit(st->town->statues, st->owner)) ? 26 : 0;
+	ComputeStationRatings(in, statue_bonus);
 
-				/* if rating is <= 64 and more than 100 items waiting on average per destination,
-				 * remove some random amount of goods from the station */
-				if (rating <= 64 && waiting_avg >= 100) {
-					int dec = Random() & 0x1F;
-					if (waiting_avg < 200) dec &= 7;
-					waiting -= (dec + 1) * num_dests;
-					waiting_changed = true;
-				}
+	for (uint i = 0; i < in.count; i++) {
+		const CargoSpec *cs = CargoSpec::Get(in.cargo[i]);
+		GoodsEntry *ge = &st->goods[in.cargo[i]];
 
-				/* if rating is <= 127 and there are any items waiting, maybe remove some goods. */
-				if (rating <= 127 && waiting != 0) {
-					uint32_t r = Random();
-					if (rating <= (int)GB(r, 0, 7)) {
-						/* Need to have int, otherwise it will just overflow etc. */
-						waiting = std::max((int)waiting - (int)((GB(r, 8, 2) - 1) * num_dests), 0);
-						waiting_changed = true;
-					}
-				}
+		if (in.truncate[i]) {
+			TruncateCargo(cs, ge);
+			waiting_changed = true;
+			continue;
+		}
 
-				/* At some point we really must cap the cargo. Previously this
-				 * was a strict 4095, but now we'll have a less strict, but
-				 * increasingly aggressive truncation of the amount of cargo. */
-				static const uint WAITING_CARGO_THRESHOLD  = 1 << 12;
-				static const uint WAITING_CARGO_CUT_FACTOR = 1 <<  6;
-				static const uint MAX_WAITING_CARGO        = 1 << 15;
+		int rating = in.rating[i];
+		ge->rating = rating;
 
-				if (waiting > WAITING_CARGO_THRESHOLD) {
-					uint difference = waiting - WAITING_CARGO_THRESHOLD;
-					waiting -= (difference / WAITING_CARGO_CUT_FACTOR);
+		uint waiting = in.waiting[i];
+		uint num_dests = in.num_dests[i];
 
-					waiting = std::min(waiting, MAX_WAITING_CARGO);
-					waiting_changed = true;
-				}
+		/* Average amount of cargo per next hop, but prefer solitary stations
+		 * with only one or two next hops. They are allowed to have more
+		 * cargo waiting per next hop.
+		 * With manual cargo distribution waiting_avg = waiting / 2 as then
+		 * INVALID_STATION is the only destination.
+		 */
+		uint waiting_avg = waiting / (num_dests + 1);
+
+		/* if rating is <= 64 and more than 100 items waiting on average per destination,
+		 * remove some random amount of goods from the station */
+		if (rating <= 64 && waiting_avg >= 100) {
+			int dec = Random() & 0x1F;
+			if (waiting_avg < 200) dec &= 7;
+			waiting -= (dec + 1) * num_dests;
+			waiting_changed = true;
+		}
 
-				/* We can't truncate cargo that's already reserved for loading.
-				 * Thus StoredCount() here. */
-				if (waiting_changed && waiting < ge->cargo.AvailableCount()) {
-					/* Feed back the exact own waiting cargo at this station for the
-					 * next rating calculation. */
-					ge->max_waiting_cargo = 0;
-
-					TruncateCargo(cs, ge, ge->cargo.AvailableCount() - waiting);
-				} else {
-					/* If the average number per next hop is low, be more forgiving. */
-					ge->max_waiting_cargo = waiting_avg;
-				}
+		/* if rating is <= 127 and there are any items waiting, maybe remove some goods. */
+		if (rating <= 127 && waiting != 0) {
+			uint32_t r = Random();
+			if (rating <= (int)GB(r, 0, 7)) {
+				/* Need to have int, otherwise it will just overflow etc. */
+				waiting = std::max((int)waiting - (int)((GB(r, 8, 2) - 1) * num_dests), 0);
+				waiting_changed = true;
 			}
 		}
+
+		/* At some point we really must cap the cargo. Previously this
+		 * was a strict 4095, but now we'll have a less strict, but
+		 * increasingly aggressive truncation of the amount of cargo. */
+		static const uint WAITING_CARGO_THRESHOLD  = 1 << 12;
+		static const uint WAITING_CARGO_CUT_FACTOR = 1 <<  6;
+		static const uint MAX_WAITING_CARGO        = 1 << 15;
+
+		if (waiting > WAITING_CARGO_THRESHOLD) {
+			uint difference = waiting - WAITING_CARGO_THRESHOLD;
+			waiting -= (difference / WAITING_CARGO_CUT_FACTOR);
+
+			waiting = std::min(waiting, MAX_WAITING_CARGO);
+			waiting_changed = true;
+		}
+
+		/* We can't truncate cargo that's already reserved for loading.
+		 * Thus StoredCount() here. */
+		if (waiting_changed && waiting < ge->cargo.AvailableCount()) {
+			/* Feed back the exact own waiting cargo at this station for the
+			 * next rating calculation. */
+			ge->max_waiting_cargo = 0;
+
+			TruncateCargo(cs, ge, ge->cargo.AvailableCount() - waiting);
+		} else {
+			/* If the average number per next hop is low, be more forgiving. */
+			ge->max_waiting_cargo = waiting_avg;
+		}
 	}
 
 	StationID index = st->index;
@@ -3896,12 +4059,14 @@ void DeleteStaleLinks(Station *from)
 				edge.Restrict();
 				ge.flows.RestrictFlows(to->index);
 				RerouteCargo(from, c, to->index, from->index);
+				lg->MarkStructureChanged();
 			} else if (edge.last_restricted_update != EconomyTime::INVALID_DATE && TimerGameEconomy::date - edge.last_restricted_update > timeout) {
 				edge.Release();
 			}
 		}
 		/* Remove dead edges. */
 		for (NodeID r : to_remove) (*lg)[ge.node].RemoveEdge(r);
+		if (!to_remove.empty()) lg->MarkStructureChanged();
 
 		assert(TimerGameEconomy::date >= lg->LastCompression());
 		if (TimerGameEconomy::date - lg->LastCompression() > LinkGraph::COMPRESSION_INTERVAL) {
@@ -4947,4 +5112,6 @@ extern const TileTypeProcs _tile_type_station_procs = {
 	VehicleEnter_Station,       // vehicle_enter_tile_proc
 	GetFoundation_Station,      // get_foundation_proc
 	TerraformTile_Station,      // terraform_tile_proc
+	nullptr,                    // tile_loop_plan_proc
+	nullptr,                    // tile_loop_apply_proc
 };
@@ -0,0 +1,78 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file parallel_for.cpp Test functionality of ParallelFor from thread.h. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../thread.h"
+
+#include "../safeguards.h"
+
+/**
+ * Run ParallelFor and count how often every index is visited.
+ * @param count Number of indices.
+ * @param min_per_thread Minimum number of indices per thread.
+ * @return True iff every index was visited exactly once.
+ */
+static bool VisitsEveryIndexOnce(size_t count, size_t min_per_thread)
+{
+	std::vector<std::atomic<uint>> visits(count);
+	ParallelFor(count, min_per_thread, [&](size_t i) { visits[i]++; });
+	return std::all_of(visits.begin(), visits.end(), [](const std::atomic<uint> &v) { return v == 1; });
+}
+
+TEST_CASE("ParallelFor - Visits every index once")
+{
+	CHECK(VisitsEveryIndexOnce(0, 1));
+	CHECK(VisitsEveryIndexOnce(1, 1));
+	CHECK(VisitsEveryIndexOnce(7, 1));
+	CHECK(VisitsEveryIndexOnce(1000, 1));
+	CHECK(VisitsEveryIndexOnce(1000, 64));
+	CHECK(VisitsEveryIndexOnce(100003, 16));
+}
+
+TEST_CASE("ParallelFor - Result does not depend on scheduling")
+{
+	std::vector<uint64_t> serial(5000);
+	for (size_t i = 0; i < serial.size(); i++) serial[i] = i * i + 7;
+
+	for (int run = 0; run < 10; run++) {
+		std::vector<uint64_t> parallel(serial.size());
+		ParallelFor(parallel.size(), 1, [&](size_t i) { parallel[i] = i * i + 7; });
+		CHECK(parallel == serial);
+	}
+}
+
+TEST_CASE("ParallelFor - Nested calls")
+{
+	static const size_t OUTER = 64;
+	static const size_t INNER = 100;
+
+	std::vector<std::atomic<uint>> visits(OUTER * INNER);
+	ParallelFor(OUTER, 1, [&](size_t i) {
+		ParallelFor(INNER, 1, [&](size_t j) { visits[i * INNER + j]++; });
+	});
+	CHECK(std::all_of(visits.begin(), visits.end(), [](const std::atomic<uint> &v) { return v == 1; }));
+}
+
+TEST_CASE("ParallelFor - Calls from several threads")
+{
+	std::atomic<uint> failures = 0;
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; t++) {
+		threads.emplace_back([&failures]() {
+			for (int run = 0; run < 20; run++) {
+				if (!VisitsEveryIndexOnce(2000, 1)) failures++;
+			}
+		});
+	}
+	for (std::thread &thread : threads) thread.join();
+	CHECK(failures == 0);
+}
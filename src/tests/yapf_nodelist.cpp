@@ -0,0 +1,90 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file yapf_nodelist.cpp Test the open node order of the YAPF node list. */
+
+#include "../stdafx.h"
+
+#include "../3rdparty/catch2/catch.hpp"
+
+#include "../pathfinder/yapf/nodelist.hpp"
+
+#include "../safeguards.h"
+
+/** Minimal node, ordered by its estimate like the YAPF nodes. */
+struct TestNode {
+	struct Key {
+		int id;
+
+		inline int CalcHash() const { return this->id; }
+		inline bool operator==(const Key &other) const { return this->id == other.id; }
+	};
+
+	Key key;
+	int estimate;
+	TestNode *hash_next;
+
+	inline const Key &GetKey() const { return this->key; }
+	inline TestNode *GetHashNext() { return this->hash_next; }
+	inline void SetHashNext(TestNode *next) { this->hash_next = next; }
+	inline bool operator<(const TestNode &other) const { return this->estimate < other.estimate; }
+};
+
+using TestNodeList = CNodeList_HashTableT<TestNode, 4, 4>;
+
+/**
+ * Add a new open node.
+ * @param nodes The node list.
+ * @param id Key of the node.
+ * @param estimate Cost estimate of the node.
+ */
+static void AddOpenNode(TestNodeList &nodes, int id, int estimate)
+{
+	TestNode &node = *nodes.CreateNewNode();
+	node = {{id}, estimate, nullptr};
+	nodes.InsertOpenNode(node);
+}
+
+/**
+ * Pop all open nodes.
+ * @param nodes The node list.
+ * @return The keys of the nodes in the order they were popped.
+ */
+static std::vector<int> PopAll(TestNodeList &nodes)
+{
+	std::vector<int> order;
+	for (TestNode *node = nodes.PopBestOpenNode(); node != nullptr; node = nodes.PopBestOpenNode()) {
+		order.push_back(node->key.id);
+	}
+	return order;
+}
+
+/*
+ * Path searches must explore the nodes in the same order on all clients, also
+ * when several open nodes have the same estimate. The orders below are the
+ * ones of the original implementation and must not change.
+ */
+
+TEST_CASE("CNodeList_HashTableT - Equal estimates are popped in a fixed order")
+{
+	TestNodeList nodes;
+	for (int id = 0; id < 10; id++) AddOpenNode(nodes, id, 100);
+	CHECK(PopAll(nodes) == std::vector<int>{0, 9, 8, 7, 6, 5, 4, 3, 2, 1});
+}
+
+TEST_CASE("CNodeList_HashTableT - Improved node is popped in a fixed order")
+{
+	TestNodeList nodes;
+	for (int id = 0; id < 10; id++) AddOpenNode(nodes, id, id < 5 ? 100 : 200);
+
+	/* Same as CYapfBaseT::AddNewNode() when it finds a cheaper path to an open node. */
+	TestNode &node = nodes.PopOpenNode({7});
+	node.estimate = 100;
+	nodes.InsertOpenNode(node);
+
+	CHECK(PopAll(nodes) == std::vector<int>{0, 7, 1, 3, 4, 2, 9, 8, 5, 6});
+}
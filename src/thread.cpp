@@ -0,0 +1,141 @@
+/*
+ * This file is part of OpenTTD.
+ * OpenTTD is free software; you can redistribute it and/or modify it under the terms of the GNU General Public License as published by the Free Software Foundation, version 2.
+ * OpenTTD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details. You should have received a copy of the GNU General Public License along with OpenTTD. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/** @file thread.cpp Pool of worker threads for ParallelFor(). */
+
+#include "stdafx.h"
+#include "thread.h"
+#include <condition_variable>
+
+#include "safeguards.h"
+
+/** Persistent worker threads running the jobs of ParallelFor(). */
+class ParallelForPool {
+public:
+	static constexpr size_t MAX_THREADS = 16; ///< Maximum number of threads working on a job, including the calling thread.
+
+	ParallelForPool()
+	{
+		size_t threads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), MAX_THREADS);
+		for (size_t i = 1; i < threads; i++) {
+			std::thread thread;
+			/* If a thread can't be started the pool simply has fewer workers. */
+			if (!StartNewThread(&thread, "ottd:worker", [this]() { this->WorkerLoop(); })) break;
+			this->threads.push_back(std::move(thread));
+		}
+	}
+
+	~ParallelForPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->exit = true;
+		}
+		this->work_cv.notify_all();
+		for (std::thread &thread : this->threads) thread.join();
+	}
+
+	/**
+	 * Get the pool, starting its threads on first use.
+	 * @return The pool.
+	 */
+	static ParallelForPool &Get()
+	{
+		static ParallelForPool pool;
+		return pool;
+	}
+
+	/**
+	 * Get the number of worker threads of the pool.
+	 * @return The number of workers.
+	 */
+	size_t GetWorkerCount() const
+	{
+		return this->threads.size();
+	}
+
+	/**
+	 * Process all indices of a job, with the help of the workers if they are not busy.
+	 * @param job The job to run.
+	 */
+	void Run(ParallelForJob &job)
+	{
+		bool busy = false;
+		if (!this->busy.compare_exchange_strong(busy, true)) {
+			/* Another job occupies the workers, e.g. a nested call or a call from another thread. */
+			job.Work();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->job = &job;
+			this->generation++;
+		}
+		for (size_t i = 0; i < std::min(job.max_workers, this->threads.size()); i++) this->work_cv.notify_one();
+
+		job.Work();
+
+		/* Stop further workers from joining and wait for the ones still processing their last chunk. */
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->job = nullptr;
+			this->done_cv.wait(lock, [this]() { return this->joined == 0; });
+		}
+		this->busy = false;
+	}
+
+private:
+	std::vector<std::thread> threads; ///< The worker threads.
+	std::atomic<bool> busy = false;   ///< Whether a job is running, so jobs don't share the workers.
+	std::mutex mutex;                 ///< Protects the members below.
+	std::condition_variable work_cv;  ///< Signalled when a job is posted or the pool shuts down.
+	std::condition_variable done_cv;  ///< Signalled when the last worker leaves a job.
+	ParallelForJob *job = nullptr;    ///< Job workers may join, if any.
+	uint64_t generation = 0;          ///< Number of jobs posted so far.
+	size_t joined = 0;                ///< Number of workers processing #job.
+	bool exit = false;                ///< Whether the workers have to stop.
+
+	/** Main loop of a worker thread. */
+	void WorkerLoop()
+	{
+		uint64_t seen = 0;
+		std::unique_lock<std::mutex> lock(this->mutex);
+		for (;;) {
+			this->work_cv.wait(lock, [this, &seen]() { return this->exit || (this->job != nullptr && this->generation != seen); });
+			if (this->exit) return;
+
+			seen = this->generation;
+			ParallelForJob *job = this->job;
+			if (this->joined >= job->max_workers) continue;
+
+			this->joined++;
+			lock.unlock();
+			job->Work();
+			lock.lock();
+			if (--this->joined == 0) this->done_cv.notify_all();
+		}
+	}
+};
+
+/**
+ * Get the number of worker threads available to ParallelFor(), besides the calling thread.
+ * @return The number of workers.
+ */
+size_t GetParallelForWorkerCount()
+{
+	return ParallelForPool::Get().GetWorkerCount();
+}
+
+/**
+ * Process all indices of a job of ParallelFor().
+ * @param job The job to run.
+ */
+void RunParallelForJob(ParallelForJob &job)
+{
+	ParallelForPool::Get().Run(job);
+}
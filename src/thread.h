@@ -15,6 +15,8 @@
 #include <system_error>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <vector>
 
 /**
  * Sleep on the current thread for a defined time.
@@ -82,4 +84,61 @@ inline bool StartNewThread(std::thread *thr, const char *name, TFn&& _Fx, TArgs&
 	return false;
 }
 
+/** Range of indices shared by the threads taking part in one ParallelFor() call. */
+struct ParallelForJob {
+	size_t count;       ///< Number of indices.
+	size_t chunk;       ///< Number of consecutive indices claimed at once.
+	size_t max_workers; ///< Maximum number of pool workers taking part, besides the calling thread.
+	std::atomic<size_t> next = 0; ///< First index that has not been claimed yet.
+	void (*run)(void *fn, size_t begin, size_t end); ///< Call the function for the indices [begin, end).
+	void *fn;           ///< The function passed to ParallelFor().
+
+	/** Claim chunks of indices and process them until none are left. */
+	void Work()
+	{
+		for (size_t begin = this->next.fetch_add(this->chunk, std::memory_order_relaxed); begin < this->count; begin = this->next.fetch_add(this->chunk, std::memory_order_relaxed)) {
+			this->run(this->fn, begin, std::min(begin + this->chunk, this->count));
+		}
+	}
+};
+
+size_t GetParallelForWorkerCount();
+void RunParallelForJob(ParallelForJob &job);
+
+/**
+ * Call a function for every index in [0, count), spread over a pool of persistent
+ * worker threads. The calling thread does part of the work itself and the call only
+ * returns when all indices have been processed. Indices are claimed in chunks.
+ * Which thread handles which index is not deterministic, so the function must only
+ * write to state owned by its index; the result is then independent of the number
+ * of threads. When the pool is busy with another call, e.g. for nested calls or
+ * calls from other threads, all indices are processed on the calling thread.
+ * @tparam TFn Type of the function, called as \c fn(index).
+ * @param count Number of indices.
+ * @param min_per_thread Minimum number of indices that makes involving another thread worthwhile.
+ * @param fn The function to call.
+ */
+template <class TFn>
+inline void ParallelFor(size_t count, size_t min_per_thread, TFn &&fn)
+{
+	size_t threads = std::min(GetParallelForWorkerCount() + 1, count / std::max<size_t>(1, min_per_thread));
+	if (threads <= 1) {
+		for (size_t i = 0; i < count; i++) fn(i);
+		return;
+	}
+
+	using Fn = std::remove_reference_t<TFn>;
+	ParallelForJob job;
+	job.count = count;
+	/* A few chunks per thread even out indices of unequal cost without claiming every index separately. */
+	job.chunk = std::max<size_t>(1, count / (threads * 4));
+	job.max_workers = threads - 1;
+	job.fn = const_cast<void *>(static_cast<const void *>(std::addressof(fn)));
+	job.run = [](void *fn, size_t begin, size_t end) {
+		Fn &f = *static_cast<Fn *>(fn);
+		for (size_t i = begin; i < end; i++) f(i);
+	};
+	RunParallelForJob(job);
+}
+
 #endif /* THREAD_H */
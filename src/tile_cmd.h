@@ -129,6 +129,30 @@ typedef void AddProducedCargoProc(TileIndex tile, CargoArray &produced);
 typedef bool ClickTileProc(TileIndex tile);
 typedef void AnimateTileProc(TileIndex tile);
 typedef void TileLoopProc(TileIndex tile);
+
+/** Plan of #TileLoopPlanProc telling to simply run the #TileLoopProc of the tile. */
+static const uint8_t TILE_LOOP_RUN = 0;
+
+/**
+ * Tile callback function signature for planning the periodic tile loop without changing anything.
+ *
+ * Plans of a whole tick are made at the same time on several threads, before any tile loop runs,
+ * so the function may only read the map and must neither draw random numbers nor touch other state.
+ * Tiles whose tile loop would draw random numbers, or depends on or changes other tiles in ways
+ * the plan cannot verify, have to return #TILE_LOOP_RUN.
+ * @param tile Tile to plan the tile loop for.
+ * @return #TILE_LOOP_RUN or a tile type specific plan for the #TileLoopApplyProc.
+ */
+typedef uint8_t TileLoopPlanProc(TileIndex tile);
+
+/**
+ * Tile callback function signature for carrying out a plan of the #TileLoopPlanProc.
+ * It is called in the place of the #TileLoopProc, and only when the tile itself has not changed since the plan was made.
+ * @param tile Tile to run the tile loop for.
+ * @param plan Plan returned by the #TileLoopPlanProc, never #TILE_LOOP_RUN.
+ */
+typedef void TileLoopApplyProc(TileIndex tile, uint8_t plan);
+
 typedef void ChangeTileOwnerProc(TileIndex tile, Owner old_owner, Owner new_owner);
 
 /** @see VehicleEnterTileStatus to see what the return values mean */
@@ -171,6 +195,8 @@ struct TileTypeProcs {
 	VehicleEnterTileProc *vehicle_enter_tile_proc; ///< Called when a vehicle enters a tile
 	GetFoundationProc *get_foundation_proc;
 	TerraformTileProc *terraform_tile_proc;        ///< Called when a terraforming operation is about to take place
+	TileLoopPlanProc *tile_loop_plan_proc;         ///< Plans the tile loop without changing anything, may be nullptr
+	TileLoopApplyProc *tile_loop_apply_proc;       ///< Carries out a plan of tile_loop_plan_proc
 };
 
 extern const TileTypeProcs * const _tile_type_procs[16];
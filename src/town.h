@@ -126,7 +126,10 @@ struct Town : TownPool::PoolItem<&_town_pool> {
 
 	uint16_t time_until_rebuild;       ///< time until we rebuild a house
 
-	uint16_t grow_counter;             ///< counter to count when to grow, value is smaller than or equal to growth_rate
+	uint16_t grow_counter;             ///< counter to count when to grow, value is smaller than or equal to growth_rate; only up to date while the town is not growing, use GetGrowCounter()
+	uint64_t grow_tick = 0;            ///< NOSAVE: town tick of the next growth while the town is growing, 0 otherwise
+	std::vector<TileIndex> growth_frontier; ///< road tiles next to free land to grow from, see EconomySettings::town_growth_frontier
+	bool growth_frontier_dirty = true;      ///< whether growth_frontier has to be rebuilt before it is used next
 	uint16_t growth_rate;              ///< town growth rate
 
 	byte fund_buildings_months;      ///< fund buildings program in action?
@@ -152,6 +155,9 @@ struct Town : TownPool::PoolItem<&_town_pool> {
 
 	void InitializeLayout(TownLayout layout);
 
+	uint16_t GetGrowCounter() const;
+	void SetGrowCounter(uint16_t counter);
+
 	void UpdateLabel();
 
 	/* Returns the correct town label, based on rating. */
@@ -222,6 +228,8 @@ void ShowTownViewWindow(TownID town);
 void ExpandTown(Town *t);
 
 void RebuildTownKdtree();
+void RebuildTownGrowthSchedule();
+void ScheduleTownRegularActions(const Town *t);
 
 /** Settings for town council attitudes. */
 enum TownCouncilAttitudes {
@@ -20,6 +20,7 @@
 #include "station_base.h"
 #include "waypoint_base.h"
 #include "station_kdtree.h"
+#include "station_func.h"
 #include "company_base.h"
 #include "news_func.h"
 #include "error.h"
@@ -65,6 +66,9 @@
 #include "citymania/cm_highlight.hpp"
 #include "citymania/cm_main.hpp"
 
+#include <queue>
+#include <set>
+
 #include "safeguards.h"
 
 bool _cb_enabled = false;
@@ -932,27 +936,27 @@ bool TownNeedsFunding(Town *t) {
 		if (!is_growing)
 			return false;
 
-		if (do_powerfund && t->grow_counter > 2 * Ticks::TOWN_GROWTH_TICKS)
+		if (do_powerfund && t->GetGrowCounter() > 2 * Ticks::TOWN_GROWTH_TICKS)
 			return true;
 
 		return (fund_regularly &&
 		        t->fund_buildings_months == 0 && (
 			     	t->growth_rate <= 2 * Ticks::TOWN_GROWTH_TICKS ||
-                	t->grow_counter > 2 * Ticks::TOWN_GROWTH_TICKS
+                	t->GetGrowCounter() > 2 * Ticks::TOWN_GROWTH_TICKS
                 ));
 	}
 
 	if (!is_growing)
 		return true;
 
-	if (do_powerfund && t->grow_counter > 2 * Ticks::TOWN_GROWTH_TICKS)
+	if (do_powerfund && t->GetGrowCounter() > 2 * Ticks::TOWN_GROWTH_TICKS)
 		return true;
 
 	return (fund_regularly &&
 	        t->fund_buildings_months == 0 &&
 		    t->growth_rate >= Ticks::TOWN_GROWTH_TICKS && (
 		    	t->growth_rate <= 2 * Ticks::TOWN_GROWTH_TICKS ||
-            	t->grow_counter > 2 * Ticks::TOWN_GROWTH_TICKS
+            	t->GetGrowCounter() > 2 * Ticks::TOWN_GROWTH_TICKS
             ));
 }
 
@@ -1018,35 +1022,156 @@ static void DoRegularAdvertising(Town *t) {
 }
 
 /**
- * Handle the town tick for a single town, by growing the town if desired.
+ * Number of the current town tick. Growing towns count their grow counter
+ * down once every town tick, which is represented by the town tick of
+ * their next growth instead. It starts at 1, so 0 can mean "not growing".
+ */
+static uint64_t _town_tick = 1;
+
+/** Entry of the town growth schedule: the town tick of the growth and the town to grow. */
+using TownGrowthEntry = std::pair<uint64_t, TownID>;
+
+/**
+ * Growing towns ordered by their next growth, and by index for towns that
+ * grow on the same tick. Entries are not removed when a town is rescheduled,
+ * entries that do not match Town::grow_tick anymore are skipped instead.
+ */
+static std::priority_queue<TownGrowthEntry, std::vector<TownGrowthEntry>, std::greater<TownGrowthEntry>> _town_growth_schedule;
+
+/** Towns that might regularly fund buildings or advertise for some company. */
+static std::set<TownID> _town_regular_actions;
+
+/**
+ * Schedule the next growth of a town.
+ * @param t The town to schedule.
+ * @param tick The town tick to grow the town at.
+ */
+static void ScheduleTownGrowth(Town *t, uint64_t tick)
+{
+	t->grow_tick = tick;
+	_town_growth_schedule.emplace(tick, t->index);
+}
+
+/**
+ * Get the number of ticks until the town grows next.
+ * @return The grow counter.
+ */
+uint16_t Town::GetGrowCounter() const
+{
+	if (this->grow_tick == 0) return this->grow_counter;
+	return static_cast<uint16_t>(this->grow_tick - _town_tick);
+}
+
+/**
+ * Set the number of ticks until the town grows next.
+ * @param counter The new grow counter.
+ */
+void Town::SetGrowCounter(uint16_t counter)
+{
+	this->grow_counter = counter;
+	if (this->grow_tick != 0) ScheduleTownGrowth(this, _town_tick + counter);
+}
+
+/**
+ * Let a town count down its grow counter, and grow when it runs out.
+ * @param t The town to start growing.
+ */
+static void StartTownGrowth(Town *t)
+{
+	SetBit(t->flags, TOWN_IS_GROWING);
+	if (t->grow_tick == 0) ScheduleTownGrowth(t, _town_tick + t->grow_counter);
+}
+
+/**
+ * Stop counting down the grow counter of a town.
+ * @param t The town to stop growing.
+ */
+static void StopTownGrowth(Town *t)
+{
+	t->grow_counter = t->GetGrowCounter();
+	t->grow_tick = 0;
+	ClrBit(t->flags, TOWN_IS_GROWING);
+}
+
+/**
+ * Schedule all growing towns from their grow counter, e.g. after loading a game.
+ */
+void RebuildTownGrowthSchedule()
+{
+	_town_growth_schedule = {};
+	_town_regular_actions.clear();
+
+	for (Town *t : Town::Iterate()) {
+		t->grow_counter = t->GetGrowCounter();
+		t->grow_tick = 0;
+		if (HasBit(t->flags, TOWN_IS_GROWING)) ScheduleTownGrowth(t, _town_tick + t->grow_counter);
+		ScheduleTownRegularActions(t);
+	}
+}
+
+/**
+ * Make sure the regular funding and advertising of a town is handled every tick.
+ * @param t The town the regular actions were enabled for.
+ */
+void ScheduleTownRegularActions(const Town *t)
+{
+	if (t->fund_regularly != 0 || t->do_powerfund != 0 || t->advertise_regularly != 0) _town_regular_actions.insert(t->index);
+}
+
+/**
+ * Handle the town tick of a town whose grow counter ran out, by growing the town.
  * @param t The town to try growing.
  */
 static void TownTickHandler(Town *t)
 {
-	if (HasBit(t->flags, TOWN_IS_GROWING)) {
-		int i = (int)t->grow_counter - 1;
-		if (i < 0) {
-			if (GrowTown(t)) {
-				i = t->growth_rate;
-			} else {
-				/* If growth failed wait a bit before retrying */
-				i = std::min<uint16_t>(t->growth_rate, Ticks::TOWN_GROWTH_TICKS - 1);
-			}
-		}
-		t->grow_counter = i;
+	uint16_t counter;
+	if (GrowTown(t)) {
+		counter = t->growth_rate;
+	} else {
+		/* If growth failed wait a bit before retrying */
+		counter = std::min<uint16_t>(t->growth_rate, Ticks::TOWN_GROWTH_TICKS - 1);
 	}
-	DoRegularFunding(t);
-	DoRegularAdvertising(t);
+	t->grow_counter = counter;
+	if (HasBit(t->flags, TOWN_IS_GROWING)) ScheduleTownGrowth(t, _town_tick + 1 + counter);
 }
 
-/** Iterate through all towns and call their tick handler. */
+/**
+ * Grow the towns whose grow counter runs out this tick, in order of their
+ * index, and handle the regular actions of the local company.
+ */
 void OnTick_Town()
 {
 	if (_game_mode == GM_EDITOR) return;
 
-	for (Town *t : Town::Iterate()) {
+	while (!_town_growth_schedule.empty() && _town_growth_schedule.top().first <= _town_tick) {
+		auto [tick, index] = _town_growth_schedule.top();
+		_town_growth_schedule.pop();
+
+		Town *t = Town::GetIfValid(index);
+		if (t == nullptr || t->grow_tick != tick) continue;
 		TownTickHandler(t);
 	}
+	_town_tick++;
+
+	/* Rescheduled towns leave stale entries behind; drop them when they dominate. */
+	if (_town_growth_schedule.size() > 4 * Town::GetNumItems() + 64) {
+		std::vector<TownGrowthEntry> entries;
+		for (const Town *t : Town::Iterate()) {
+			if (t->grow_tick != 0) entries.emplace_back(t->grow_tick, t->index);
+		}
+		_town_growth_schedule = decltype(_town_growth_schedule)(std::greater<TownGrowthEntry>(), std::move(entries));
+	}
+
+	for (auto it = _town_regular_actions.begin(); it != _town_regular_actions.end(); /* nothing */) {
+		Town *t = Town::GetIfValid(*it);
+		if (t == nullptr || (t->fund_regularly == 0 && t->do_powerfund == 0 && t->advertise_regularly == 0)) {
+			it = _town_regular_actions.erase(it);
+			continue;
+		}
+		++it;
+		DoRegularFunding(t);
+		DoRegularAdvertising(t);
+	}
 }
 
 /**
@@ -1860,9 +1985,10 @@ static bool CanFollowRoad(TileIndex tile, DiagDirection dir)
  * Try to grow a town at a given road tile.
  * @param t The town to grow.
  * @param tile The road tile to try growing from.
+ * @param search_steps Number of times to search, or -1 to base it on the size of the town.
  * @return true if we successfully expanded the town.
  */
-static bool GrowTownAtRoad(Town *t, TileIndex tile)
+static bool GrowTownAtRoad(Town *t, TileIndex tile, int search_steps = -1)
 {
 	/* Special case.
 	 * @see GrowTownInTile Check the else if
@@ -1874,19 +2000,23 @@ static bool GrowTownAtRoad(Town *t, TileIndex tile)
 	/* Number of times to search.
 	 * Better roads, 2X2 and 3X3 grid grow quite fast so we give
 	 * them a little handicap. */
-	switch (t->layout) {
-		case TL_BETTER_ROADS:
-			_grow_town_result = 10 + t->cache.num_houses * 2 / 9;
-			break;
+	if (search_steps >= 0) {
+		_grow_town_result = search_steps;
+	} else {
+		switch (t->layout) {
+			case TL_BETTER_ROADS:
+				_grow_town_result = 10 + t->cache.num_houses * 2 / 9;
+				break;
 
-		case TL_3X3_GRID:
-		case TL_2X2_GRID:
-			_grow_town_result = 10 + t->cache.num_houses * 1 / 9;
-			break;
+			case TL_3X3_GRID:
+			case TL_2X2_GRID:
+				_grow_town_result = 10 + t->cache.num_houses * 1 / 9;
+				break;
 
-		default:
-			_grow_town_result = 10 + t->cache.num_houses * 4 / 9;
-			break;
+			default:
+				_grow_town_result = 10 + t->cache.num_houses * 4 / 9;
+				break;
+		}
 	}
 
 	uint16_t prev_houses = t->cache.num_houses;
@@ -1949,6 +2079,77 @@ static bool GrowTownAtRoad(Town *t, TileIndex tile)
 	return false;
 }
 
+/** Number of road tiles to walk when growing from a tile of the growth frontier. */
+static const int TOWN_GROWTH_FRONTIER_STEPS = 4;
+/** Number of tiles of the growth frontier to try for one growth of a town. */
+static const uint TOWN_GROWTH_FRONTIER_ATTEMPTS = 4;
+
+/**
+ * Check whether a town might grow from a road tile, i.e. whether the road
+ * belongs to the town and there is free land next to it to build a house
+ * or to extend the road on.
+ * @param t The town to grow.
+ * @param tile The road tile to check.
+ * @return true iff the tile belongs to the growth frontier of the town.
+ */
+static bool IsTownGrowthFrontierTile(const Town *t, TileIndex tile)
+{
+	if (!IsTileType(tile, MP_ROAD) || GetTownRoadBits(tile) == ROAD_NONE) return false;
+	if (GetTownIndex(tile) != t->index) return false;
+
+	for (DiagDirection dir = DIAGDIR_BEGIN; dir < DIAGDIR_END; dir++) {
+		TileIndex neighbour = TileAddByDiagDir(tile, dir);
+		if (IsTileType(neighbour, MP_CLEAR) || IsTileType(neighbour, MP_TREES)) return true;
+	}
+	return false;
+}
+
+/**
+ * Collect the road tiles within the zone of a town that it might grow from.
+ * @param t The town to rebuild the growth frontier of.
+ */
+static void RebuildTownGrowthFrontier(Town *t)
+{
+	t->growth_frontier.clear();
+	t->growth_frontier_dirty = false;
+
+	uint radius = IntSqrt(t->cache.squared_town_zone_radius[HZB_TOWN_EDGE]) + 1;
+	for (TileIndex tile : TileArea(t->xy, 1, 1).Expand(radius)) {
+		if (IsTownGrowthFrontierTile(t, tile)) t->growth_frontier.push_back(tile);
+	}
+}
+
+/**
+ * Grow a town from random tiles of its growth frontier. Tiles that turn out
+ * to be unable to grow are dropped until the frontier is rebuilt.
+ * @param t The town to grow.
+ * @return true if we successfully expanded the town.
+ */
+static bool GrowTownAtFrontier(Town *t)
+{
+	std::vector<TileIndex> &frontier = t->growth_frontier;
+
+	for (uint attempt = 0; attempt < TOWN_GROWTH_FRONTIER_ATTEMPTS && !frontier.empty(); attempt++) {
+		size_t i = RandomRange(static_cast<uint32_t>(frontier.size()));
+		TileIndex tile = frontier[i];
+
+		if (IsTownGrowthFrontierTile(t, tile)) {
+			uint16_t prev_houses = t->cache.num_houses;
+			if (GrowTownAtRoad(t, tile, TOWN_GROWTH_FRONTIER_STEPS)) {
+				/* A new road might border land that is not in the frontier yet. */
+				if (t->cache.num_houses == prev_houses) t->growth_frontier_dirty = true;
+				return true;
+			}
+		}
+
+		frontier[i] = frontier.back();
+		frontier.pop_back();
+	}
+
+	if (frontier.empty()) t->growth_frontier_dirty = true;
+	return false;
+}
+
 /**
  * Generate a random road block.
  * The probability of a straight road
@@ -1993,6 +2194,15 @@ static bool GrowTown(Town *t)
 
 	TileIndex tile = t->xy; // The tile we are working with ATM
 
+	if (_settings_game.economy.town_growth_frontier) {
+		if (t->growth_frontier_dirty) RebuildTownGrowthFrontier(t);
+		if (!t->growth_frontier.empty()) {
+			bool success = GrowTownAtFrontier(t);
+			cur_company.Restore();
+			return success;
+		}
+	}
+
 	/* Find a road that we can base the construction on. */
 	const TileIndexDiffC *ptr;
 	for (ptr = _town_coord_mod; ptr != endof(_town_coord_mod); ++ptr) {
@@ -2740,7 +2950,9 @@ static void MakeTownHouse(TileIndex tile, Town *t, byte counter, byte stage, Hou
 	if (size & BUILDING_2_TILES_X)   ClearMakeHouseTile(tile + TileDiffXY(1, 0), t, counter, stage, ++type, random_bits);
 	if (size & BUILDING_HAS_4_TILES) ClearMakeHouseTile(tile + TileDiffXY(1, 1), t, counter, stage, ++type, random_bits);
 
-	ForAllStationsAroundTiles(TileArea(tile, (size & BUILDING_2_TILES_X) ? 2 : 1, (size & BUILDING_2_TILES_Y) ? 2 : 1), [t](Station *st, TileIndex) {
+	TileArea ta(tile, (size & BUILDING_2_TILES_X) ? 2 : 1, (size & BUILDING_2_TILES_Y) ? 2 : 1);
+	InvalidateAcceptanceChunks(ta);
+	ForAllStationsAroundTiles(ta, [t](Station *st, TileIndex) {
 		t->stations_near.insert(st);
 		return true;
 	});
@@ -3171,6 +3383,8 @@ void ClearTownHouse(Town *t, TileIndex tile)
 	if (hs->building_flags & BUILDING_2_TILES_X)   DoClearTownHouseHelper(tile + TileDiffXY(1, 0), t, ++house);
 	if (hs->building_flags & BUILDING_HAS_4_TILES) DoClearTownHouseHelper(tile + TileDiffXY(1, 1), t, ++house);
 
+	InvalidateAcceptanceChunks(TileArea(tile, (hs->building_flags & BUILDING_2_TILES_X) ? 2 : 1, (hs->building_flags & BUILDING_2_TILES_Y) ? 2 : 1));
+	t->growth_frontier_dirty = true;
 	RemoveNearbyStations(t, tile, hs->building_flags);
 
 	UpdateTownRadius(t);
@@ -3300,12 +3514,12 @@ CommandCost CmdTownGrowthRate(DoCommandFlag flags, TownID town_id, uint16_t grow
 			ClrBit(t->flags, TOWN_CUSTOM_GROWTH);
 		} else {
 			uint old_rate = t->growth_rate;
-			if (t->grow_counter >= old_rate) {
+			if (t->GetGrowCounter() >= old_rate) {
 				/* This also catches old_rate == 0 */
-				t->grow_counter = growth_rate;
+				t->SetGrowCounter(growth_rate);
 			} else {
 				/* Scale grow_counter, so half finished houses stay half finished */
-				t->grow_counter = t->grow_counter * growth_rate / old_rate;
+				t->SetGrowCounter(t->GetGrowCounter() * growth_rate / old_rate);
 			}
 			t->growth_rate = growth_rate;
 			SetBit(t->flags, TOWN_CUSTOM_GROWTH);
@@ -3673,7 +3887,8 @@ static CommandCost TownActionFundBuildings(Town *t, DoCommandFlag flags)
 		 * tick-perfect and gives player some time window where they can
 		 * spam funding with the exact same efficiency.
 		 */
-		t->grow_counter = std::min<uint16_t>(t->grow_counter, 2 * Ticks::TOWN_GROWTH_TICKS - (t->growth_rate - t->grow_counter) % Ticks::TOWN_GROWTH_TICKS);
+		uint16_t grow_counter = t->GetGrowCounter();
+		t->SetGrowCounter(std::min<uint16_t>(grow_counter, 2 * Ticks::TOWN_GROWTH_TICKS - (t->growth_rate - grow_counter) % Ticks::TOWN_GROWTH_TICKS));
 
 		SetWindowDirty(WC_TOWN_VIEW, t->index);
 		SetWindowDirty(CM_WC_CB_TOWN, t->index);
@@ -3905,10 +4120,10 @@ static void UpdateTownGrowCounter(Town *t, uint16_t prev_growth_rate)
 {
 	if (t->growth_rate == TOWN_GROWTH_RATE_NONE) return;
 	if (prev_growth_rate == TOWN_GROWTH_RATE_NONE) {
-		t->grow_counter = std::min<uint16_t>(t->growth_rate, t->grow_counter);
+		t->SetGrowCounter(std::min<uint16_t>(t->growth_rate, t->GetGrowCounter()));
 		return;
 	}
-	t->grow_counter = RoundDivSU((uint32_t)t->grow_counter * (t->growth_rate + 1), prev_growth_rate + 1);
+	t->SetGrowCounter(RoundDivSU((uint32_t)t->GetGrowCounter() * (t->growth_rate + 1), prev_growth_rate + 1));
 }
 
 /**
@@ -3977,7 +4192,7 @@ static void UpdateTownGrowth(Town *t)
 {
 	UpdateTownGrowthRate(t);
 
-	ClrBit(t->flags, TOWN_IS_GROWING);
+	StopTownGrowth(t);
 	SetWindowDirty(WC_TOWN_VIEW, t->index);
 	SetWindowDirty(CM_WC_CB_TOWN, t->index);
 	t->cm.growing_by_chance = false;
@@ -4002,7 +4217,7 @@ static void UpdateTownGrowth(Town *t)
 	}
 
 	if (HasBit(t->flags, TOWN_CUSTOM_GROWTH)) {
-		if (t->growth_rate != TOWN_GROWTH_RATE_NONE) SetBit(t->flags, TOWN_IS_GROWING);
+		if (t->growth_rate != TOWN_GROWTH_RATE_NONE) StartTownGrowth(t);
 		SetWindowDirty(WC_TOWN_VIEW, t->index);
 		SetWindowDirty(CM_WC_CB_TOWN, t->index);
 		return;
@@ -4013,7 +4228,7 @@ static void UpdateTownGrowth(Town *t)
 		t->cm.growing_by_chance = true;
 	}
 
-	SetBit(t->flags, TOWN_IS_GROWING);
+	StartTownGrowth(t);
 	SetWindowDirty(WC_TOWN_VIEW, t->index);
 	SetWindowDirty(CM_WC_CB_TOWN, t->index);
 }
@@ -4237,6 +4452,9 @@ static IntervalTimer<TimerGameEconomy> _economy_towns_monthly({TimerGameEconomy:
 		UpdateTownGrowth(t);
 		UpdateTownRating(t);
 
+		/* Pick up roads and land that changed without the town noticing. */
+		t->growth_frontier_dirty = true;
+
 		/* CityMania code start */
 		if (CB_Enabled() && !t->larger_town) CB_UpdateTownStorage(t); //CB
 		DoRegularFunding(t); // TODO shouldn't that be on tick / day base?
@@ -4300,6 +4518,8 @@ extern const TileTypeProcs _tile_type_town_procs = {
 	nullptr,                    // vehicle_enter_tile_proc
 	GetFoundation_Town,      // get_foundation_proc
 	TerraformTile_Town,      // terraform_tile_proc
+	nullptr,                 // tile_loop_plan_proc
+	nullptr,                 // tile_loop_apply_proc
 };
 
 
@@ -1452,7 +1452,7 @@ static void DrawExtraTownInfo (Rect &r, Town *town, uint line, bool show_house_s
 	SetDParam(0, town->growth_rate);
 	SetDParam(1, HasBit(town->flags, TOWN_CUSTOM_GROWTH) ? CM_STR_TOWN_VIEW_GROWTH_RATE_CUSTOM : STR_EMPTY);
 	// SetDParam(2, town->grow_counter < 16000 ? TownTicksToDays(town->grow_counter + 1) : -1);
-	SetDParam(2, town->grow_counter);
+	SetDParam(2, town->GetGrowCounter());
 	SetDParam(3, town->time_until_rebuild);
 	SetDParam(4, HasBit(town->flags, TOWN_IS_GROWING) ? 1 : 0);
 	SetDParam(5, town->fund_buildings_months);
@@ -1528,11 +1528,13 @@ public:
 				break;
 			case WID_CB_FUND_REGULAR:
 				ToggleBit(this->town->fund_regularly, _local_company);
+				ScheduleTownRegularActions(this->town);
 				this->SetWidgetLoweredState(widget, HasBit(this->town->fund_regularly, _local_company));
 				this->SetWidgetDirty(widget);
 				break;
 			case WID_CB_POWERFUND:
 				ToggleBit(this->town->do_powerfund, _local_company);
+				ScheduleTownRegularActions(this->town);
 				this->SetWidgetLoweredState(widget, HasBit(this->town->do_powerfund, _local_company));
 				this->SetWidgetDirty(widget);
 				break;
@@ -1556,6 +1558,7 @@ public:
 	{
 		if (str != NULL) SetBit(this->town->advertise_regularly, _local_company);
 		else ClrBit(this->town->advertise_regularly, _local_company);
+		ScheduleTownRegularActions(this->town);
 		this->town->ad_ref_goods_entry = NULL;
 		this->SetWidgetLoweredState(WID_CB_ADVERT_REGULAR, HasBit(this->town->advertise_regularly, _local_company));
 		this->SetWidgetDirty(WID_CB_ADVERT_REGULAR);
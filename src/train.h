@@ -60,6 +60,8 @@ void CheckTrainsLengths();
 
 void FreeTrainTrackReservation(const Train *v);
 bool TryPathReserve(Train *v, bool mark_as_stuck = false, bool first_tile_okay = false);
+void PrepareTrainPathBatch();
+void FinishTrainPathBatch();
 
 int GetTrainStopLocation(StationID station_id, TileIndex tile, const Train *v, int *station_ahead, int *station_length);
 
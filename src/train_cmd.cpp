@@ -2485,10 +2485,20 @@ static Track DoTrainPathfind(const Train *v, TileIndex tile, DiagDirection enter
 /**
  * Extend a train path as far as possible. Stops on encountering a safe tile,
  * another reservation or a track choice.
+ * @param v The train.
+ * @param[out] new_tracks Tracks of the choice tile, if a choice was found.
+ * @param[out] enterdir Direction the choice tile is entered from, if a choice was found.
+ * @param[out] dry_run_end If not nullptr, nothing is reserved; tracks are only checked for existing reservations.
+ *                         When a choice is found, the last tile the reservation would have been extended to is stored here.
  * @return INVALID_TILE indicates that the reservation failed.
  */
-static PBSTileInfo ExtendTrainReservation(const Train *v, TrackBits *new_tracks, DiagDirection *enterdir)
+static PBSTileInfo ExtendTrainReservation(const Train *v, TrackBits *new_tracks, DiagDirection *enterdir, PBSTileInfo *dry_run_end = nullptr)
 {
+	const bool dry_run = dry_run_end != nullptr;
+	auto try_reserve = [dry_run](TileIndex tile, Track track) {
+		return dry_run ? !HasReservedTracks(tile, TrackToTrackBits(track)) : TryReserveRailTrack(tile, track);
+	};
+
 	PBSTileInfo origin = FollowTrainReservation(v);
 
 	CFollowTrackRail ft(v);
@@ -2524,6 +2534,7 @@ static PBSTileInfo ExtendTrainReservation(const Train *v, TrackBits *new_tracks,
 			/* Choice found, path valid but not okay. Save info about the choice tile as well. */
 			if (new_tracks != nullptr) *new_tracks = TrackdirBitsToTrackBits(ft.m_new_td_bits);
 			if (enterdir != nullptr) *enterdir = ft.m_exitdir;
+			if (dry_run) *dry_run_end = PBSTileInfo(tile, cur_td, false);
 			return PBSTileInfo(ft.m_new_tile, ft.m_old_td, false);
 		}
 
@@ -2532,12 +2543,12 @@ static PBSTileInfo ExtendTrainReservation(const Train *v, TrackBits *new_tracks,
 
 		if (IsSafeWaitingPosition(v, tile, cur_td, true, _settings_game.pf.forbid_90_deg)) {
 			bool wp_free = IsWaitingPositionFree(v, tile, cur_td, _settings_game.pf.forbid_90_deg);
-			if (!(wp_free && TryReserveRailTrack(tile, TrackdirToTrack(cur_td)))) break;
+			if (!(wp_free && try_reserve(tile, TrackdirToTrack(cur_td)))) break;
 			/* Safe position is all good, path valid and okay. */
 			return PBSTileInfo(tile, cur_td, true);
 		}
 
-		if (!TryReserveRailTrack(tile, TrackdirToTrack(cur_td))) break;
+		if (!try_reserve(tile, TrackdirToTrack(cur_td))) break;
 	}
 
 	if (ft.m_err == CFollowTrackRail::EC_OWNER || ft.m_err == CFollowTrackRail::EC_NO_WAY) {
@@ -2546,6 +2557,7 @@ static PBSTileInfo ExtendTrainReservation(const Train *v, TrackBits *new_tracks,
 	}
 
 	/* Sorry, can't reserve path, back out. */
+	if (dry_run) return PBSTileInfo();
 	tile = origin.tile;
 	cur_td = origin.trackdir;
 	TileIndex stopped = ft.m_old_tile;
@@ -2924,6 +2936,68 @@ bool TryPathReserve(Train *v, bool mark_as_stuck, bool first_tile_okay)
 }
 
 
+/**
+ * Predict where the pathfinder search of a stuck train's next TryPathReserve() starts,
+ * without changing anything. This follows the checks of TryPathReserve() and does a
+ * dry run of ExtendTrainReservation(). A wrong guess merely means the train searches
+ * again in its own tick.
+ * @param v The train.
+ * @param[out] origin The last tile of the reservation when the pathfinder is called.
+ * @return True if the retry is expected to call the pathfinder.
+ */
+static bool PredictPathReserveOrigin(const Train *v, PBSTileInfo *origin)
+{
+	Vehicle *other_train = nullptr;
+	PBSTileInfo res = FollowTrainReservation(v, &other_train);
+	if (other_train != nullptr && other_train->index != v->index) return false;
+	if (res.okay && v->tile != res.tile) return false;
+
+	DiagDirection exitdir = TrackdirToExitdir(res.trackdir);
+	TileIndex new_tile = TileAddByDiagDir(res.tile, exitdir);
+	if ((GetReservedTrackbits(new_tile) & DiagdirReachesTracks(exitdir)) != TRACK_BIT_NONE) return false;
+
+	/* Only a choice that is not a safe end of the reservation asks the pathfinder. */
+	PBSTileInfo dest = ExtendTrainReservation(v, nullptr, nullptr, origin);
+	return dest.tile != INVALID_TILE && !dest.okay;
+}
+
+/**
+ * Search the paths of all trains that are going to retry their path reservation in
+ * this tick in one parallel batch, when enabled. Trains are ticked in index order,
+ * so each of them picks up its path and reserves it in that order.
+ * @see YapfTrainPrefetchPaths
+ */
+void PrepareTrainPathBatch()
+{
+	if (!_settings_game.pf.yapf.rail_batched_pathfinding || _settings_game.pf.pathfinder_for_trains != VPF_YAPF) return;
+
+	static std::vector<std::pair<const Train *, PBSTileInfo>> requests;
+	requests.clear();
+
+	for (const Train *v : Train::Iterate()) {
+		if (!v->IsFrontEngine() || !HasBit(v->flags, VRF_TRAIN_STUCK)) continue;
+		if ((v->vehstatus & VS_CRASHED) || ((v->vehstatus & VS_STOPPED) && v->cur_speed == 0)) continue;
+		if (v->force_proceed != TFP_NONE || v->breakdown_ctr == 1 || v->track == TRACK_BIT_DEPOT) continue;
+		if (v->current_order.IsType(OT_LOADING)) continue;
+
+		/* Same condition as for retrying in TrainLocoHandler(), which increments the wait counter first. */
+		uint wait_counter = v->wait_counter + 1;
+		bool turn_around = wait_counter % (_settings_game.pf.wait_for_pbs_path * Ticks::DAY_TICKS) == 0 && _settings_game.pf.reverse_at_signals;
+		if (!turn_around && wait_counter % _settings_game.pf.path_backoff_interval != 0) continue;
+
+		PBSTileInfo origin;
+		if (PredictPathReserveOrigin(v, &origin)) requests.emplace_back(v, origin);
+	}
+
+	if (!requests.empty()) YapfTrainPrefetchPaths(requests);
+}
+
+/** Drop the paths of PrepareTrainPathBatch() that have not been used during the vehicle ticks. */
+void FinishTrainPathBatch()
+{
+	YapfTrainClearPrefetchedPaths();
+}
+
 static bool CheckReverseTrain(const Train *v)
 {
 	if (_settings_game.difficulty.line_reverse_mode != 0 ||
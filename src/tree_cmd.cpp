@@ -815,6 +815,68 @@ static void TileLoop_Trees(TileIndex tile)
 	MarkTileDirtyByTile(tile);
 }
 
+/** Plans of TileLoopPlan_Trees; the growth plans can be combined. */
+enum TreesTileLoopPlan : uint8_t {
+	TTLP_NOTHING = 1 << 0, ///< Nothing changes.
+	TTLP_DENSITY = 1 << 1, ///< The grass under the trees grows denser.
+	TTLP_GROWTH  = 1 << 2, ///< The trees grow.
+};
+
+/**
+ * Plan the tile loop of a tree tile. Only the growth of grass and young trees
+ * is planned. Shores, ground changes in the desert and snow, and the random
+ * spreading and dying of full grown trees run the tile loop as usual.
+ * @param tile The tile to plan for.
+ * @return The plan.
+ */
+static uint8_t TileLoopPlan_Trees(TileIndex tile)
+{
+	if (GetTreeGround(tile) == TREE_GROUND_SHORE || HasGrfMiscBit(GMB_AMBIENT_SOUND_CALLBACK)) return TILE_LOOP_RUN;
+
+	switch (_settings_game.game_creation.landscape) {
+		case LT_TROPIC:
+			if (GetTropicZone(tile) != TROPICZONE_NORMAL) return TILE_LOOP_RUN;
+			break;
+
+		case LT_ARCTIC:
+			if (GetTreeGround(tile) == TREE_GROUND_SNOW_DESERT || GetTreeGround(tile) == TREE_GROUND_ROUGH_SNOW) return TILE_LOOP_RUN;
+			if (GetTileZ(tile) - GetSnowLine() + 1 >= 0) return TILE_LOOP_RUN;
+			break;
+	}
+
+	/* Same cycle as in TileLoop_Trees. */
+	uint32_t cycle = 11 * TileX(tile) + 9 * TileY(tile) + (TimerGameTick::counter >> 8);
+	uint8_t plan = TTLP_NOTHING;
+
+	if ((cycle & 7) == 7 && GetTreeGround(tile) == TREE_GROUND_GRASS && GetTreeDensity(tile) < 3) plan |= TTLP_DENSITY;
+
+	if (_settings_game.construction.extra_tree_placement == ETP_NO_GROWTH_NO_SPREAD) return plan;
+	if ((cycle & 15) != 15) return plan;
+
+	switch (GetTreeGrowth(tile)) {
+		case 3:
+		case 6:
+			return TILE_LOOP_RUN;
+
+		default:
+			return plan | TTLP_GROWTH;
+	}
+}
+
+/**
+ * Carry out a plan of TileLoopPlan_Trees, like TileLoop_Trees would have done.
+ * @param tile The tile to change.
+ * @param plan The plan.
+ */
+static void TileLoopApply_Trees(TileIndex tile, uint8_t plan)
+{
+	if (plan == TTLP_NOTHING) return;
+
+	if (plan & TTLP_DENSITY) SetTreeGroundDensity(tile, TREE_GROUND_GRASS, GetTreeDensity(tile) + 1);
+	if (plan & TTLP_GROWTH) AddTreeGrowth(tile, 1);
+	MarkTileDirtyByTile(tile);
+}
+
 /**
  * Decrement the tree tick counter.
  * The interval is scaled by map size to allow for the same density regardless of size.
@@ -904,4 +966,6 @@ extern const TileTypeProcs _tile_type_trees_procs = {
 	nullptr,                     // vehicle_enter_tile_proc
 	GetFoundation_Trees,      // get_foundation_proc
 	TerraformTile_Trees,      // terraform_tile_proc
+	TileLoopPlan_Trees,       // tile_loop_plan_proc
+	TileLoopApply_Trees,      // tile_loop_apply_proc
 };
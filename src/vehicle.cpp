@@ -372,34 +372,98 @@ Vehicle::Vehicle(VehicleType type)
 	this->last_loading_station = INVALID_STATION;
 }
 
-/* Size of the hash, 6 = 64 x 64, 7 = 128 x 128. Larger sizes will (in theory) reduce hash
- * lookup times at the expense of memory usage. */
-const int HASH_BITS = 7;
-const int HASH_SIZE = 1 << HASH_BITS;
-const int HASH_MASK = HASH_SIZE - 1;
-const int TOTAL_HASH_SIZE = 1 << (HASH_BITS * 2);
-const int TOTAL_HASH_MASK = TOTAL_HASH_SIZE - 1;
+/* Maximum size of the tile hash along one axis, 10 = 1024. The hash follows the
+ * map size up to this size, so on most maps every tile has its own chain. Larger
+ * maps wrap around, which keeps the table at 8 MiB at most. */
+static const uint MAX_TILE_HASH_BITS = 10;
 
 /* Resolution of the hash, 0 = 1*1 tile, 1 = 2*2 tiles, 2 = 4*4 tiles, etc.
  * Profiling results show that 0 is fastest. */
-const int HASH_RES = 0;
+static const uint HASH_RES = 0;
 
-static Vehicle *_vehicle_tile_hash[TOTAL_HASH_SIZE];
+static uint _tile_hash_bits_x; ///< Number of bits of the tile hash along the X axis.
+static uint _tile_hash_bits_y; ///< Number of bits of the tile hash along the Y axis.
+static std::vector<Vehicle *> _vehicle_tile_hash;
 
-static Vehicle *VehicleFromTileHash(int xl, int yl, int xu, int yu, void *data, VehicleFromPosProc *proc, bool find_first)
+VehicleHashStats _vehicle_hash_stats;
+
+/**
+ * Get the position in the tile hash along the X axis.
+ * @param x The X coordinate in tiles; may be outside of the map.
+ * @return The hash value along the X axis.
+ */
+static inline uint GetTileHashX(int x)
+{
+	return GB(x, HASH_RES, _tile_hash_bits_x);
+}
+
+/**
+ * Get the position in the tile hash along the Y axis, already shifted for adding it to the X part.
+ * @param y The Y coordinate in tiles; may be outside of the map.
+ * @return The hash value along the Y axis.
+ */
+static inline uint GetTileHashY(int y)
+{
+	return GB(y, HASH_RES, _tile_hash_bits_y) << _tile_hash_bits_x;
+}
+
+/**
+ * Size the tile hash for the current map. Every vehicle has to be reinserted
+ * into the hash afterwards.
+ */
+void AllocateVehicleTileHash()
+{
+	_tile_hash_bits_x = std::min(Map::LogX() - HASH_RES, MAX_TILE_HASH_BITS);
+	_tile_hash_bits_y = std::min(Map::LogY() - HASH_RES, MAX_TILE_HASH_BITS);
+
+	Debug(misc, 2, "Allocating {} x {} vehicle tile hash", 1U << _tile_hash_bits_x, 1U << _tile_hash_bits_y);
+
+	_vehicle_tile_hash.assign(static_cast<size_t>(1) << (_tile_hash_bits_x + _tile_hash_bits_y), nullptr);
+	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
+}
+
+/**
+ * Walk the whole tile hash to see how well the vehicles are spread over it.
+ * @return The occupancy of the tile hash.
+ */
+VehicleHashOccupancy GetVehicleTileHashOccupancy()
 {
-	for (int y = yl; ; y = (y + (1 << HASH_BITS)) & (HASH_MASK << HASH_BITS)) {
-		for (int x = xl; ; x = (x + 1) & HASH_MASK) {
-			Vehicle *v = _vehicle_tile_hash[(x + y) & TOTAL_HASH_MASK];
+	VehicleHashOccupancy occupancy{1U << _tile_hash_bits_x, 1U << _tile_hash_bits_y, 0, 0, 0};
+	for (const Vehicle *v : _vehicle_tile_hash) {
+		if (v == nullptr) continue;
+
+		size_t length = 0;
+		for (; v != nullptr; v = v->hash_tile_next) length++;
+		occupancy.used_chains++;
+		occupancy.vehicles += length;
+		occupancy.longest_chain = std::max(occupancy.longest_chain, length);
+	}
+	return occupancy;
+}
+
+static Vehicle *VehicleFromTileHash(uint xl, uint yl, uint xu, uint yu, void *data, VehicleFromPosProc *proc, bool find_first)
+{
+	const uint x_mask = (1U << _tile_hash_bits_x) - 1;
+	const uint y_mask = ((1U << _tile_hash_bits_y) - 1) << _tile_hash_bits_x;
+	uint64_t visited = 0;
+
+	for (uint y = yl; ; y = (y + (1U << _tile_hash_bits_x)) & y_mask) {
+		for (uint x = xl; ; x = (x + 1) & x_mask) {
+			Vehicle *v = _vehicle_tile_hash[x + y];
 			for (; v != nullptr; v = v->hash_tile_next) {
+				visited++;
 				Vehicle *a = proc(v, data);
-				if (find_first && a != nullptr) return a;
+				if (find_first && a != nullptr) {
+					_vehicle_hash_stats.Count(visited, 0);
+					return a;
+				}
 			}
 			if (x == xu) break;
 		}
 		if (y == yu) break;
 	}
 
+	_vehicle_hash_stats.Count(visited, 0);
 	return nullptr;
 }
 
@@ -420,10 +484,10 @@ static Vehicle *VehicleFromPosXY(int x, int y, void *data, VehicleFromPosProc *p
 	const int COLL_DIST = 6;
 
 	/* Hash area to scan is from xl,yl to xu,yu */
-	int xl = GB((x - COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS);
-	int xu = GB((x + COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS);
-	int yl = GB((y - COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS) << HASH_BITS;
-	int yu = GB((y + COLL_DIST) / TILE_SIZE, HASH_RES, HASH_BITS) << HASH_BITS;
+	uint xl = GetTileHashX((x - COLL_DIST) / TILE_SIZE);
+	uint xu = GetTileHashX((x + COLL_DIST) / TILE_SIZE);
+	uint yl = GetTileHashY((y - COLL_DIST) / TILE_SIZE);
+	uint yu = GetTileHashY((y + COLL_DIST) / TILE_SIZE);
 
 	return VehicleFromTileHash(xl, yl, xu, yu, data, proc, find_first);
 }
@@ -475,17 +539,25 @@ bool HasVehicleOnPosXY(int x, int y, void *data, VehicleFromPosProc *proc)
  */
 static Vehicle *VehicleFromPos(TileIndex tile, void *data, VehicleFromPosProc *proc, bool find_first)
 {
-	int x = GB(TileX(tile), HASH_RES, HASH_BITS);
-	int y = GB(TileY(tile), HASH_RES, HASH_BITS) << HASH_BITS;
+	uint64_t visited = 0;
+	uint64_t aliased = 0;
 
-	Vehicle *v = _vehicle_tile_hash[(x + y) & TOTAL_HASH_MASK];
+	Vehicle *v = _vehicle_tile_hash[GetTileHashX(TileX(tile)) + GetTileHashY(TileY(tile))];
 	for (; v != nullptr; v = v->hash_tile_next) {
-		if (v->tile != tile) continue;
+		visited++;
+		if (v->tile != tile) {
+			aliased++;
+			continue;
+		}
 
 		Vehicle *a = proc(v, data);
-		if (find_first && a != nullptr) return a;
+		if (find_first && a != nullptr) {
+			_vehicle_hash_stats.Count(visited, aliased);
+			return a;
+		}
 	}
 
+	_vehicle_hash_stats.Count(visited, aliased);
 	return nullptr;
 }
 
@@ -624,9 +696,7 @@ static void UpdateVehicleTileHash(Vehicle *v, bool remove)
 	if (remove) {
 		new_hash = nullptr;
 	} else {
-		int x = GB(TileX(v->tile), HASH_RES, HASH_BITS);
-		int y = GB(TileY(v->tile), HASH_RES, HASH_BITS) << HASH_BITS;
-		new_hash = &_vehicle_tile_hash[(x + y) & TOTAL_HASH_MASK];
+		new_hash = &_vehicle_tile_hash[GetTileHashX(TileX(v->tile)) + GetTileHashY(TileY(v->tile))];
 	}
 
 	if (old_hash == new_hash) return;
@@ -679,7 +749,7 @@ void ResetVehicleHash()
 {
 	for (Vehicle *v : Vehicle::Iterate()) { v->hash_tile_current = nullptr; }
 	memset(_vehicle_viewport_hash, 0, sizeof(_vehicle_viewport_hash));
-	memset(_vehicle_tile_hash, 0, sizeof(_vehicle_tile_hash));
+	std::fill(_vehicle_tile_hash.begin(), _vehicle_tile_hash.end(), nullptr);
 }
 
 void ResetVehicleColourMap()
@@ -992,6 +1062,8 @@ void CallVehicleTicks()
 	PerformanceAccumulator::Reset(PFE_GL_SHIPS);
 	PerformanceAccumulator::Reset(PFE_GL_AIRCRAFT);
 
+	PrepareTrainPathBatch();
+
 	for (Vehicle *v : Vehicle::Iterate()) {
 		[[maybe_unused]] size_t vehicle_index = v->index;
 
@@ -1063,6 +1135,8 @@ void CallVehicleTicks()
 		}
 	}
 
+	FinishTrainPathBatch();
+
 	Backup<CompanyID> cur_company(_current_company, FILE_LINE);
 	for (auto &it : _vehicles_to_autoreplace) {
 		Vehicle *v = it.first;
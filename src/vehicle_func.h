@@ -19,6 +19,8 @@
 #include "newgrf_config.h"
 #include "track_type.h"
 #include "livery.h"
+#include "debug.h"
+#include <atomic>
 
 #define is_custom_sprite(x) (x >= 0xFD)
 #define IS_CUSTOM_FIRSTHEAD_SPRITE(x) (x == 0xFD)
@@ -49,7 +51,51 @@ uint8_t CalcPercentVehicleFilled(const Vehicle *v, StringID *colour);
 
 void VehicleLengthChanged(const Vehicle *u);
 
+void AllocateVehicleTileHash();
 void ResetVehicleHash();
+
+/** Counters of the lookups in the vehicle tile hash. */
+struct VehicleHashStats {
+	std::atomic<uint64_t> queries{0}; ///< Number of position queries.
+	std::atomic<uint64_t> visited{0}; ///< Number of vehicles visited in the hash chains.
+	std::atomic<uint64_t> aliased{0}; ///< Number of visited vehicles that were on another tile of the same chain.
+
+	/**
+	 * Account for a single position query. Pathfinder threads query the hash
+	 * too, so the counters are atomic. To keep the lookups cheap they are
+	 * only counted when the misc debug level is at least 1.
+	 * @param visited Number of vehicles visited in the chains.
+	 * @param aliased Number of those vehicles that were on another tile.
+	 */
+	inline void Count(uint64_t visited, uint64_t aliased)
+	{
+		if (_debug_misc_level < 1) return;
+
+		this->queries.fetch_add(1, std::memory_order_relaxed);
+		if (visited != 0) this->visited.fetch_add(visited, std::memory_order_relaxed);
+		if (aliased != 0) this->aliased.fetch_add(aliased, std::memory_order_relaxed);
+	}
+
+	/** Reset all counters. */
+	inline void Reset()
+	{
+		this->queries = 0;
+		this->visited = 0;
+		this->aliased = 0;
+	}
+};
+
+/** Occupancy of the vehicle tile hash. */
+struct VehicleHashOccupancy {
+	uint size_x;          ///< Number of chains along the X axis.
+	uint size_y;          ///< Number of chains along the Y axis.
+	size_t used_chains;   ///< Number of chains with at least one vehicle.
+	size_t vehicles;      ///< Number of vehicles in the hash.
+	size_t longest_chain; ///< Length of the longest chain.
+};
+
+extern VehicleHashStats _vehicle_hash_stats;
+VehicleHashOccupancy GetVehicleTileHashOccupancy();
 void ResetVehicleColourMap();
 
 byte GetBestFittingSubType(Vehicle *v_from, Vehicle *v_for, CargoID dest_cargo_type);
@@ -91,6 +91,7 @@
 #include "network/network_func.h"
 #include "framerate_type.h"
 #include "viewport_cmd.h"
+#include "screenshot.h"
 
 #include <forward_list>
 #include <stack>
@@ -213,6 +214,8 @@ struct ViewportDrawer {
 	Point foundation_offset[FOUNDATION_PART_END];    ///< Pixel offset for ground sprites on the foundations.
 
 	citymania::TileHighlight cm_highlight;
+
+	std::vector<ViewportSpriteDrawRecord> sprite_draw_records; ///< Scratch buffer for submitting sprites to DrawSpriteViewportBatch().
 };
 
 static bool MarkViewportDirty(Viewport *vp, int left, int top, int right, int bottom);
@@ -1576,9 +1579,12 @@ void ViewportSign::MarkDirty(ZoomLevel maxzoom) const
 
 static void ViewportDrawTileSprites(const TileSpriteToDrawVector *tstdv)
 {
+	std::vector<ViewportSpriteDrawRecord> &records = _vd.sprite_draw_records;
+	records.clear();
 	for (const TileSpriteToDraw &ts : *tstdv) {
-		DrawSpriteViewport(ts.image, ts.pal, ts.x, ts.y, ts.sub);
+		records.push_back({ts.image, ts.pal, ts.sub, ts.x, ts.y});
 	}
+	DrawSpriteViewportBatch(records);
 }
 
 /** This fallback sprite checker always exists. */
@@ -1710,20 +1716,23 @@ static void ViewportSortParentSprites(ParentSpriteToSortVector *psdv)
 
 static void ViewportDrawParentSprites(const ParentSpriteToSortVector *psd, const ChildScreenSpriteToDrawVector *csstdv)
 {
+	std::vector<ViewportSpriteDrawRecord> &records = _vd.sprite_draw_records;
+	records.clear();
 	for (const ParentSpriteToDraw *ps : *psd) {
-		if (ps->image != SPR_EMPTY_BOUNDING_BOX) DrawSpriteViewport(ps->image, ps->pal, ps->x, ps->y, ps->sub);
+		if (ps->image != SPR_EMPTY_BOUNDING_BOX) records.push_back({ps->image, ps->pal, ps->sub, ps->x, ps->y});
 
 		int child_idx = ps->first_child;
 		while (child_idx >= 0) {
 			const ChildScreenSpriteToDraw *cs = csstdv->data() + child_idx;
 			child_idx = cs->next;
 			if (cs->relative) {
-				DrawSpriteViewport(cs->image, cs->pal, ps->left + cs->x, ps->top + cs->y, cs->sub);
+				records.push_back({cs->image, cs->pal, cs->sub, ps->left + cs->x, ps->top + cs->y});
 			} else {
-				DrawSpriteViewport(cs->image, cs->pal, ps->x + cs->x, ps->y + cs->y, cs->sub);
+				records.push_back({cs->image, cs->pal, cs->sub, ps->x + cs->x, ps->y + cs->y});
 			}
 		}
 	}
+	DrawSpriteViewportBatch(records);
 }
 
 /**
@@ -2186,11 +2195,12 @@ void ConstrainAllViewportsZoom()
 void MarkTileDirtyByTile(TileIndex tile, int bridge_level_offset, int tile_height_override)
 {
 	Point pt = RemapCoords(TileX(tile) * TILE_SIZE, TileY(tile) * TILE_SIZE, tile_height_override * TILE_HEIGHT);
-	MarkAllViewportsDirty(
-			pt.x - MAX_TILE_EXTENT_LEFT,
-			pt.y - MAX_TILE_EXTENT_TOP - ZOOM_LVL_BASE * TILE_HEIGHT * bridge_level_offset,
-			pt.x + MAX_TILE_EXTENT_RIGHT,
-			pt.y + MAX_TILE_EXTENT_BOTTOM);
+	int left = pt.x - MAX_TILE_EXTENT_LEFT;
+	int top = pt.y - MAX_TILE_EXTENT_TOP - ZOOM_LVL_BASE * TILE_HEIGHT * bridge_level_offset;
+	int right = pt.x + MAX_TILE_EXTENT_RIGHT;
+	int bottom = pt.y + MAX_TILE_EXTENT_BOTTOM;
+	MarkAllViewportsDirty(left, top, right, bottom);
+	MarkTilePyramidDirty(left, top, right, bottom);
 }
 
 /**
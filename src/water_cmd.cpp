@@ -1272,6 +1272,54 @@ void TileLoop_Water(TileIndex tile)
 	}
 }
 
+/** Plans of TileLoopPlan_Water. */
+enum WaterTileLoopPlan : uint8_t {
+	WTLP_NOTHING = 1, ///< The tile does not flood.
+	WTLP_OPEN_SEA,    ///< The tile floods, but all its neighbours were water already.
+};
+
+/**
+ * Check whether all neighbours of a tile are water, so flooding from it has nothing to do.
+ * @param tile The tile to check.
+ * @return True iff all valid neighbours are water tiles.
+ */
+static bool AreAllNeighboursWater(TileIndex tile)
+{
+	for (Direction dir = DIR_BEGIN; dir < DIR_END; dir++) {
+		TileIndex dest = tile + TileOffsByDir(dir);
+		if (IsValidTile(dest) && !IsTileType(dest, MP_WATER)) return false;
+	}
+	return true;
+}
+
+/**
+ * Plan the tile loop of a water tile. Canals, rivers and open sea do not
+ * change anything; coasts and sea next to land run the tile loop as usual.
+ * @param tile The tile to plan for.
+ * @return The plan.
+ */
+static uint8_t TileLoopPlan_Water(TileIndex tile)
+{
+	if (HasGrfMiscBit(GMB_AMBIENT_SOUND_CALLBACK)) return TILE_LOOP_RUN;
+
+	switch (GetFloodingBehaviour(tile)) {
+		case FLOOD_NONE: return WTLP_NOTHING;
+		case FLOOD_ACTIVE: return AreAllNeighboursWater(tile) ? (uint8_t)WTLP_OPEN_SEA : TILE_LOOP_RUN;
+		default: return TILE_LOOP_RUN;
+	}
+}
+
+/**
+ * Carry out a plan of TileLoopPlan_Water, like TileLoop_Water would have done.
+ * @param tile The tile to run the tile loop for.
+ * @param plan The plan.
+ */
+static void TileLoopApply_Water(TileIndex tile, uint8_t plan)
+{
+	/* Tile loops earlier in this tick may have changed a neighbour. */
+	if (plan == WTLP_OPEN_SEA && !AreAllNeighboursWater(tile)) TileLoop_Water(tile);
+}
+
 void ConvertGroundTilesIntoWaterTiles()
 {
 	int z;
@@ -1410,4 +1458,6 @@ extern const TileTypeProcs _tile_type_water_procs = {
 	VehicleEnter_Water,       // vehicle_enter_tile_proc
 	GetFoundation_Water,      // get_foundation_proc
 	TerraformTile_Water,      // terraform_tile_proc
+	TileLoopPlan_Water,       // tile_loop_plan_proc
+	TileLoopApply_Water,      // tile_loop_apply_proc
 };